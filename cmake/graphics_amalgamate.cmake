@@ -0,0 +1,71 @@
+# cmake -DROOT_DIR=<graphics root> -DOUTPUT=<path/graphics.h> -P graphics_amalgamate.cmake
+
+cmake_minimum_required(VERSION 3.10)
+
+if(NOT ROOT_DIR OR NOT OUTPUT)
+    message(FATAL_ERROR "graphics_amalgamate: ROOT_DIR and OUTPUT are required")
+endif()
+
+set(SOURCE_DIR ${ROOT_DIR}/src)
+set(INCLUDE_DIR ${ROOT_DIR}/include)
+
+set_property(GLOBAL PROPERTY GRAPHICS_AMALGAMATE_VISITED "")
+
+function(GRAPHICS_AMALGAMATE_FILE path result)
+    set_property(GLOBAL APPEND PROPERTY GRAPHICS_AMALGAMATE_VISITED ${path})
+
+    file(READ ${path} content)
+
+    string(REGEX MATCHALL "#include \"[^\"]+\"" includes "${content}")
+
+    foreach(include ${includes})
+        string(REGEX REPLACE "#include \"([^\"]+)\"" "\\1" name "${include}")
+
+        if(EXISTS ${SOURCE_DIR}/${name})
+            set(include_path ${SOURCE_DIR}/${name})
+        elseif(EXISTS ${INCLUDE_DIR}/${name})
+            set(include_path ${INCLUDE_DIR}/${name})
+        else()
+            message(FATAL_ERROR "graphics_amalgamate: ${path} includes unknown '${name}'")
+        endif()
+
+        get_property(visited GLOBAL PROPERTY GRAPHICS_AMALGAMATE_VISITED)
+
+        if(include_path IN_LIST visited)
+            set(include_content "")
+        else()
+            GRAPHICS_AMALGAMATE_FILE(${include_path} include_content)
+        endif()
+
+        string(REPLACE "${include}" "${include_content}" content "${content}")
+    endforeach()
+
+    set(${result} "${content}" PARENT_SCOPE)
+endfunction()
+
+GRAPHICS_AMALGAMATE_FILE(${INCLUDE_DIR}/graphics/graphics.h public_content)
+
+file(GLOB sources ${SOURCE_DIR}/*.c)
+list(SORT sources)
+
+set(implementation_content "")
+
+foreach(source ${sources})
+    GRAPHICS_AMALGAMATE_FILE(${source} source_content)
+
+    string(APPEND implementation_content "${source_content}\n")
+endforeach()
+
+file(WRITE ${OUTPUT} "/* graphics single header, generated by cmake/graphics_amalgamate.cmake\n"
+    "*\n"
+    "* #define GRAPHICS_IMPLEMENTATION before including this file in exactly one\n"
+    "* translation unit to compile the library into it.\n"
+    "*/\n\n"
+    "#ifndef GRAPHICS_SINGLE_HEADER_H_\n"
+    "#define GRAPHICS_SINGLE_HEADER_H_\n\n"
+    "${public_content}\n\n"
+    "#endif\n\n"
+    "#if defined(GRAPHICS_IMPLEMENTATION) && !defined(GRAPHICS_IMPLEMENTATION_H_)\n"
+    "#define GRAPHICS_IMPLEMENTATION_H_\n\n"
+    "${implementation_content}\n"
+    "#endif\n")
@@ -277,6 +277,11 @@ int main( int argc, char ** argv )
 
     editor.SetLanguageDefinition( lang );
 
+    bool mesh_valid = false;
+    gp_uint64_t mesh_canvas_hash = 0;
+    bool mesh_sdf = false;
+    gp_uint16_t mesh_index_count = 0;
+
     while( glfwWindowShouldClose( fwWindow ) == 0 )
     {
         glfwPollEvents();
@@ -306,6 +311,10 @@ int main( int argc, char ** argv )
 
         ImGui::Checkbox( "fill", &fill );
 
+        static bool sdf = false;
+
+        ImGui::Checkbox( "sdf", &sdf );
+
         static float thickness = gp_get_default_thickness();
         ImGui::DragFloat( "thickness", &thickness, 0.125f, 0.125f, 64.f );
 
@@ -315,6 +324,18 @@ int main( int argc, char ** argv )
         static float outline_width = gp_get_default_outline_width();
         ImGui::DragFloat( "outline width", &outline_width, 0.0125f, 0.f, 64.f );
 
+        static int line_join = GP_LINE_JOIN_MITER;
+        ImGui::Combo( "line join", &line_join, "miter\0bevel\0round\0" );
+
+        static float miter_limit = gp_get_default_miter_limit();
+        ImGui::DragFloat( "miter limit", &miter_limit, 0.0125f, 1.f, 64.f );
+
+        static float dash_pattern[2] = {0.f, 0.f};
+        ImGui::DragFloat2( "dash", dash_pattern, 0.125f, 0.f, 256.f );
+
+        static float dash_offset = 0.f;
+        ImGui::DragFloat( "dash offset", &dash_offset, 0.125f, -256.f, 256.f );
+
         static int curve_quality = gp_get_default_curve_quality();
         ImGui::SliderInt( "curve quality", &curve_quality, 1, 64 );
 
@@ -419,7 +440,19 @@ int main( int argc, char ** argv )
             glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
         }
 
-        if( texture == 1 )
+        if( sdf == true )
+        {
+            glActiveTexture( GL_TEXTURE0 );
+            glBindTexture( GL_TEXTURE_2D, 0 );
+
+            opengl_use_sdf_program( opengl_handle );
+
+            glDisableVertexAttribArray( 2 );
+            glEnableVertexAttribArray( 3 );
+            glEnableVertexAttribArray( 4 );
+            glEnableVertexAttribArray( 5 );
+        }
+        else if( texture == 1 )
         {
             glActiveTexture( GL_TEXTURE0 );
             glBindTexture( GL_TEXTURE_2D, opengl_handle->textureId );
@@ -427,6 +460,9 @@ int main( int argc, char ** argv )
             opengl_use_texture_program( opengl_handle );
 
             glEnableVertexAttribArray( 2 );
+            glDisableVertexAttribArray( 3 );
+            glDisableVertexAttribArray( 4 );
+            glDisableVertexAttribArray( 5 );
         }
         else
         {
@@ -436,6 +472,9 @@ int main( int argc, char ** argv )
             opengl_use_color_program( opengl_handle );
 
             glDisableVertexAttribArray( 2 );
+            glDisableVertexAttribArray( 3 );
+            glDisableVertexAttribArray( 4 );
+            glDisableVertexAttribArray( 5 );
         }
 
         opengl_set_camera( opengl_handle, camera_offset_x, camera_offset_y, camera_scale );
@@ -448,11 +487,16 @@ int main( int argc, char ** argv )
             gp_set_thickness( canvas, thickness );
             gp_set_penumbra( canvas, thickness * penumbra * 0.5f );
             gp_set_outline_width( canvas, outline_width );
+            gp_set_line_join( canvas, (gp_line_join_e)line_join );
+            gp_set_miter_limit( canvas, miter_limit );
+            gp_set_dash( canvas, dash_pattern, dash_pattern[0] + dash_pattern[1] > 0.f ? 2 : 0, dash_offset );
 
             gp_set_curve_quality( canvas, curve_quality );
             gp_set_ellipse_quality( canvas, ellipse_quality );
             gp_set_rect_quality( canvas, rect_quality );
 
+            gp_set_sdf( canvas, sdf == true ? GP_TRUE : GP_FALSE );
+
             if( fill == true )
             {
                 gp_begin_fill( canvas );
@@ -466,52 +510,82 @@ int main( int argc, char ** argv )
             }
         }
 
-        gp_mesh_t mesh;
-        gp_calculate_mesh_size( canvas, &mesh );
-
-        if( mesh.vertex_count >= max_vertex_count ||
-            mesh.index_count >= max_index_count )
-        {
-            break;
-        }
+        gp_uint64_t canvas_hash;
+        gp_canvas_get_hash( canvas, &canvas_hash );
 
         glBindBuffer( GL_ARRAY_BUFFER, opengl_handle->VBO );
         glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, opengl_handle->IBO );
 
-        void * vertices = glMapBuffer( GL_ARRAY_BUFFER, GL_WRITE_ONLY );
-        void * indices = glMapBuffer( GL_ELEMENT_ARRAY_BUFFER, GL_WRITE_ONLY );
+        gp_result_t result = GP_SUCCESSFUL;
+
+        if( mesh_valid == false || canvas_hash != mesh_canvas_hash || sdf != mesh_sdf )
+        {
+            gp_mesh_t mesh;
+            gp_calculate_mesh_size( canvas, &mesh );
 
-        gl_vertex_t * v = (gl_vertex_t *)vertices;
+            if( mesh.vertex_count >= max_vertex_count ||
+                mesh.index_count >= max_index_count )
+            {
+                break;
+            }
 
-        mesh.color.r = 1.f;
-        mesh.color.g = 1.f;
-        mesh.color.b = 1.f;
-        mesh.color.a = 1.f;
+            void * vertices = glMapBuffer( GL_ARRAY_BUFFER, GL_WRITE_ONLY );
+            void * indices = glMapBuffer( GL_ELEMENT_ARRAY_BUFFER, GL_WRITE_ONLY );
 
-        mesh.positions_buffer = vertices;
-        mesh.positions_offset = offsetof( gl_vertex_t, x );
-        mesh.positions_stride = sizeof( gl_vertex_t );
+            gl_vertex_t * v = (gl_vertex_t *)vertices;
 
-        mesh.colors_buffer = vertices;
-        mesh.colors_offset = offsetof( gl_vertex_t, c );
-        mesh.colors_stride = sizeof( gl_vertex_t );
+            mesh.color.r = 1.f;
+            mesh.color.g = 1.f;
+            mesh.color.b = 1.f;
+            mesh.color.a = 1.f;
 
-        mesh.uv_buffer = vertices;
-        mesh.uv_offset = offsetof( gl_vertex_t, u );
-        mesh.uv_stride = sizeof( gl_vertex_t );
+            mesh.positions_buffer = vertices;
+            mesh.positions_offset = offsetof( gl_vertex_t, x );
+            mesh.positions_stride = sizeof( gl_vertex_t );
 
-        mesh.indices_buffer = indices;
-        mesh.indices_offset = 0;
-        mesh.indices_stride = sizeof( gp_uint16_t );
+            mesh.colors_buffer = vertices;
+            mesh.colors_offset = offsetof( gl_vertex_t, c );
+            mesh.colors_stride = sizeof( gl_vertex_t );
+            mesh.colors_format = GP_COLOR_FORMAT_ABGR;
 
-        gp_result_t result = gp_render( canvas, &mesh );
+            mesh.uv_buffer = vertices;
+            mesh.uv_offset = offsetof( gl_vertex_t, u );
+            mesh.uv_stride = sizeof( gl_vertex_t );
 
-        glUnmapBuffer( GL_ARRAY_BUFFER );
-        glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER );
+            mesh.indices_buffer = indices;
+            mesh.indices_offset = 0;
+            mesh.indices_stride = sizeof( gp_uint16_t );
+
+            if( sdf == true )
+            {
+                glBindBuffer( GL_ARRAY_BUFFER, opengl_handle->SDFBO );
+
+                mesh.sdf_buffer = glMapBuffer( GL_ARRAY_BUFFER, GL_WRITE_ONLY );
+                mesh.sdf_offset = 0;
+                mesh.sdf_stride = sizeof( gp_sdf_t );
+            }
+
+            result = gp_render( canvas, &mesh );
+
+            if( sdf == true )
+            {
+                glUnmapBuffer( GL_ARRAY_BUFFER );
+
+                glBindBuffer( GL_ARRAY_BUFFER, opengl_handle->VBO );
+            }
+
+            glUnmapBuffer( GL_ARRAY_BUFFER );
+            glUnmapBuffer( GL_ELEMENT_ARRAY_BUFFER );
+
+            mesh_valid = result == GP_SUCCESSFUL;
+            mesh_canvas_hash = canvas_hash;
+            mesh_sdf = sdf;
+            mesh_index_count = mesh.index_count;
+        }
 
         if( result == GP_SUCCESSFUL )
         {
-            glDrawElements( GL_TRIANGLES, mesh.index_count, GL_UNSIGNED_SHORT, GP_NULLPTR );
+            glDrawElements( GL_TRIANGLES, mesh_index_count, GL_UNSIGNED_SHORT, GP_NULLPTR );
         }
 
         if( TextEditorCollapsingHeader == true )
@@ -355,6 +355,36 @@ static int __lua_f_rounded_rect( lua_State * L )
     return 0;
 }
 //////////////////////////////////////////////////////////////////////////
+static int __lua_f_rounded_rect_corners( lua_State * L )
+{
+    int args_count = 8;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x = lua_tonumber( L, 1 );
+    lua_Number y = lua_tonumber( L, 2 );
+    lua_Number w = lua_tonumber( L, 3 );
+    lua_Number h = lua_tonumber( L, 4 );
+    lua_Number tl = lua_tonumber( L, 5 );
+    lua_Number tr = lua_tonumber( L, 6 );
+    lua_Number br = lua_tonumber( L, 7 );
+    lua_Number bl = lua_tonumber( L, 8 );
+
+    if( gp_rounded_rect_corners( handle->canvas, (float)x, (float)y, (float)w, (float)h, (float)tl, (float)tr, (float)br, (float)bl ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid rounded rect corners";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
 static int __lua_f_circle( lua_State * L )
 {
     int args_count = 3;
@@ -406,6 +436,548 @@ static int __lua_f_ellipse( lua_State * L )
     return 0;
 }
 //////////////////////////////////////////////////////////////////////////
+static int __lua_f_arc( lua_State * L )
+{
+    int args_count = 6;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x = lua_tonumber( L, 1 );
+    lua_Number y = lua_tonumber( L, 2 );
+    lua_Number w = lua_tonumber( L, 3 );
+    lua_Number h = lua_tonumber( L, 4 );
+    lua_Number start = lua_tonumber( L, 5 );
+    lua_Number sweep = lua_tonumber( L, 6 );
+
+    if( gp_arc( handle->canvas, (float)x, (float)y, (float)w, (float)h, (float)start, (float)sweep ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid arc";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_arc_to( lua_State * L )
+{
+    int args_count = 7;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number rx = lua_tonumber( L, 1 );
+    lua_Number ry = lua_tonumber( L, 2 );
+    lua_Number rotation = lua_tonumber( L, 3 );
+    int large_arc = lua_toboolean( L, 4 );
+    int sweep = lua_toboolean( L, 5 );
+    lua_Number x = lua_tonumber( L, 6 );
+    lua_Number y = lua_tonumber( L, 7 );
+
+    if( gp_arc_to( handle->canvas, (float)rx, (float)ry, (float)rotation, large_arc != 0 ? GP_TRUE : GP_FALSE, sweep != 0 ? GP_TRUE : GP_FALSE, (float)x, (float)y ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid arc to";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static bool __lua_table_floats( lua_State * L, int _index, gp_uint32_t _stride, std::vector<float> & _floats, gp_uint32_t * _count )
+{
+    if( lua_type( L, _index ) != LUA_TTABLE )
+    {
+        return false;
+    }
+
+    lua_Unsigned length = lua_rawlen( L, _index );
+
+    if( length % _stride != 0 )
+    {
+        return false;
+    }
+
+    _floats.resize( (size_t)length );
+
+    float * floats = _floats.data();
+
+    for( lua_Unsigned index = 0; index != length; ++index )
+    {
+        lua_rawgeti( L, _index, (lua_Integer)index + 1 );
+        floats[index] = (float)lua_tonumber( L, -1 );
+        lua_pop( L, 1 );
+    }
+
+    *_count = (gp_uint32_t)(length / _stride);
+
+    return true;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_polyline( lua_State * L )
+{
+    int args_count = 1;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    gp_uint32_t count;
+    if( __lua_table_floats( L, 1, 2, handle->floats, &count ) == false )
+    {
+        return luaL_error( L, "expecting flat table of x, y pairs" );
+    }
+
+    if( gp_polyline( handle->canvas, handle->floats.data(), count ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid polyline";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_linear_gradient( lua_State * L )
+{
+    int args_count = 5;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x0 = lua_tonumber( L, 1 );
+    lua_Number y0 = lua_tonumber( L, 2 );
+    lua_Number x1 = lua_tonumber( L, 3 );
+    lua_Number y1 = lua_tonumber( L, 4 );
+
+    gp_uint32_t count;
+    if( __lua_table_floats( L, 5, 5, handle->floats, &count ) == false )
+    {
+        return luaL_error( L, "expecting flat table of offset, r, g, b, a stops" );
+    }
+
+    if( gp_set_linear_gradient( handle->canvas, (float)x0, (float)y0, (float)x1, (float)y1, handle->floats.data(), count ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid linear gradient";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_radial_gradient( lua_State * L )
+{
+    int args_count = 4;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x = lua_tonumber( L, 1 );
+    lua_Number y = lua_tonumber( L, 2 );
+    lua_Number radius = lua_tonumber( L, 3 );
+
+    gp_uint32_t count;
+    if( __lua_table_floats( L, 4, 5, handle->floats, &count ) == false )
+    {
+        return luaL_error( L, "expecting flat table of offset, r, g, b, a stops" );
+    }
+
+    if( gp_set_radial_gradient( handle->canvas, (float)x, (float)y, (float)radius, handle->floats.data(), count ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid radial gradient";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_clear_gradient( lua_State * L )
+{
+    int args_count = 0;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    if( gp_clear_gradient( handle->canvas ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid clear gradient";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_rects( lua_State * L )
+{
+    int args_count = 1;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    gp_uint32_t count;
+    if( __lua_table_floats( L, 1, 4, handle->floats, &count ) == false )
+    {
+        return luaL_error( L, "expecting flat table of x, y, width, height" );
+    }
+
+    if( gp_rects( handle->canvas, handle->floats.data(), count ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid rects";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_rounded_rects( lua_State * L )
+{
+    int args_count = 1;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    gp_uint32_t count;
+    if( __lua_table_floats( L, 1, 5, handle->floats, &count ) == false )
+    {
+        return luaL_error( L, "expecting flat table of x, y, width, height, radius" );
+    }
+
+    if( gp_rounded_rects( handle->canvas, handle->floats.data(), count ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid rounded rects";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_circles( lua_State * L )
+{
+    int args_count = 1;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    gp_uint32_t count;
+    if( __lua_table_floats( L, 1, 3, handle->floats, &count ) == false )
+    {
+        return luaL_error( L, "expecting flat table of x, y, radius" );
+    }
+
+    if( gp_circles( handle->canvas, handle->floats.data(), count ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid circles";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_ellipses( lua_State * L )
+{
+    int args_count = 1;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    gp_uint32_t count;
+    if( __lua_table_floats( L, 1, 4, handle->floats, &count ) == false )
+    {
+        return luaL_error( L, "expecting flat table of x, y, width, height" );
+    }
+
+    if( gp_ellipses( handle->canvas, handle->floats.data(), count ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid ellipses";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_push_retained( lua_State * L, example_script_handle_t * _handle, gp_shape_type_e _type )
+{
+    gp_shape_handle_t shape = 0;
+
+    if( gp_shape_retain( _handle->canvas, _type, &shape ) == GP_FAILURE )
+    {
+        _handle->result = GP_FAILURE;
+        _handle->error_msg = "invalid retain";
+        _handle->error_line = __lua_get_line( L );
+    }
+
+    lua_pushinteger( L, (lua_Integer)shape );
+
+    return 1;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_rect_retained( lua_State * L )
+{
+    int args_count = 4;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x = lua_tonumber( L, 1 );
+    lua_Number y = lua_tonumber( L, 2 );
+    lua_Number w = lua_tonumber( L, 3 );
+    lua_Number h = lua_tonumber( L, 4 );
+
+    if( gp_rect( handle->canvas, (float)x, (float)y, (float)w, (float)h ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid rect";
+        handle->error_line = __lua_get_line( L );
+
+        lua_pushinteger( L, 0 );
+
+        return 1;
+    }
+
+    return __lua_push_retained( L, handle, GP_SHAPE_TYPE_RECT );
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_rounded_rect_retained( lua_State * L )
+{
+    int args_count = 5;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x = lua_tonumber( L, 1 );
+    lua_Number y = lua_tonumber( L, 2 );
+    lua_Number w = lua_tonumber( L, 3 );
+    lua_Number h = lua_tonumber( L, 4 );
+    lua_Number r = lua_tonumber( L, 5 );
+
+    if( gp_rounded_rect( handle->canvas, (float)x, (float)y, (float)w, (float)h, (float)r ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid rounded rect";
+        handle->error_line = __lua_get_line( L );
+
+        lua_pushinteger( L, 0 );
+
+        return 1;
+    }
+
+    return __lua_push_retained( L, handle, GP_SHAPE_TYPE_ROUNDED_RECT );
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_circle_retained( lua_State * L )
+{
+    int args_count = 3;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x = lua_tonumber( L, 1 );
+    lua_Number y = lua_tonumber( L, 2 );
+    lua_Number r = lua_tonumber( L, 3 );
+
+    if( gp_circle( handle->canvas, (float)x, (float)y, (float)r ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid circle";
+        handle->error_line = __lua_get_line( L );
+
+        lua_pushinteger( L, 0 );
+
+        return 1;
+    }
+
+    return __lua_push_retained( L, handle, GP_SHAPE_TYPE_ELLIPSE );
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_ellipse_retained( lua_State * L )
+{
+    int args_count = 4;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Number x = lua_tonumber( L, 1 );
+    lua_Number y = lua_tonumber( L, 2 );
+    lua_Number w = lua_tonumber( L, 3 );
+    lua_Number h = lua_tonumber( L, 4 );
+
+    if( gp_ellipse( handle->canvas, (float)x, (float)y, (float)w, (float)h ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid ellipse";
+        handle->error_line = __lua_get_line( L );
+
+        lua_pushinteger( L, 0 );
+
+        return 1;
+    }
+
+    return __lua_push_retained( L, handle, GP_SHAPE_TYPE_ELLIPSE );
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_shape_position( lua_State * L )
+{
+    int args_count = 3;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Integer shape = lua_tointeger( L, 1 );
+    lua_Number x = lua_tonumber( L, 2 );
+    lua_Number y = lua_tonumber( L, 3 );
+
+    if( gp_shape_set_position( handle->canvas, (gp_shape_handle_t)shape, (float)x, (float)y ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid shape position";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_shape_size( lua_State * L )
+{
+    int args_count = 3;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Integer shape = lua_tointeger( L, 1 );
+    lua_Number w = lua_tonumber( L, 2 );
+    lua_Number h = lua_tonumber( L, 3 );
+
+    if( gp_shape_set_size( handle->canvas, (gp_shape_handle_t)shape, (float)w, (float)h ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid shape size";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_shape_color( lua_State * L )
+{
+    int args_count = 5;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Integer shape = lua_tointeger( L, 1 );
+    lua_Number r = lua_tonumber( L, 2 );
+    lua_Number g = lua_tonumber( L, 3 );
+    lua_Number b = lua_tonumber( L, 4 );
+    lua_Number a = lua_tonumber( L, 5 );
+
+    if( gp_shape_set_color( handle->canvas, (gp_shape_handle_t)shape, (float)r, (float)g, (float)b, (float)a ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid shape color";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static int __lua_f_shape_remove( lua_State * L )
+{
+    int args_count = 1;
+
+    if( lua_gettop( L ) != args_count )
+    {
+        return luaL_error( L, "expecting exactly %d arguments", args_count );
+    }
+
+    example_script_handle_t * handle = *(example_script_handle_t **)lua_getextraspace( L );
+
+    lua_Integer shape = lua_tointeger( L, 1 );
+
+    if( gp_shape_remove( handle->canvas, (gp_shape_handle_t)shape ) == GP_FAILURE )
+    {
+        handle->result = GP_FAILURE;
+        handle->error_msg = "invalid shape remove";
+        handle->error_line = __lua_get_line( L );
+    }
+
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////////
 static int __lua_call( example_script_handle_t * _handle )
 {
     if( setjmp( _handle->panic_jump ) == 1 )
@@ -426,6 +998,9 @@ static const struct luaL_Reg lua_functions[] = {
     , {"outline_width", &__lua_f_outline_width}
     , {"color", &__lua_f_color}
     , {"outline_color", &__lua_f_outline_color}
+    , {"linear_gradient", &__lua_f_linear_gradient}
+    , {"radial_gradient", &__lua_f_radial_gradient}
+    , {"clear_gradient", &__lua_f_clear_gradient}
     , {"begin_fill", &__lua_f_begin_fill}
     , {"end_fill", &__lua_f_end_fill}
     , {"move_to", &__lua_f_move_to}
@@ -434,8 +1009,24 @@ static const struct luaL_Reg lua_functions[] = {
     , {"bezier_curve_to", &__lua_f_bezier_curve_to}
     , {"rect", &__lua_f_rect}
     , {"rounded_rect", &__lua_f_rounded_rect}
+    , {"rounded_rect_corners", &__lua_f_rounded_rect_corners}
     , {"circle", &__lua_f_circle}
     , {"ellipse", &__lua_f_ellipse}
+    , {"arc", &__lua_f_arc}
+    , {"arc_to", &__lua_f_arc_to}
+    , {"polyline", &__lua_f_polyline}
+    , {"rects", &__lua_f_rects}
+    , {"rounded_rects", &__lua_f_rounded_rects}
+    , {"circles", &__lua_f_circles}
+    , {"ellipses", &__lua_f_ellipses}
+    , {"rect_retained", &__lua_f_rect_retained}
+    , {"rounded_rect_retained", &__lua_f_rounded_rect_retained}
+    , {"circle_retained", &__lua_f_circle_retained}
+    , {"ellipse_retained", &__lua_f_ellipse_retained}
+    , {"shape_position", &__lua_f_shape_position}
+    , {"shape_size", &__lua_f_shape_size}
+    , {"shape_color", &__lua_f_shape_color}
+    , {"shape_remove", &__lua_f_shape_remove}
 
     , {NULL, NULL} /* end of array */
 };
@@ -3,6 +3,7 @@
 #include "graphics/graphics.hpp"
 
 #include <string>
+#include <vector>
 
 extern "C"{
 #include "lua.h"
@@ -22,6 +23,8 @@ typedef struct example_script_handle_t
 
     gp_canvas_t * canvas;
 
+    std::vector<float> floats;
+
     gp_result_t result;
     std::string error_msg;
     int error_line;
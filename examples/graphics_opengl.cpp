@@ -204,12 +204,67 @@ static const char * fragmentShaderTextureSource = "#version 330 core\n"
 "   oColor = texColor * v2fColor;\n"
 "}\n\0";
 //////////////////////////////////////////////////////////////////////////
+static const char * vertexShaderSDFSource = "#version 330 core\n"
+"layout (location = 0) in vec2 inPos;\n"
+"layout (location = 1) in vec4 inColor;\n"
+"layout (location = 3) in vec4 inShape;\n"
+"layout (location = 4) in vec3 inParams;\n"
+"layout (location = 5) in uint inType;\n"
+"uniform mat4 uWVP;\n"
+"uniform float uScale;\n"
+"uniform vec2 uOffset;\n"
+"out vec4 v2fColor;\n"
+"out vec4 v2fShape;\n"
+"out vec3 v2fParams;\n"
+"flat out uint v2fType;\n"
+"void main()\n"
+"{\n"
+"   vec3 p = vec3(inPos.xy + uOffset, 0.0) * uScale;\n"
+"   gl_Position = uWVP * vec4(p, 1.0);\n"
+"   v2fColor = inColor;\n"
+"   v2fShape = inShape;\n"
+"   v2fParams = inParams;\n"
+"   v2fType = inType;\n"
+"}\0";
+//////////////////////////////////////////////////////////////////////////
+static const char * fragmentShaderSDFSource = "#version 330 core\n"
+"in vec4 v2fColor;\n"
+"in vec4 v2fShape;\n"
+"in vec3 v2fParams;\n"
+"flat in uint v2fType;\n"
+"out vec4 oColor;\n"
+"float sdEllipse( vec2 p, vec2 r )\n"
+"{\n"
+"   float k0 = length( p / r );\n"
+"   float k1 = length( p / (r * r) );\n"
+"   return k0 * (k0 - 1.0) / k1;\n"
+"}\n"
+"float sdRoundedRect( vec2 p, vec2 b, float r )\n"
+"{\n"
+"   vec2 q = abs( p ) - b + r;\n"
+"   return length( max( q, 0.0 ) ) + min( max( q.x, q.y ), 0.0 ) - r;\n"
+"}\n"
+"void main()\n"
+"{\n"
+"   if( v2fType == 0u )\n"
+"   {\n"
+"       oColor = v2fColor;\n"
+"       return;\n"
+"   }\n"
+"   float d = v2fType < 3u ? sdEllipse( v2fShape.xy, v2fShape.zw ) : sdRoundedRect( v2fShape.xy, v2fShape.zw, v2fParams.x );\n"
+"   float h = v2fParams.y * 0.5;\n"
+"   d = (v2fType == 1u || v2fType == 3u) ? abs( d ) - h : d - h;\n"
+"   float aa = max( v2fParams.z, fwidth( d ) );\n"
+"   oColor = vec4( v2fColor.rgb, v2fColor.a * clamp( -d / aa, 0.0, 1.0 ) );\n"
+"}\n\0";
+//////////////////////////////////////////////////////////////////////////
 bool initialize_opengl( example_opengl_handle_t ** _handle, float _width, float _height, int _max_vertex_count, int _max_index_count )
 {
     GLuint textureId = __make_texture( "texture.jpg" );
 
     GLuint shaderColorProgram = __make_program( vertexShaderColorSource, fragmentShaderColorSource );
     GLuint shaderTextureProgram = __make_program( vertexShaderTextureSource, fragmentShaderTextureSource );
+    GLuint shaderSDFProgram = __make_program( vertexShaderSDFSource, fragmentShaderSDFSource );
 
     float left = 0.f;
     float right = _width;
@@ -274,6 +329,29 @@ bool initialize_opengl( example_opengl_handle_t ** _handle, float _width, float
         glUniform1f( uScaleTextureLocation, 1.f );
     }
 
+    glUseProgram( shaderSDFProgram );
+
+    GLint wvpSDFLocation = glGetUniformLocation( shaderSDFProgram, "uWVP" );
+
+    if( wvpSDFLocation >= 0 )
+    {
+        glUniformMatrix4fv( wvpSDFLocation, 1, GL_FALSE, projOrtho );
+    }
+
+    GLint uOffsetSDFLocation = glGetUniformLocation( shaderSDFProgram, "uOffset" );
+
+    if( uOffsetSDFLocation >= 0 )
+    {
+        glUniform2f( uOffsetSDFLocation, 0.f, 0.f );
+    }
+
+    GLint uScaleSDFLocation = glGetUniformLocation( shaderSDFProgram, "uScale" );
+
+    if( uScaleSDFLocation >= 0 )
+    {
+        glUniform1f( uScaleSDFLocation, 1.f );
+    }
+
     GLuint VAO;
     glGenVertexArrays( 1, &VAO );
     glBindVertexArray( VAO );
@@ -290,6 +368,19 @@ bool initialize_opengl( example_opengl_handle_t ** _handle, float _width, float
     glVertexAttribPointer( 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof( gl_vertex_t ), (gp_uint8_t *)0 + offsetof( gl_vertex_t, c ) );
     glVertexAttribPointer( 2, 2, GL_FLOAT, GL_FALSE, sizeof( gl_vertex_t ), (gp_uint8_t *)0 + offsetof( gl_vertex_t, u ) );
 
+    glBufferData( GL_ARRAY_BUFFER, _max_vertex_count * sizeof( gl_vertex_t ), GP_NULLPTR, GL_DYNAMIC_DRAW );
+
+    GLuint SDFBO;
+    glGenBuffers( 1, &SDFBO );
+
+    glBindBuffer( GL_ARRAY_BUFFER, SDFBO );
+
+    glVertexAttribPointer( 3, 4, GL_FLOAT, GL_FALSE, sizeof( gp_sdf_t ), (gp_uint8_t *)0 + offsetof( gp_sdf_t, x ) );
+    glVertexAttribPointer( 4, 3, GL_FLOAT, GL_FALSE, sizeof( gp_sdf_t ), (gp_uint8_t *)0 + offsetof( gp_sdf_t, radius ) );
+    glVertexAttribIPointer( 5, 1, GL_UNSIGNED_INT, sizeof( gp_sdf_t ), (gp_uint8_t *)0 + offsetof( gp_sdf_t, type ) );
+
+    glBufferData( GL_ARRAY_BUFFER, _max_vertex_count * sizeof( gp_sdf_t ), GP_NULLPTR, GL_DYNAMIC_DRAW );
+
     GLuint IBO;
     glGenBuffers( 1, &IBO );
     glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, IBO );
@@ -299,7 +390,6 @@ bool initialize_opengl( example_opengl_handle_t ** _handle, float _width, float
     glEnable( GL_BLEND );
     glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
 
-    glBufferData( GL_ARRAY_BUFFER, _max_vertex_count * sizeof( gl_vertex_t ), GP_NULLPTR, GL_DYNAMIC_DRAW );
     glBufferData( GL_ELEMENT_ARRAY_BUFFER, _max_index_count * sizeof( gl_index_t ), GP_NULLPTR, GL_DYNAMIC_DRAW );
 
     example_opengl_handle_t * opengl_handle = new example_opengl_handle_t;
@@ -307,10 +397,12 @@ bool initialize_opengl( example_opengl_handle_t ** _handle, float _width, float
     opengl_handle->textureId = textureId;
     opengl_handle->VAO = VAO;
     opengl_handle->VBO = VBO;
+    opengl_handle->SDFBO = SDFBO;
     opengl_handle->IBO = IBO;
     opengl_handle->shaderCurrentProgram = shaderColorProgram;
     opengl_handle->shaderColorProgram = shaderColorProgram;
     opengl_handle->shaderTextureProgram = shaderTextureProgram;
+    opengl_handle->shaderSDFProgram = shaderSDFProgram;
 
     *_handle = opengl_handle;
 
@@ -323,10 +415,12 @@ void finalize_opengl( example_opengl_handle_t * _handle )
 
     glDeleteVertexArrays( 1, &_handle->VAO );
     glDeleteBuffers( 1, &_handle->VBO );
+    glDeleteBuffers( 1, &_handle->SDFBO );
     glDeleteBuffers( 1, &_handle->IBO );
 
     glDeleteProgram( _handle->shaderColorProgram );
     glDeleteProgram( _handle->shaderTextureProgram );
+    glDeleteProgram( _handle->shaderSDFProgram );
 }
 //////////////////////////////////////////////////////////////////////////
 void opengl_use_color_program( example_opengl_handle_t * _handle )
@@ -343,6 +437,13 @@ void opengl_use_texture_program( example_opengl_handle_t * _handle )
     glUseProgram( _handle->shaderCurrentProgram );
 }
 //////////////////////////////////////////////////////////////////////////
+void opengl_use_sdf_program( example_opengl_handle_t * _handle )
+{
+    _handle->shaderCurrentProgram = _handle->shaderSDFProgram;
+
+    glUseProgram( _handle->shaderCurrentProgram );
+}
+//////////////////////////////////////////////////////////////////////////
 void opengl_set_camera( example_opengl_handle_t * _handle, float _offsetX, float _offsetY, float _scale )
 {
     glUseProgram( _handle->shaderCurrentProgram );
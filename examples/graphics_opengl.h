@@ -22,11 +22,13 @@ typedef struct example_opengl_handle_t
 
     GLuint VAO;
     GLuint VBO;
+    GLuint SDFBO;
     GLuint IBO;
 
     GLuint shaderCurrentProgram;
     GLuint shaderColorProgram;
     GLuint shaderTextureProgram;
+    GLuint shaderSDFProgram;
 }example_opengl_handle_t;
 //////////////////////////////////////////////////////////////////////////
 bool initialize_opengl( example_opengl_handle_t ** _handle, float _width, float _height, int _max_vertex_count, int _max_index_count );
@@ -34,5 +36,6 @@ void finalize_opengl( example_opengl_handle_t * _handle );
 //////////////////////////////////////////////////////////////////////////
 void opengl_use_color_program( example_opengl_handle_t * _handle );
 void opengl_use_texture_program( example_opengl_handle_t * _handle );
+void opengl_use_sdf_program( example_opengl_handle_t * _handle );
 void opengl_set_camera( example_opengl_handle_t * _handle, float _offsetX, float _offsetY, float _scale );
 //////////////////////////////////////////////////////////////////////////
\ No newline at end of file
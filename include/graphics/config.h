@@ -19,8 +19,11 @@ typedef enum gp_boolean_e
 typedef gp_result_e gp_result_t;
 typedef uint32_t gp_bool_t;
 typedef uint8_t gp_uint8_t;
+typedef int16_t gp_int16_t;
+typedef int32_t gp_int32_t;
 typedef uint16_t gp_uint16_t;
 typedef uint32_t gp_uint32_t;
+typedef uint64_t gp_uint64_t;
 typedef size_t gp_size_t;
 
 typedef gp_uint32_t gp_argb_t;
@@ -37,6 +40,12 @@ typedef struct gp_color_t
 #define GP_DEBUG
 #endif
 
+#ifndef GP_DISABLE_VALIDATION
+#if defined(GP_DEBUG) || defined(GP_ENABLE_VALIDATION)
+#define GP_VALIDATION
+#endif
+#endif
+
 #ifndef GP_UNUSED
 #define GP_UNUSED(X) ((void)(X))
 #endif
@@ -59,16 +68,33 @@ typedef struct gp_color_t
 #define GP_COLOR_A(C) (C->a)
 #endif
 
-#ifndef GP_LINE_POINTS_MAX
-#define GP_LINE_POINTS_MAX 1024
-#endif
-
 #ifndef GP_STATE_STACK_MAX
 #define GP_STATE_STACK_MAX 8
 #endif
 
-#ifndef GP_ENABLE_EXTRA_LINE_POINTS
-#define GP_DISABLE_EXTRA_LINE_POINTS
+#ifndef GP_DASH_PATTERN_MAX
+#define GP_DASH_PATTERN_MAX 8
+#endif
+
+#ifndef GP_GRADIENT_STOP_MAX
+#define GP_GRADIENT_STOP_MAX 4
+#endif
+
+#ifndef GP_LINE_JOINT_BATCH
+#define GP_LINE_JOINT_BATCH 16
+#endif
+
+#ifndef GP_RASTER_TILE_SIZE
+#define GP_RASTER_TILE_SIZE 64
+#endif
+
+#ifndef GP_DISABLE_SSE
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define GP_ENABLE_SSE
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GP_ENABLE_SSE2
+#endif
 #endif
 
 #ifndef GP_MATH_SQRTF
@@ -86,4 +112,19 @@ typedef struct gp_color_t
 #define GP_MATH_SINF (sinf)
 #endif
 
+#ifndef GP_MATH_FLOORF
+#include <math.h>
+#define GP_MATH_FLOORF (floorf)
+#endif
+
+#ifndef GP_MATH_ATAN2F
+#include <math.h>
+#define GP_MATH_ATAN2F (atan2f)
+#endif
+
+#ifndef GP_MATH_POWF
+#include <math.h>
+#define GP_MATH_POWF (powf)
+#endif
+
 #endif
\ No newline at end of file
@@ -12,6 +12,21 @@ typedef struct gp_canvas_t gp_canvas_t;
 typedef void * (*gp_malloc_t)(gp_size_t _size, void * _ud);
 typedef void * (*gp_realloc_t)(void * _ptr, gp_size_t _size, void * _ud);
 typedef void (*gp_free_t)(void * _ptr, void * _ud);
+typedef void (*gp_validation_t)(const char * _message, void * _ud);
+
+typedef enum gp_line_join_e
+{
+    GP_LINE_JOIN_MITER,
+    GP_LINE_JOIN_BEVEL,
+    GP_LINE_JOIN_ROUND
+} gp_line_join_e;
+
+typedef enum gp_gradient_e
+{
+    GP_GRADIENT_NONE,
+    GP_GRADIENT_LINEAR,
+    GP_GRADIENT_RADIAL
+} gp_gradient_e;
 
 /*************************************************************************
 *
@@ -21,6 +36,16 @@ gp_result_t gp_canvas_create( gp_canvas_t ** _canvas, gp_malloc_t _malloc, gp_re
 gp_result_t gp_canvas_destroy( gp_canvas_t * _canvas );
 gp_result_t gp_canvas_clear( gp_canvas_t * _canvas );
 
+gp_result_t gp_canvas_get_hash( const gp_canvas_t * _canvas, gp_uint64_t * _hash );
+
+gp_result_t gp_canvas_snapshot( gp_canvas_t * _canvas, const gp_canvas_t ** _snapshot );
+gp_result_t gp_canvas_snapshot_release( const gp_canvas_t * _snapshot );
+
+gp_result_t gp_canvas_save_to_memory( const gp_canvas_t * _canvas, void * _buffer, gp_size_t _capacity, gp_size_t * _size );
+gp_result_t gp_canvas_load_from_memory( gp_canvas_t * _canvas, const void * _buffer, gp_size_t _size );
+
+gp_result_t gp_canvas_set_validation( gp_canvas_t * _canvas, gp_validation_t _validation, void * _ud );
+
 /*************************************************************************
 *
 *************************************************************************/
@@ -28,6 +53,7 @@ gp_result_t gp_canvas_clear( gp_canvas_t * _canvas );
 float gp_get_default_thickness( void );
 float gp_get_default_penumbra( void );
 float gp_get_default_outline_width( void );
+float gp_get_default_miter_limit( void );
 gp_uint8_t gp_get_default_curve_quality( void );
 gp_uint8_t gp_get_default_ellipse_quality( void );
 gp_uint8_t gp_get_default_rect_quality( void );
@@ -45,12 +71,26 @@ gp_result_t gp_get_penumbra( const gp_canvas_t * _canvas, float * _penumbra );
 gp_result_t gp_set_outline_width( gp_canvas_t * _canvas, float _width );
 gp_result_t gp_get_outline_width( const gp_canvas_t * _canvas, float * _width );
 
+gp_result_t gp_set_line_join( gp_canvas_t * _canvas, gp_line_join_e _join );
+gp_result_t gp_get_line_join( const gp_canvas_t * _canvas, gp_line_join_e * _join );
+
+gp_result_t gp_set_miter_limit( gp_canvas_t * _canvas, float _limit );
+gp_result_t gp_get_miter_limit( const gp_canvas_t * _canvas, float * _limit );
+
+gp_result_t gp_set_dash( gp_canvas_t * _canvas, const float * _pattern, gp_uint32_t _count, float _offset );
+gp_result_t gp_get_dash( const gp_canvas_t * _canvas, float * _pattern, gp_uint32_t * _count, float * _offset );
+
 gp_result_t gp_set_outline_color( gp_canvas_t * _canvas, float _r, float _g, float _b, float _a );
 gp_result_t gp_get_outline_color( const gp_canvas_t * _canvas, gp_color_t * _color );
 
 gp_result_t gp_set_color( gp_canvas_t * _canvas, float _r, float _g, float _b, float _a );
 gp_result_t gp_get_color( const gp_canvas_t * _canvas, gp_color_t * _color );
 
+gp_result_t gp_set_linear_gradient( gp_canvas_t * _canvas, float _x0, float _y0, float _x1, float _y1, const float * _stops, gp_uint32_t _count );
+gp_result_t gp_set_radial_gradient( gp_canvas_t * _canvas, float _x, float _y, float _radius, const float * _stops, gp_uint32_t _count );
+gp_result_t gp_clear_gradient( gp_canvas_t * _canvas );
+gp_result_t gp_get_gradient( const gp_canvas_t * _canvas, gp_gradient_e * _gradient, float * _stops, gp_uint32_t * _count );
+
 gp_result_t gp_set_uv_offset( gp_canvas_t * _canvas, float _ou, float _ov, float _su, float _sv );
 gp_result_t gp_get_uv_offset( const gp_canvas_t * _canvas, float * _ou, float * _ov, float * _su, float * _sv );
 
@@ -63,6 +103,15 @@ gp_result_t gp_get_ellipse_quality( const gp_canvas_t * _canvas, gp_uint8_t * _q
 gp_result_t gp_set_rect_quality( gp_canvas_t * _canvas, gp_uint8_t _quality );
 gp_result_t gp_get_rect_quality( const gp_canvas_t * _canvas, gp_uint8_t * _quality );
 
+gp_result_t gp_set_sdf( gp_canvas_t * _canvas, gp_bool_t _sdf );
+gp_result_t gp_get_sdf( const gp_canvas_t * _canvas, gp_bool_t * _sdf );
+
+gp_result_t gp_set_material( gp_canvas_t * _canvas, gp_uint32_t _material );
+gp_result_t gp_get_material( const gp_canvas_t * _canvas, gp_uint32_t * _material );
+
+gp_result_t gp_set_blend( gp_canvas_t * _canvas, gp_bool_t _blend );
+gp_result_t gp_get_blend( const gp_canvas_t * _canvas, gp_bool_t * _blend );
+
 gp_result_t gp_begin_fill( gp_canvas_t * _canvas );
 gp_result_t gp_end_fill( gp_canvas_t * _canvas );
 
@@ -80,38 +129,204 @@ gp_result_t gp_bezier_curve_to( gp_canvas_t * _canvas, float _p0x, float _p0y, f
 
 gp_result_t gp_rect( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height );
 gp_result_t gp_rounded_rect( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _radius );
+gp_result_t gp_rounded_rect_corners( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _top_left, float _top_right, float _bottom_right, float _bottom_left );
 gp_result_t gp_circle( gp_canvas_t * _canvas, float _x, float _y, float _radius );
 gp_result_t gp_ellipse( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height );
+gp_result_t gp_arc( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _start, float _sweep );
+gp_result_t gp_arc_to( gp_canvas_t * _canvas, float _rx, float _ry, float _rotation, gp_bool_t _large_arc, gp_bool_t _sweep, float _x, float _y );
+
+gp_result_t gp_polyline( gp_canvas_t * _canvas, const float * _points, gp_uint32_t _point_count );
+gp_result_t gp_rects( gp_canvas_t * _canvas, const float * _rects, gp_uint32_t _count );
+gp_result_t gp_rounded_rects( gp_canvas_t * _canvas, const float * _rounded_rects, gp_uint32_t _count );
+gp_result_t gp_circles( gp_canvas_t * _canvas, const float * _circles, gp_uint32_t _count );
+gp_result_t gp_ellipses( gp_canvas_t * _canvas, const float * _ellipses, gp_uint32_t _count );
 
 /*************************************************************************
 *
 *************************************************************************/
 
+typedef enum gp_shape_type_e
+{
+    GP_SHAPE_TYPE_LINE,
+    GP_SHAPE_TYPE_RECT,
+    GP_SHAPE_TYPE_ROUNDED_RECT,
+    GP_SHAPE_TYPE_ELLIPSE
+} gp_shape_type_e;
+
+typedef struct gp_shape_t
+{
+    gp_shape_type_e type;
+    gp_uint32_t index;
+} gp_shape_t;
+
+gp_result_t gp_canvas_build_index( gp_canvas_t * _canvas );
+gp_result_t gp_canvas_pick( const gp_canvas_t * _canvas, float _x, float _y, gp_shape_t * _shape, gp_bool_t * _found );
+gp_result_t gp_canvas_query_rect( const gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, gp_shape_t * _shapes, gp_uint32_t _capacity, gp_uint32_t * _count );
+
+typedef struct gp_dirty_rect_t
+{
+    float x;
+    float y;
+    float width;
+    float height;
+} gp_dirty_rect_t;
+
+gp_result_t gp_canvas_capture_frame( gp_canvas_t * _canvas );
+gp_result_t gp_canvas_get_dirty_rects( const gp_canvas_t * _canvas, gp_dirty_rect_t * _rects, gp_uint32_t _capacity, gp_uint32_t * _count );
+
+typedef gp_uint32_t gp_shape_handle_t;
+
+gp_result_t gp_shape_retain( gp_canvas_t * _canvas, gp_shape_type_e _type, gp_shape_handle_t * _handle );
+gp_result_t gp_shape_remove( gp_canvas_t * _canvas, gp_shape_handle_t _handle );
+gp_result_t gp_shape_set_position( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _x, float _y );
+gp_result_t gp_shape_set_size( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _width, float _height );
+gp_result_t gp_shape_set_color( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _r, float _g, float _b, float _a );
+
+/*************************************************************************
+*
+*************************************************************************/
+
+typedef enum gp_sdf_type_e
+{
+    GP_SDF_TYPE_NONE,
+    GP_SDF_TYPE_ELLIPSE_STROKE,
+    GP_SDF_TYPE_ELLIPSE_FILL,
+    GP_SDF_TYPE_ROUNDED_RECT_STROKE,
+    GP_SDF_TYPE_ROUNDED_RECT_FILL
+} gp_sdf_type_e;
+
+typedef struct gp_sdf_t
+{
+    float x;
+    float y;
+    float width;
+    float height;
+    float radius;
+    float thickness;
+    float penumbra;
+    gp_uint32_t type;
+} gp_sdf_t;
+
+typedef enum gp_position_format_e
+{
+    GP_POSITION_FORMAT_FLOAT2,
+    GP_POSITION_FORMAT_SHORT2
+} gp_position_format_e;
+
+typedef enum gp_uv_format_e
+{
+    GP_UV_FORMAT_FLOAT2,
+    GP_UV_FORMAT_UNORM16,
+    GP_UV_FORMAT_HALF2
+} gp_uv_format_e;
+
+typedef enum gp_color_format_e
+{
+    GP_COLOR_FORMAT_ARGB,
+    GP_COLOR_FORMAT_ABGR,
+    GP_COLOR_FORMAT_RGBA
+} gp_color_format_e;
+
+typedef struct gp_draw_range_t
+{
+    gp_uint16_t first;
+    gp_uint16_t count;
+    gp_uint16_t opaque_count;
+    gp_uint32_t material;
+    gp_bool_t blend;
+} gp_draw_range_t;
+
 typedef struct gp_mesh_t
 {
     gp_uint16_t vertex_count;
     gp_uint16_t index_count;
+    gp_uint32_t range_count;
 
     gp_color_t color;
 
     void * positions_buffer;
     gp_size_t positions_offset;
     gp_size_t positions_stride;
+    gp_position_format_e positions_format;
+    float positions_origin_x;
+    float positions_origin_y;
+    float positions_scale;
 
     void * colors_buffer;
     gp_size_t colors_offset;
     gp_size_t colors_stride;
+    gp_color_format_e colors_format;
+    gp_bool_t colors_premultiplied;
 
     void * uv_buffer;
     gp_size_t uv_offset;
     gp_size_t uv_stride;
+    gp_uv_format_e uv_format;
 
     void * indices_buffer;
     gp_size_t indices_offset;
     gp_size_t indices_stride;
+
+    void * sdf_buffer;
+    gp_size_t sdf_offset;
+    gp_size_t sdf_stride;
+
+    void * depth_buffer;
+    gp_size_t depth_offset;
+    gp_size_t depth_stride;
+
+    gp_draw_range_t * ranges_buffer;
 } gp_mesh_t;
 
 gp_result_t gp_calculate_mesh_size( const gp_canvas_t * _canvas, gp_mesh_t * _mesh );
 gp_result_t gp_render( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh );
+gp_result_t gp_render_split( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _opaque_index_count );
+gp_result_t gp_reorder_ranges( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint32_t * _range_count );
+
+/*************************************************************************
+*
+*************************************************************************/
+
+typedef gp_result_t (*gp_mesh_cache_read_t)(gp_uint64_t _hash, const void ** _blob, gp_size_t * _size, void * _ud);
+typedef gp_result_t (*gp_mesh_cache_write_t)(gp_uint64_t _hash, const void * _blob, gp_size_t _size, void * _ud);
+
+typedef struct gp_mesh_cache_t
+{
+    gp_mesh_cache_read_t read;
+    gp_mesh_cache_write_t write;
+
+    void * ud;
+} gp_mesh_cache_t;
+
+gp_result_t gp_calculate_mesh_hash( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint64_t * _hash );
+gp_result_t gp_calculate_mesh_blob_size( const gp_mesh_t * _mesh, gp_size_t * _size );
+gp_result_t gp_render_cached( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, const gp_mesh_cache_t * _cache );
+
+/*************************************************************************
+*
+*************************************************************************/
+
+typedef struct gp_raster_t gp_raster_t;
+
+typedef enum gp_raster_blend_e
+{
+    GP_RASTER_BLEND_LINEAR,
+    GP_RASTER_BLEND_SRGB
+} gp_raster_blend_e;
+
+typedef struct gp_image_t
+{
+    void * pixels;
+    gp_uint32_t width;
+    gp_uint32_t height;
+    gp_size_t pitch;
+} gp_image_t;
+
+gp_result_t gp_raster_create( gp_raster_t ** _raster, gp_malloc_t _malloc, gp_realloc_t _realloc, gp_free_t _free, void * _ud );
+gp_result_t gp_raster_destroy( gp_raster_t * _raster );
+
+gp_result_t gp_raster_bin( gp_raster_t * _raster, const gp_mesh_t * _mesh, const gp_image_t * _target, const gp_image_t * _texture, gp_raster_blend_e _blend, gp_uint32_t * _tile_count );
+gp_result_t gp_raster_tile( const gp_raster_t * _raster, gp_uint32_t _tile );
+gp_result_t gp_raster_tiles( const gp_raster_t * _raster );
 
 #endif
\ No newline at end of file
@@ -5,4 +5,340 @@ extern "C" {
 #include "graphics.h"
 }
 
-#endif
\ No newline at end of file
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+
+#include <memory_resource>
+#include <vector>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstring>
+
+#define GP_ATTRIBUTE(Type, Member) gp::attribute<&Type::Member, offsetof(Type, Member)>
+
+namespace gp
+{
+    namespace detail
+    {
+        //////////////////////////////////////////////////////////////////////////
+        struct allocation_header_t
+        {
+            alignas(std::max_align_t) std::size_t size;
+        };
+        //////////////////////////////////////////////////////////////////////////
+        inline void * resource_malloc( gp_size_t _size, void * _ud )
+        {
+            std::pmr::memory_resource * resource = static_cast<std::pmr::memory_resource *>(_ud);
+
+            void * memory = resource->allocate( sizeof( allocation_header_t ) + _size, alignof( allocation_header_t ) );
+
+            allocation_header_t * header = static_cast<allocation_header_t *>(memory);
+            header->size = _size;
+
+            return header + 1;
+        }
+        //////////////////////////////////////////////////////////////////////////
+        inline void resource_free( void * _ptr, void * _ud )
+        {
+            if( _ptr == nullptr )
+            {
+                return;
+            }
+
+            std::pmr::memory_resource * resource = static_cast<std::pmr::memory_resource *>(_ud);
+
+            allocation_header_t * header = static_cast<allocation_header_t *>(_ptr) - 1;
+
+            resource->deallocate( header, sizeof( allocation_header_t ) + header->size, alignof( allocation_header_t ) );
+        }
+        //////////////////////////////////////////////////////////////////////////
+        inline void * resource_realloc( void * _ptr, gp_size_t _size, void * _ud )
+        {
+            if( _ptr == nullptr )
+            {
+                return resource_malloc( _size, _ud );
+            }
+
+            const allocation_header_t * header = static_cast<const allocation_header_t *>(_ptr) - 1;
+
+            void * memory = resource_malloc( _size, _ud );
+
+            std::memcpy( memory, _ptr, header->size < _size ? header->size : _size );
+
+            resource_free( _ptr, _ud );
+
+            return memory;
+        }
+        //////////////////////////////////////////////////////////////////////////
+        template<class M>
+        struct member_traits;
+        //////////////////////////////////////////////////////////////////////////
+        template<class T, class M>
+        struct member_traits<M T::*>
+        {
+            typedef T class_type;
+            typedef M member_type;
+        };
+        //////////////////////////////////////////////////////////////////////////
+        template<class Attribute>
+        using member_type_t = std::remove_all_extents_t<typename member_traits<typename Attribute::member_pointer>::member_type>;
+        //////////////////////////////////////////////////////////////////////////
+        template<class Attribute>
+        using member_class_t = typename member_traits<typename Attribute::member_pointer>::class_type;
+        //////////////////////////////////////////////////////////////////////////
+        template<class Attribute>
+        constexpr bool is_attribute_v = std::is_void_v<Attribute> == false;
+        //////////////////////////////////////////////////////////////////////////
+        template<class M>
+        constexpr gp_position_format_e position_format() noexcept
+        {
+            static_assert(std::is_same_v<M, float> || std::is_same_v<M, gp_int16_t>, "position member must be float or gp_int16_t, x followed by y");
+
+            return std::is_same_v<M, float> ? GP_POSITION_FORMAT_FLOAT2 : GP_POSITION_FORMAT_SHORT2;
+        }
+        //////////////////////////////////////////////////////////////////////////
+        template<class M>
+        constexpr gp_uv_format_e uv_format() noexcept
+        {
+            static_assert(std::is_same_v<M, float> || std::is_same_v<M, gp_uint16_t>, "uv member must be float or gp_uint16_t, u followed by v");
+
+            return std::is_same_v<M, float> ? GP_UV_FORMAT_FLOAT2 : GP_UV_FORMAT_UNORM16;
+        }
+    }
+    //////////////////////////////////////////////////////////////////////////
+    template<auto Member, std::size_t Offset>
+    struct attribute
+    {
+        typedef decltype(Member) member_pointer;
+
+        static constexpr std::size_t offset = Offset;
+    };
+    //////////////////////////////////////////////////////////////////////////
+    class canvas
+    {
+    public:
+        explicit canvas( std::pmr::memory_resource * _resource = std::pmr::get_default_resource() ) noexcept
+            : m_resource( _resource )
+            , m_canvas( nullptr )
+        {
+            if( gp_canvas_create( &m_canvas, &detail::resource_malloc, &detail::resource_realloc, &detail::resource_free, m_resource ) == GP_FAILURE )
+            {
+                m_canvas = nullptr;
+            }
+        }
+
+        ~canvas()
+        {
+            if( m_canvas != nullptr )
+            {
+                gp_canvas_destroy( m_canvas );
+            }
+        }
+
+        canvas( const canvas & ) = delete;
+        canvas & operator = ( const canvas & ) = delete;
+
+        canvas( canvas && _other ) noexcept
+            : m_resource( _other.m_resource )
+            , m_canvas( std::exchange( _other.m_canvas, nullptr ) )
+        {
+        }
+
+        canvas & operator = ( canvas && _other ) noexcept
+        {
+            std::swap( m_resource, _other.m_resource );
+            std::swap( m_canvas, _other.m_canvas );
+
+            return *this;
+        }
+
+    public:
+        bool valid() const noexcept
+        {
+            return m_canvas != nullptr;
+        }
+
+        gp_canvas_t * get() noexcept
+        {
+            return m_canvas;
+        }
+
+        const gp_canvas_t * get() const noexcept
+        {
+            return m_canvas;
+        }
+
+        operator gp_canvas_t * () noexcept
+        {
+            return m_canvas;
+        }
+
+        operator const gp_canvas_t * () const noexcept
+        {
+            return m_canvas;
+        }
+
+        std::pmr::memory_resource * resource() const noexcept
+        {
+            return m_resource;
+        }
+
+    public:
+        gp_result_t clear() noexcept
+        {
+            return gp_canvas_clear( m_canvas );
+        }
+
+    protected:
+        std::pmr::memory_resource * m_resource;
+        gp_canvas_t * m_canvas;
+    };
+    //////////////////////////////////////////////////////////////////////////
+    template<class Position, class Color = void, class UV = void>
+    class mesh
+    {
+    public:
+        typedef detail::member_class_t<Position> vertex_type;
+        typedef gp_uint16_t index_type;
+
+        static_assert(std::is_standard_layout_v<vertex_type> && std::is_trivially_copyable_v<vertex_type>, "vertex type must be a standard layout, trivially copyable struct");
+
+    public:
+        explicit mesh( std::pmr::memory_resource * _resource = std::pmr::get_default_resource() )
+            : m_vertices( _resource )
+            , m_indices( _resource )
+        {
+            m_color.r = 1.f;
+            m_color.g = 1.f;
+            m_color.b = 1.f;
+            m_color.a = 1.f;
+
+            m_colors_format = GP_COLOR_FORMAT_ARGB;
+            m_colors_premultiplied = GP_FALSE;
+
+            m_positions_origin_x = 0.f;
+            m_positions_origin_y = 0.f;
+            m_positions_scale = 1.f;
+
+            m_uv_format = GP_UV_FORMAT_FLOAT2;
+
+            if constexpr( detail::is_attribute_v<UV> == true )
+            {
+                m_uv_format = detail::uv_format<detail::member_type_t<UV>>();
+            }
+        }
+
+    public:
+        void set_color( const gp_color_t & _color ) noexcept
+        {
+            m_color = _color;
+        }
+
+        void set_colors_format( gp_color_format_e _format, gp_bool_t _premultiplied ) noexcept
+        {
+            m_colors_format = _format;
+            m_colors_premultiplied = _premultiplied;
+        }
+
+        void set_positions_quantization( float _origin_x, float _origin_y, float _scale ) noexcept
+        {
+            m_positions_origin_x = _origin_x;
+            m_positions_origin_y = _origin_y;
+            m_positions_scale = _scale;
+        }
+
+        void set_uv_format( gp_uv_format_e _format ) noexcept
+        {
+            m_uv_format = _format;
+        }
+
+    public:
+        gp_result_t render( const gp_canvas_t * _canvas )
+        {
+            gp_mesh_t desc;
+
+            if( gp_calculate_mesh_size( _canvas, &desc ) == GP_FAILURE )
+            {
+                return GP_FAILURE;
+            }
+
+            m_vertices.resize( desc.vertex_count );
+            m_indices.resize( desc.index_count );
+
+            vertex_type * vertices = m_vertices.data();
+
+            desc.color = m_color;
+
+            desc.positions_buffer = vertices;
+            desc.positions_offset = Position::offset;
+            desc.positions_stride = sizeof( vertex_type );
+            desc.positions_format = detail::position_format<detail::member_type_t<Position>>();
+            desc.positions_origin_x = m_positions_origin_x;
+            desc.positions_origin_y = m_positions_origin_y;
+            desc.positions_scale = m_positions_scale;
+
+            if constexpr( detail::is_attribute_v<Color> == true )
+            {
+                static_assert(std::is_same_v<detail::member_class_t<Color>, vertex_type>, "color member must belong to the position vertex type");
+                static_assert(std::is_same_v<detail::member_type_t<Color>, gp_argb_t>, "color member must be gp_argb_t");
+
+                desc.colors_buffer = vertices;
+                desc.colors_offset = Color::offset;
+                desc.colors_stride = sizeof( vertex_type );
+                desc.colors_format = m_colors_format;
+                desc.colors_premultiplied = m_colors_premultiplied;
+            }
+
+            if constexpr( detail::is_attribute_v<UV> == true )
+            {
+                static_assert(std::is_same_v<detail::member_class_t<UV>, vertex_type>, "uv member must belong to the position vertex type");
+
+                desc.uv_buffer = vertices;
+                desc.uv_offset = UV::offset;
+                desc.uv_stride = sizeof( vertex_type );
+                desc.uv_format = m_uv_format;
+            }
+
+            desc.indices_buffer = m_indices.data();
+            desc.indices_offset = 0;
+            desc.indices_stride = sizeof( index_type );
+
+            if( gp_render( _canvas, &desc ) == GP_FAILURE )
+            {
+                return GP_FAILURE;
+            }
+
+            return GP_SUCCESSFUL;
+        }
+
+    public:
+        const std::pmr::vector<vertex_type> & vertices() const noexcept
+        {
+            return m_vertices;
+        }
+
+        const std::pmr::vector<index_type> & indices() const noexcept
+        {
+            return m_indices;
+        }
+
+    protected:
+        std::pmr::vector<vertex_type> m_vertices;
+        std::pmr::vector<index_type> m_indices;
+
+        gp_color_t m_color;
+
+        gp_color_format_e m_colors_format;
+        gp_bool_t m_colors_premultiplied;
+
+        float m_positions_origin_x;
+        float m_positions_origin_y;
+        float m_positions_scale;
+
+        gp_uv_format_e m_uv_format;
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+/*************************************************************************
+* graphics recording ABI for foreign function interfaces
+*
+* Plain declarations only, no preprocessor, so the file can be handed to
+* LuaJIT as is: ffi.cdef( io.open( "graphics_ffi.h" ):read( "*a" ) ).
+* Only opaque handles, fixed width scalars and flat float arrays cross the
+* boundary. C translation units include <stdint.h> and <stddef.h> first and
+* must not include graphics.h alongside it.
+*************************************************************************/
+
+typedef struct gp_canvas_t gp_canvas_t;
+
+typedef enum gp_result_e
+{
+    GP_SUCCESSFUL,
+    GP_FAILURE
+} gp_result_t;
+
+typedef enum gp_line_join_e
+{
+    GP_LINE_JOIN_MITER,
+    GP_LINE_JOIN_BEVEL,
+    GP_LINE_JOIN_ROUND
+} gp_line_join_e;
+
+typedef enum gp_gradient_e
+{
+    GP_GRADIENT_NONE,
+    GP_GRADIENT_LINEAR,
+    GP_GRADIENT_RADIAL
+} gp_gradient_e;
+
+typedef enum gp_shape_type_e
+{
+    GP_SHAPE_TYPE_LINE,
+    GP_SHAPE_TYPE_RECT,
+    GP_SHAPE_TYPE_ROUNDED_RECT,
+    GP_SHAPE_TYPE_ELLIPSE
+} gp_shape_type_e;
+
+typedef uint32_t gp_shape_handle_t;
+
+typedef void * (*gp_malloc_t)(size_t _size, void * _ud);
+typedef void * (*gp_realloc_t)(void * _ptr, size_t _size, void * _ud);
+typedef void (*gp_free_t)(void * _ptr, void * _ud);
+
+gp_result_t gp_canvas_create( gp_canvas_t ** _canvas, gp_malloc_t _malloc, gp_realloc_t _realloc, gp_free_t _free, void * _ud );
+gp_result_t gp_canvas_destroy( gp_canvas_t * _canvas );
+gp_result_t gp_canvas_clear( gp_canvas_t * _canvas );
+gp_result_t gp_canvas_get_hash( const gp_canvas_t * _canvas, uint64_t * _hash );
+
+gp_result_t gp_set_thickness( gp_canvas_t * _canvas, float _thickness );
+gp_result_t gp_set_penumbra( gp_canvas_t * _canvas, float _penumbra );
+gp_result_t gp_set_outline_width( gp_canvas_t * _canvas, float _width );
+gp_result_t gp_set_line_join( gp_canvas_t * _canvas, gp_line_join_e _join );
+gp_result_t gp_set_miter_limit( gp_canvas_t * _canvas, float _limit );
+gp_result_t gp_set_dash( gp_canvas_t * _canvas, const float * _pattern, uint32_t _count, float _offset );
+gp_result_t gp_set_outline_color( gp_canvas_t * _canvas, float _r, float _g, float _b, float _a );
+gp_result_t gp_set_color( gp_canvas_t * _canvas, float _r, float _g, float _b, float _a );
+gp_result_t gp_set_linear_gradient( gp_canvas_t * _canvas, float _x0, float _y0, float _x1, float _y1, const float * _stops, uint32_t _count );
+gp_result_t gp_set_radial_gradient( gp_canvas_t * _canvas, float _x, float _y, float _radius, const float * _stops, uint32_t _count );
+gp_result_t gp_clear_gradient( gp_canvas_t * _canvas );
+gp_result_t gp_set_uv_offset( gp_canvas_t * _canvas, float _ou, float _ov, float _su, float _sv );
+gp_result_t gp_set_curve_quality( gp_canvas_t * _canvas, uint8_t _quality );
+gp_result_t gp_set_ellipse_quality( gp_canvas_t * _canvas, uint8_t _quality );
+gp_result_t gp_set_rect_quality( gp_canvas_t * _canvas, uint8_t _quality );
+gp_result_t gp_set_sdf( gp_canvas_t * _canvas, uint32_t _sdf );
+gp_result_t gp_set_material( gp_canvas_t * _canvas, uint32_t _material );
+gp_result_t gp_set_blend( gp_canvas_t * _canvas, uint32_t _blend );
+
+gp_result_t gp_begin_fill( gp_canvas_t * _canvas );
+gp_result_t gp_end_fill( gp_canvas_t * _canvas );
+
+gp_result_t gp_push_state( gp_canvas_t * _canvas );
+gp_result_t gp_pop_state( gp_canvas_t * _canvas );
+
+gp_result_t gp_move_to( gp_canvas_t * _canvas, float _x, float _y );
+gp_result_t gp_line_to( gp_canvas_t * _canvas, float _x, float _y );
+gp_result_t gp_quadratic_curve_to( gp_canvas_t * _canvas, float _p0x, float _p0y, float _x, float _y );
+gp_result_t gp_bezier_curve_to( gp_canvas_t * _canvas, float _p0x, float _p0y, float _p1x, float _p1y, float _x, float _y );
+
+gp_result_t gp_rect( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height );
+gp_result_t gp_rounded_rect( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _radius );
+gp_result_t gp_rounded_rect_corners( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _top_left, float _top_right, float _bottom_right, float _bottom_left );
+gp_result_t gp_circle( gp_canvas_t * _canvas, float _x, float _y, float _radius );
+gp_result_t gp_ellipse( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height );
+gp_result_t gp_arc( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _start, float _sweep );
+gp_result_t gp_arc_to( gp_canvas_t * _canvas, float _rx, float _ry, float _rotation, uint32_t _large_arc, uint32_t _sweep, float _x, float _y );
+
+gp_result_t gp_polyline( gp_canvas_t * _canvas, const float * _points, uint32_t _point_count );
+gp_result_t gp_rects( gp_canvas_t * _canvas, const float * _rects, uint32_t _count );
+gp_result_t gp_rounded_rects( gp_canvas_t * _canvas, const float * _rounded_rects, uint32_t _count );
+gp_result_t gp_circles( gp_canvas_t * _canvas, const float * _circles, uint32_t _count );
+gp_result_t gp_ellipses( gp_canvas_t * _canvas, const float * _ellipses, uint32_t _count );
+
+gp_result_t gp_shape_retain( gp_canvas_t * _canvas, gp_shape_type_e _type, gp_shape_handle_t * _handle );
+gp_result_t gp_shape_remove( gp_canvas_t * _canvas, gp_shape_handle_t _handle );
+gp_result_t gp_shape_set_position( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _x, float _y );
+gp_result_t gp_shape_set_size( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _width, float _height );
+gp_result_t gp_shape_set_color( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _r, float _g, float _b, float _a );
@@ -0,0 +1,288 @@
+#include "graphics/graphics.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "hash.h"
+
+//////////////////////////////////////////////////////////////////////////
+#define GP_MESH_CACHE_VERSION (2U)
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t __hash_mesh( gp_uint64_t _hash, const gp_mesh_t * _mesh )
+{
+    gp_uint64_t hash = _hash;
+
+    hash = gp_hash_u32( hash, GP_MESH_CACHE_VERSION );
+
+    hash = gp_hash_u32( hash, _mesh->vertex_count );
+    hash = gp_hash_u32( hash, _mesh->index_count );
+
+    hash = gp_hash_f32( hash, _mesh->color.r );
+    hash = gp_hash_f32( hash, _mesh->color.g );
+    hash = gp_hash_f32( hash, _mesh->color.b );
+    hash = gp_hash_f32( hash, _mesh->color.a );
+
+    if( _mesh->positions_buffer != GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, 1 );
+        hash = gp_hash_u32( hash, _mesh->positions_format );
+
+        if( _mesh->positions_format == GP_POSITION_FORMAT_SHORT2 )
+        {
+            hash = gp_hash_f32( hash, _mesh->positions_origin_x );
+            hash = gp_hash_f32( hash, _mesh->positions_origin_y );
+            hash = gp_hash_f32( hash, _mesh->positions_scale );
+        }
+    }
+
+    if( _mesh->colors_buffer != GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, 2 );
+        hash = gp_hash_u32( hash, _mesh->colors_format );
+        hash = gp_hash_u32( hash, _mesh->colors_premultiplied );
+    }
+
+    if( _mesh->uv_buffer != GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, 3 );
+        hash = gp_hash_u32( hash, _mesh->uv_format );
+    }
+
+    if( _mesh->sdf_buffer != GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, 4 );
+    }
+
+    if( _mesh->indices_buffer != GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, 5 );
+    }
+
+    if( _mesh->depth_buffer != GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, 6 );
+    }
+
+    if( _mesh->ranges_buffer != GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, 7 );
+        hash = gp_hash_u32( hash, _mesh->range_count );
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_calculate_mesh_hash( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint64_t * _hash )
+{
+    gp_uint64_t hash;
+    GP_CALL( gp_canvas_get_hash, (_canvas, &hash) );
+
+    hash = __hash_mesh( hash, _mesh );
+
+    *_hash = hash;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_position_size( const gp_mesh_t * _mesh )
+{
+    if( _mesh->positions_buffer == GP_NULLPTR )
+    {
+        return 0;
+    }
+
+    switch( _mesh->positions_format )
+    {
+    case GP_POSITION_FORMAT_SHORT2:
+        return sizeof( gp_int16_t ) * 2;
+    default:
+        return sizeof( float ) * 2;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_color_size( const gp_mesh_t * _mesh )
+{
+    if( _mesh->colors_buffer == GP_NULLPTR )
+    {
+        return 0;
+    }
+
+    return sizeof( gp_argb_t );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_uv_size( const gp_mesh_t * _mesh )
+{
+    if( _mesh->uv_buffer == GP_NULLPTR )
+    {
+        return 0;
+    }
+
+    switch( _mesh->uv_format )
+    {
+    case GP_UV_FORMAT_UNORM16:
+    case GP_UV_FORMAT_HALF2:
+        return sizeof( gp_uint16_t ) * 2;
+    default:
+        return sizeof( float ) * 2;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_sdf_size( const gp_mesh_t * _mesh )
+{
+    if( _mesh->sdf_buffer == GP_NULLPTR )
+    {
+        return 0;
+    }
+
+    return sizeof( gp_sdf_t );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_depth_size( const gp_mesh_t * _mesh )
+{
+    if( _mesh->depth_buffer == GP_NULLPTR )
+    {
+        return 0;
+    }
+
+    return sizeof( float );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_index_size( const gp_mesh_t * _mesh )
+{
+    if( _mesh->indices_buffer == GP_NULLPTR )
+    {
+        return 0;
+    }
+
+    return sizeof( gp_uint16_t );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_range_size( const gp_mesh_t * _mesh )
+{
+    if( _mesh->ranges_buffer == GP_NULLPTR )
+    {
+        return 0;
+    }
+
+    return sizeof( gp_draw_range_t );
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_calculate_mesh_blob_size( const gp_mesh_t * _mesh, gp_size_t * _size )
+{
+    gp_size_t vertex_size = __get_position_size( _mesh ) + __get_color_size( _mesh ) + __get_uv_size( _mesh ) + __get_sdf_size( _mesh ) + __get_depth_size( _mesh );
+    gp_size_t index_size = __get_index_size( _mesh );
+
+    gp_size_t range_size = __get_range_size( _mesh );
+
+    *_size = vertex_size * _mesh->vertex_count + index_size * _mesh->index_count + range_size * _mesh->range_count;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint8_t * __blob_gather( gp_uint8_t * _blob, const void * _buffer, gp_size_t _offset, gp_size_t _stride, gp_size_t _size, gp_uint32_t _count )
+{
+    if( _buffer == GP_NULLPTR )
+    {
+        return _blob;
+    }
+
+    gp_uint8_t * blob = _blob;
+    const gp_uint8_t * buffer = (const gp_uint8_t *)_buffer + _offset;
+
+    for( gp_uint32_t index = 0; index != _count; ++index, buffer += _stride )
+    {
+        for( gp_size_t byte = 0; byte != _size; ++byte )
+        {
+            *blob++ = buffer[byte];
+        }
+    }
+
+    return blob;
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_uint8_t * __blob_scatter( const gp_uint8_t * _blob, void * _buffer, gp_size_t _offset, gp_size_t _stride, gp_size_t _size, gp_uint32_t _count )
+{
+    if( _buffer == GP_NULLPTR )
+    {
+        return _blob;
+    }
+
+    const gp_uint8_t * blob = _blob;
+    gp_uint8_t * buffer = (gp_uint8_t *)_buffer + _offset;
+
+    for( gp_uint32_t index = 0; index != _count; ++index, buffer += _stride )
+    {
+        for( gp_size_t byte = 0; byte != _size; ++byte )
+        {
+            buffer[byte] = *blob++;
+        }
+    }
+
+    return blob;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __mesh_gather( const gp_mesh_t * _mesh, gp_uint8_t * _blob )
+{
+    gp_uint8_t * blob = _blob;
+
+    blob = __blob_gather( blob, _mesh->positions_buffer, _mesh->positions_offset, _mesh->positions_stride, __get_position_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_gather( blob, _mesh->colors_buffer, _mesh->colors_offset, _mesh->colors_stride, __get_color_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_gather( blob, _mesh->uv_buffer, _mesh->uv_offset, _mesh->uv_stride, __get_uv_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_gather( blob, _mesh->sdf_buffer, _mesh->sdf_offset, _mesh->sdf_stride, __get_sdf_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_gather( blob, _mesh->depth_buffer, _mesh->depth_offset, _mesh->depth_stride, __get_depth_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_gather( blob, _mesh->indices_buffer, _mesh->indices_offset, _mesh->indices_stride, __get_index_size( _mesh ), _mesh->index_count );
+    blob = __blob_gather( blob, _mesh->ranges_buffer, 0, sizeof( gp_draw_range_t ), __get_range_size( _mesh ), _mesh->range_count );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __mesh_scatter( const gp_mesh_t * _mesh, const gp_uint8_t * _blob )
+{
+    const gp_uint8_t * blob = _blob;
+
+    blob = __blob_scatter( blob, _mesh->positions_buffer, _mesh->positions_offset, _mesh->positions_stride, __get_position_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_scatter( blob, _mesh->colors_buffer, _mesh->colors_offset, _mesh->colors_stride, __get_color_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_scatter( blob, _mesh->uv_buffer, _mesh->uv_offset, _mesh->uv_stride, __get_uv_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_scatter( blob, _mesh->sdf_buffer, _mesh->sdf_offset, _mesh->sdf_stride, __get_sdf_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_scatter( blob, _mesh->depth_buffer, _mesh->depth_offset, _mesh->depth_stride, __get_depth_size( _mesh ), _mesh->vertex_count );
+    blob = __blob_scatter( blob, _mesh->indices_buffer, _mesh->indices_offset, _mesh->indices_stride, __get_index_size( _mesh ), _mesh->index_count );
+    blob = __blob_scatter( blob, _mesh->ranges_buffer, 0, sizeof( gp_draw_range_t ), __get_range_size( _mesh ), _mesh->range_count );
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_render_cached( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, const gp_mesh_cache_t * _cache )
+{
+    gp_uint64_t hash;
+    GP_CALL( gp_calculate_mesh_hash, (_canvas, _mesh, &hash) );
+
+    gp_size_t size;
+    GP_CALL( gp_calculate_mesh_blob_size, (_mesh, &size) );
+
+    const void * cached_blob = GP_NULLPTR;
+    gp_size_t cached_size = 0;
+
+    if( (*_cache->read)(hash, &cached_blob, &cached_size, _cache->ud) == GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( cached_blob != GP_NULLPTR && cached_size == size )
+    {
+        __mesh_scatter( _mesh, (const gp_uint8_t *)cached_blob );
+
+        return GP_SUCCESSFUL;
+    }
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    if( _cache->write == GP_NULLPTR || size == 0 )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    gp_uint8_t * blob = (gp_uint8_t *)(*_canvas->malloc)(size, _canvas->ud);
+
+    __mesh_gather( _mesh, blob );
+
+    gp_result_t result = (*_cache->write)(hash, blob, size, _cache->ud);
+
+    GP_FREE( _canvas, blob );
+
+    return result;
+}
@@ -0,0 +1,791 @@
+#include "corner.h"
+
+#include "detail.h"
+
+//////////////////////////////////////////////////////////////////////////
+typedef enum gp_corner_pattern_e
+{
+    GP_CORNER_PATTERN_STRIP,
+    GP_CORNER_PATTERN_CROSS,
+    GP_CORNER_PATTERN_ENTER,
+    GP_CORNER_PATTERN_LEAVE,
+} gp_corner_pattern_e;
+//////////////////////////////////////////////////////////////////////////
+static const gp_uint8_t gp_corner_patterns[4][6] = {
+    {0, 1, 2, 2, 1, 3},
+    {0, 2, 1, 1, 2, 3},
+    {1, 2, 0, 0, 2, 3},
+    {0, 1, 3, 3, 1, 2}
+};
+//////////////////////////////////////////////////////////////////////////
+static const float gp_corner_sign_x[4] = {1.f, -1.f, -1.f, 1.f};
+static const float gp_corner_sign_y[4] = {1.f, 1.f, -1.f, -1.f};
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_corner_profile_t
+{
+    gp_uint8_t lanes;
+    float side[4];
+    float arc[4];
+    gp_argb_t argb[4];
+    float alpha[4];
+    gp_bool_t gradient;
+    gp_corner_pattern_e enter;
+    gp_corner_pattern_e leave;
+    gp_corner_pattern_e fill;
+} gp_corner_profile_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_corner_shape_t
+{
+    const gp_state_t * state;
+
+    float x[4];
+    float y[4];
+    float radius[4];
+
+    gp_uint32_t rounded_count;
+
+    float u_offset;
+    float v_offset;
+    float total_width;
+    float total_height;
+} gp_corner_shape_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_corner_point_t
+{
+    gp_uint16_t vertex;
+    float x;
+    float y;
+    float alpha;
+} gp_corner_point_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_corner_station_t
+{
+    gp_uint16_t vertex;
+    gp_vec2f_t p[4];
+} gp_corner_station_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_corner_contour_t
+{
+    gp_corner_station_t begin[4];
+    gp_corner_station_t end[4];
+    gp_uint16_t arc[4];
+} gp_corner_contour_t;
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t __corner_rounded_count( const float * _radius )
+{
+    gp_uint32_t count = 0;
+
+    for( gp_uint32_t index = 0; index != 4; ++index )
+    {
+        count += _radius[index] > 0.f;
+    }
+
+    return count;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint8_t __corner_lanes( const gp_state_t * _state )
+{
+    if( _state->fill == GP_FALSE )
+    {
+        return _state->penumbra > 0.f ? 4 : 2;
+    }
+
+    return _state->penumbra > 0.f ? 2 : 1;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_bool_t gp_corner_has_outline( const gp_state_t * _state, gp_bool_t _outline )
+{
+    if( _outline == GP_FALSE || _state->fill == GP_FALSE || _state->penumbra > 0.f )
+    {
+        return GP_FALSE;
+    }
+
+    return _state->outline_width > 0.f ? GP_TRUE : GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_dry_mesh( gp_mesh_t * _mesh )
+{
+    _mesh->color.r = 1.f;
+    _mesh->color.g = 1.f;
+    _mesh->color.b = 1.f;
+    _mesh->color.a = 1.f;
+
+    _mesh->positions_buffer = GP_NULLPTR;
+    _mesh->colors_buffer = GP_NULLPTR;
+    _mesh->colors_format = GP_COLOR_FORMAT_ARGB;
+    _mesh->colors_premultiplied = GP_FALSE;
+    _mesh->uv_buffer = GP_NULLPTR;
+    _mesh->indices_buffer = GP_NULLPTR;
+    _mesh->sdf_buffer = GP_NULLPTR;
+    _mesh->depth_buffer = GP_NULLPTR;
+    _mesh->ranges_buffer = GP_NULLPTR;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_calculate_mesh_corner_size( const gp_state_t * _state, gp_vec2f_t _point, float _width, float _height, const float * _radius, gp_bool_t _outline, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count )
+{
+    if( _state->gradient == GP_GRADIENT_LINEAR )
+    {
+        gp_mesh_t mesh;
+        __corner_dry_mesh( &mesh );
+
+        gp_corner_template_t corner_template;
+        corner_template.quality = 0;
+
+        gp_uint16_t vertex_iterator = 0;
+        gp_uint16_t index_iterator = 0;
+
+        gp_render_corner( &mesh, &corner_template, _state, _point, _width, _height, _radius, _outline, &vertex_iterator, &index_iterator );
+
+        *_vertex_count += vertex_iterator;
+        *_index_count += index_iterator;
+
+        return;
+    }
+
+    gp_uint32_t rounded_count = __corner_rounded_count( _radius );
+
+    gp_uint16_t quality = _state->rect_quality;
+    gp_uint16_t lanes = __corner_lanes( _state );
+    gp_uint16_t bands = lanes - 1;
+
+    gp_uint16_t stations = (gp_uint16_t)(4 + rounded_count + rounded_count * (quality - 1));
+    gp_uint16_t segments = (gp_uint16_t)(rounded_count * quality);
+
+    gp_uint32_t vertex_count = (gp_uint32_t)stations * lanes;
+    gp_uint32_t index_count = 4 * (gp_uint32_t)bands * 6 + (gp_uint32_t)segments * bands * 6;
+
+    if( _state->fill == GP_TRUE )
+    {
+        if( rounded_count != 0 )
+        {
+            vertex_count += 4;
+            index_count += 6 + 4 * 6 + segments * 3;
+        }
+        else
+        {
+            index_count += 6;
+        }
+    }
+
+    if( gp_corner_has_outline( _state, _outline ) == GP_TRUE )
+    {
+        vertex_count += stations * 2;
+        index_count += 4 * 6 + segments * 6;
+    }
+
+    *_vertex_count += vertex_count;
+    *_index_count += index_count;
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_corner_template_t * __corner_template( gp_corner_template_t * _template, const gp_state_t * _state )
+{
+    gp_uint8_t rect_quality = _state->rect_quality;
+
+    if( _template->quality == rect_quality )
+    {
+        return _template;
+    }
+
+    const float a[4] = {gp_constant_half_pi, 0.f, gp_constant_one_and_a_half_pi, gp_constant_pi};
+
+    float dt = gp_constant_half_pi * _state->rect_quality_inv;
+
+    for( gp_uint32_t index_arc = 0; index_arc != 4; ++index_arc )
+    {
+        for( gp_uint8_t index = 1; index != rect_quality; ++index )
+        {
+            float t = a[index_arc] + dt * index;
+
+            _template->cos[index_arc][index - 1] = GP_MATH_COSF( t );
+            _template->sin[index_arc][index - 1] = GP_MATH_SINF( t );
+        }
+    }
+
+    _template->quality = rect_quality;
+
+    return _template;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_profile( gp_corner_profile_t * _profile, const gp_mesh_t * _mesh, const gp_state_t * _state, gp_argb_t _argb )
+{
+    float half_thickness = _state->thickness * 0.5f;
+    float half_thickness_soft = half_thickness - _state->penumbra;
+
+    gp_argb_t argb_soft = gp_mesh_color_transparent( _mesh, _argb );
+
+    _profile->lanes = __corner_lanes( _state );
+    _profile->gradient = _state->gradient != GP_GRADIENT_NONE ? GP_TRUE : GP_FALSE;
+    _profile->enter = GP_CORNER_PATTERN_CROSS;
+    _profile->leave = GP_CORNER_PATTERN_STRIP;
+    _profile->fill = _state->penumbra > 0.f ? GP_CORNER_PATTERN_CROSS : GP_CORNER_PATTERN_STRIP;
+
+    switch( _profile->lanes )
+    {
+    case 1:
+        {
+            _profile->side[0] = half_thickness;
+            _profile->argb[0] = _argb;
+            _profile->alpha[0] = 1.f;
+        }break;
+    case 2:
+        {
+            if( _state->fill == GP_FALSE )
+            {
+                _profile->side[0] = half_thickness;
+                _profile->side[1] = -half_thickness;
+                _profile->argb[0] = _argb;
+                _profile->argb[1] = _argb;
+                _profile->alpha[0] = 1.f;
+                _profile->alpha[1] = 1.f;
+            }
+            else
+            {
+                _profile->side[0] = half_thickness;
+                _profile->side[1] = half_thickness_soft;
+                _profile->argb[0] = argb_soft;
+                _profile->argb[1] = _argb;
+                _profile->alpha[0] = 0.f;
+                _profile->alpha[1] = 1.f;
+            }
+        }break;
+    case 4:
+        {
+            _profile->side[0] = half_thickness;
+            _profile->side[1] = half_thickness_soft;
+            _profile->side[2] = -half_thickness_soft;
+            _profile->side[3] = -half_thickness;
+            _profile->argb[0] = argb_soft;
+            _profile->argb[1] = _argb;
+            _profile->argb[2] = _argb;
+            _profile->argb[3] = argb_soft;
+            _profile->alpha[0] = 0.f;
+            _profile->alpha[1] = 1.f;
+            _profile->alpha[2] = 1.f;
+            _profile->alpha[3] = 0.f;
+        }break;
+    }
+
+    for( gp_uint8_t lane = 0; lane != _profile->lanes; ++lane )
+    {
+        _profile->arc[lane] = _profile->side[lane];
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_profile_outline( gp_corner_profile_t * _profile, const gp_state_t * _state, gp_argb_t _argb )
+{
+    float half_thickness = _state->thickness * 0.5f;
+    float half_thickness_outline = half_thickness + _state->outline_width;
+
+    _profile->lanes = 2;
+    _profile->side[0] = half_thickness_outline;
+    _profile->side[1] = half_thickness;
+    _profile->arc[0] = half_thickness;
+    _profile->arc[1] = half_thickness_outline;
+    _profile->argb[0] = _argb;
+    _profile->argb[1] = _argb;
+    _profile->alpha[0] = 1.f;
+    _profile->alpha[1] = 1.f;
+    _profile->gradient = GP_FALSE;
+    _profile->enter = GP_CORNER_PATTERN_ENTER;
+    _profile->leave = GP_CORNER_PATTERN_LEAVE;
+    _profile->fill = GP_CORNER_PATTERN_STRIP;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_push_vertex( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_profile_t * _profile, gp_uint16_t _vertex_iterator, float _x, float _y, gp_argb_t _argb )
+{
+    gp_mesh_push_position( _mesh, _vertex_iterator, _x, _y );
+
+    if( _profile->gradient == GP_TRUE )
+    {
+        gp_mesh_push_fill_color( _shape->state, _mesh, _vertex_iterator, _x, _y, _argb );
+    }
+    else
+    {
+        gp_mesh_push_color( _mesh, _vertex_iterator, _argb );
+    }
+
+    gp_mesh_push_uv_map( _shape->state, _mesh, _vertex_iterator, _x, _y, _shape->u_offset, _shape->v_offset, _shape->total_width, _shape->total_height );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_station( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_profile_t * _profile, float _x, float _y, float _nx, float _ny, gp_corner_station_t * _station, gp_uint16_t * _vertex_iterator )
+{
+    gp_uint16_t vertex_iterator = *_vertex_iterator;
+
+    _station->vertex = vertex_iterator;
+
+    for( gp_uint8_t lane = 0; lane != _profile->lanes; ++lane )
+    {
+        float d = _profile->side[lane];
+
+        float x = _x + _nx * d;
+        float y = _y + _ny * d;
+
+        _station->p[lane].x = x;
+        _station->p[lane].y = y;
+
+        __corner_push_vertex( _mesh, _shape, _profile, vertex_iterator + lane, x, y, _profile->argb[lane] );
+    }
+
+    *_vertex_iterator += _profile->lanes;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_side_station( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_profile_t * _profile, gp_uint32_t _corner, gp_bool_t _horizontal, gp_corner_station_t * _station, gp_uint16_t * _vertex_iterator )
+{
+    float x = _shape->x[_corner];
+    float y = _shape->y[_corner];
+    float radius = _shape->radius[_corner];
+    float sx = gp_corner_sign_x[_corner];
+    float sy = gp_corner_sign_y[_corner];
+
+    if( radius > 0.f )
+    {
+        if( _horizontal == GP_TRUE )
+        {
+            __corner_station( _mesh, _shape, _profile, x + sx * radius, y, 0.f, -sy, _station, _vertex_iterator );
+
+            return;
+        }
+
+        __corner_station( _mesh, _shape, _profile, x, y + sy * radius, -sx, 0.f, _station, _vertex_iterator );
+
+        return;
+    }
+
+    __corner_station( _mesh, _shape, _profile, x, y, -sx, -sy, _station, _vertex_iterator );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_contour( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_profile_t * _profile, const gp_corner_template_t * _template, gp_corner_contour_t * _contour, gp_uint16_t * _vertex_iterator )
+{
+    __corner_side_station( _mesh, _shape, _profile, 0, GP_TRUE, _contour->begin + 0, _vertex_iterator );
+    _contour->end[0] = _contour->begin[0];
+
+    for( gp_uint32_t index_corner = 1; index_corner != 4; ++index_corner )
+    {
+        gp_bool_t horizontal = (index_corner & 1) == 1 ? GP_TRUE : GP_FALSE;
+
+        __corner_side_station( _mesh, _shape, _profile, index_corner, horizontal, _contour->end + index_corner, _vertex_iterator );
+        _contour->begin[index_corner] = _contour->end[index_corner];
+
+        if( _shape->radius[index_corner] > 0.f )
+        {
+            __corner_side_station( _mesh, _shape, _profile, index_corner, !horizontal, _contour->begin + index_corner, _vertex_iterator );
+        }
+    }
+
+    if( _shape->radius[0] > 0.f )
+    {
+        __corner_side_station( _mesh, _shape, _profile, 0, GP_FALSE, _contour->end + 0, _vertex_iterator );
+    }
+
+    gp_uint16_t vertex_iterator = *_vertex_iterator;
+
+    for( gp_uint32_t index_corner = 0; index_corner != 4; ++index_corner )
+    {
+        float radius = _shape->radius[index_corner];
+
+        if( radius <= 0.f )
+        {
+            continue;
+        }
+
+        _contour->arc[index_corner] = vertex_iterator;
+
+        float cx = _shape->x[index_corner] + gp_corner_sign_x[index_corner] * radius;
+        float cy = _shape->y[index_corner] + gp_corner_sign_y[index_corner] * radius;
+
+        const float * ct = _template->cos[index_corner];
+        const float * st = _template->sin[index_corner];
+
+        for( gp_uint8_t index = 0; index != _template->quality - 1; ++index )
+        {
+            for( gp_uint8_t lane = 0; lane != _profile->lanes; ++lane )
+            {
+                float r = radius + _profile->arc[lane];
+
+                __corner_push_vertex( _mesh, _shape, _profile, vertex_iterator + lane, cx + r * ct[index], cy - r * st[index], _profile->argb[lane] );
+            }
+
+            vertex_iterator += _profile->lanes;
+        }
+    }
+
+    *_vertex_iterator = vertex_iterator;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_quad( const gp_mesh_t * _mesh, gp_corner_pattern_e _pattern, gp_uint16_t _a0, gp_uint16_t _a1, gp_uint16_t _b0, gp_uint16_t _b1, gp_uint16_t * _index_iterator )
+{
+    const gp_uint16_t v[4] = {_a0, _a1, _b0, _b1};
+
+    const gp_uint8_t * pattern = gp_corner_patterns[_pattern];
+
+    gp_uint16_t index_iterator = *_index_iterator;
+
+    for( gp_uint16_t index = 0; index != 6; ++index )
+    {
+        gp_mesh_push_index( _mesh, index_iterator + index, v[pattern[index]] );
+    }
+
+    *_index_iterator += 6;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_rims( const gp_mesh_t * _mesh, const gp_corner_profile_t * _profile, gp_corner_pattern_e _pattern, gp_uint16_t _a, gp_uint16_t _b, gp_uint16_t * _index_iterator )
+{
+    for( gp_uint16_t band = 0; band + 1 < _profile->lanes; ++band )
+    {
+        __corner_quad( _mesh, _pattern, _a + band, _a + band + 1, _b + band, _b + band + 1, _index_iterator );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_point( gp_corner_point_t * _point, const gp_corner_profile_t * _profile, const gp_corner_station_t * _station, gp_uint16_t _lane )
+{
+    _point->vertex = _station->vertex + _lane;
+    _point->x = _station->p[_lane].x;
+    _point->y = _station->p[_lane].y;
+    _point->alpha = _profile->alpha[_lane];
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_center( gp_corner_point_t * _point, const gp_corner_shape_t * _shape, gp_uint16_t _center, gp_uint32_t _corner )
+{
+    _point->vertex = _center + (gp_uint16_t)_corner;
+    _point->x = _shape->x[_corner] + gp_corner_sign_x[_corner] * _shape->radius[_corner];
+    _point->y = _shape->y[_corner] + gp_corner_sign_y[_corner] * _shape->radius[_corner];
+    _point->alpha = 1.f;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __corner_gradient_crosses( const gp_state_t * _state, float _t0, float _t1 )
+{
+    for( gp_uint32_t index = 0; index != _state->gradient_stop_count; ++index )
+    {
+        float offset = _state->gradient_stops[index].offset;
+
+        if( _t0 < offset && offset < _t1 )
+        {
+            return GP_TRUE;
+        }
+    }
+
+    return GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t __corner_chain_cuts( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_point_t * _p0, const gp_corner_point_t * _p1, float _t0, float _t1, gp_corner_point_t * _chain, float * _chain_t, gp_uint32_t _count, gp_uint16_t * _vertex_iterator )
+{
+    const gp_state_t * state = _shape->state;
+
+    gp_uint32_t count = _count;
+
+    for( gp_uint32_t index = 0; index != state->gradient_stop_count; ++index )
+    {
+        float offset = state->gradient_stops[index].offset;
+
+        if( offset <= _t0 || offset >= _t1 )
+        {
+            continue;
+        }
+
+        if( index != 0 && offset == state->gradient_stops[index - 1].offset )
+        {
+            continue;
+        }
+
+        float f = (offset - _t0) / (_t1 - _t0);
+
+        gp_corner_point_t * cut = _chain + count;
+        cut->vertex = (*_vertex_iterator)++;
+        cut->x = _p0->x + (_p1->x - _p0->x) * f;
+        cut->y = _p0->y + (_p1->y - _p0->y) * f;
+        cut->alpha = _p0->alpha + (_p1->alpha - _p0->alpha) * f;
+
+        gp_mesh_push_position( _mesh, cut->vertex, cut->x, cut->y );
+
+        if( _mesh->colors_buffer != GP_NULLPTR )
+        {
+            gp_argb_t argb = gp_gradient_argb( &_mesh->color, state, cut->x, cut->y );
+            gp_uint32_t a = (gp_uint32_t)((float)(argb >> 24) * cut->alpha + 0.5f);
+
+            gp_argb_t c = gp_mesh_color( _mesh, (argb & 0x00ffffff) | (a << 24) );
+
+            gp_mesh_push_color( _mesh, cut->vertex, c );
+        }
+
+        gp_mesh_push_uv_map( state, _mesh, cut->vertex, cut->x, cut->y, _shape->u_offset, _shape->v_offset, _shape->total_width, _shape->total_height );
+
+        _chain_t[count] = offset;
+
+        ++count;
+    }
+
+    return count;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_split_quad( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_profile_t * _profile, gp_corner_pattern_e _pattern, const gp_corner_point_t * _a0, const gp_corner_point_t * _a1, const gp_corner_point_t * _b0, const gp_corner_point_t * _b1, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator )
+{
+    const gp_state_t * state = _shape->state;
+
+    if( _profile->gradient == GP_FALSE || state->gradient != GP_GRADIENT_LINEAR )
+    {
+        __corner_quad( _mesh, _pattern, _a0->vertex, _a1->vertex, _b0->vertex, _b1->vertex, _index_iterator );
+
+        return;
+    }
+
+    const gp_corner_point_t * polygon[4] = {_a0, _a1, _b1, _b0};
+
+    float t[4];
+
+    gp_uint32_t lo = 0;
+    gp_uint32_t hi = 0;
+
+    for( gp_uint32_t index = 0; index != 4; ++index )
+    {
+        t[index] = gp_gradient_offset( state, polygon[index]->x, polygon[index]->y );
+
+        lo = t[index] < t[lo] ? index : lo;
+        hi = t[index] > t[hi] ? index : hi;
+    }
+
+    if( __corner_gradient_crosses( state, t[lo], t[hi] ) == GP_FALSE )
+    {
+        __corner_quad( _mesh, _pattern, _a0->vertex, _a1->vertex, _b0->vertex, _b1->vertex, _index_iterator );
+
+        return;
+    }
+
+    gp_corner_point_t chains[2][4 + GP_GRADIENT_STOP_MAX];
+    float chains_t[2][4 + GP_GRADIENT_STOP_MAX];
+    gp_uint32_t chains_count[2];
+
+    for( gp_uint32_t side = 0; side != 2; ++side )
+    {
+        gp_uint32_t step = side == 0 ? 1 : 3;
+
+        gp_corner_point_t * chain = chains[side];
+        float * chain_t = chains_t[side];
+
+        chain[0] = *polygon[lo];
+        chain_t[0] = t[lo];
+
+        gp_uint32_t count = 1;
+
+        for( gp_uint32_t k = lo; k != hi; k = (k + step) % 4 )
+        {
+            gp_uint32_t n = (k + step) % 4;
+
+            count = __corner_chain_cuts( _mesh, _shape, polygon[k], polygon[n], t[k], t[n], chain, chain_t, count, _vertex_iterator );
+
+            chain[count] = *polygon[n];
+            chain_t[count] = t[n];
+
+            ++count;
+        }
+
+        chains_count[side] = count;
+    }
+
+    const gp_corner_point_t * a = chains[0];
+    const gp_corner_point_t * b = chains[1];
+
+    gp_uint32_t a_last = chains_count[0] - 1;
+    gp_uint32_t b_last = chains_count[1] - 1;
+
+    gp_uint32_t i = 0;
+    gp_uint32_t j = 0;
+
+    while( i != a_last || j != b_last )
+    {
+        gp_bool_t advance_a = j == b_last || (i != a_last && chains_t[0][i + 1] <= chains_t[1][j + 1]) ? GP_TRUE : GP_FALSE;
+
+        const gp_corner_point_t * next = advance_a == GP_TRUE ? a + i + 1 : b + j + 1;
+
+        if( a[i].vertex != b[j].vertex && next->vertex != a[i].vertex && next->vertex != b[j].vertex )
+        {
+            gp_uint16_t index_iterator = *_index_iterator;
+
+            gp_mesh_push_index( _mesh, index_iterator + 0, a[i].vertex );
+            gp_mesh_push_index( _mesh, index_iterator + 1, b[j].vertex );
+            gp_mesh_push_index( _mesh, index_iterator + 2, next->vertex );
+
+            *_index_iterator += 3;
+        }
+
+        if( advance_a == GP_TRUE )
+        {
+            ++i;
+        }
+        else
+        {
+            ++j;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_sides( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_profile_t * _profile, const gp_corner_contour_t * _contour, gp_bool_t _fan, gp_uint16_t _center, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator )
+{
+    gp_uint16_t inner = _profile->lanes - 1;
+
+    for( gp_uint32_t index = 0; index != 4; ++index )
+    {
+        gp_uint32_t next = (index + 1) % 4;
+
+        const gp_corner_station_t * a = _contour->begin + index;
+        const gp_corner_station_t * b = _contour->end + next;
+
+        gp_corner_point_t a0;
+        gp_corner_point_t a1;
+        gp_corner_point_t b0;
+        gp_corner_point_t b1;
+
+        for( gp_uint16_t band = 0; band + 1 < _profile->lanes; ++band )
+        {
+            __corner_point( &a0, _profile, a, band );
+            __corner_point( &a1, _profile, a, band + 1 );
+            __corner_point( &b0, _profile, b, band );
+            __corner_point( &b1, _profile, b, band + 1 );
+
+            __corner_split_quad( _mesh, _shape, _profile, GP_CORNER_PATTERN_STRIP, &a0, &a1, &b0, &b1, _vertex_iterator, _index_iterator );
+        }
+
+        if( _fan == GP_TRUE )
+        {
+            __corner_point( &a0, _profile, a, inner );
+            __corner_point( &a1, _profile, b, inner );
+            __corner_center( &b0, _shape, _center, index );
+            __corner_center( &b1, _shape, _center, next );
+
+            __corner_split_quad( _mesh, _shape, _profile, _profile->fill, &a0, &a1, &b0, &b1, _vertex_iterator, _index_iterator );
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __corner_arcs( const gp_mesh_t * _mesh, const gp_corner_shape_t * _shape, const gp_corner_profile_t * _profile, const gp_corner_contour_t * _contour, gp_uint8_t _quality, gp_bool_t _fan, gp_uint16_t _center, gp_uint16_t * _index_iterator )
+{
+    gp_uint16_t inner = _profile->lanes - 1;
+
+    for( gp_uint16_t index_corner = 0; index_corner != 4; ++index_corner )
+    {
+        if( _shape->radius[index_corner] <= 0.f )
+        {
+            continue;
+        }
+
+        gp_uint16_t a = _contour->begin[index_corner].vertex;
+
+        for( gp_uint8_t index = 0; index != _quality; ++index )
+        {
+            gp_bool_t last = index + 1 == _quality ? GP_TRUE : GP_FALSE;
+
+            gp_uint16_t b = last == GP_TRUE ? _contour->end[index_corner].vertex : _contour->arc[index_corner] + index * _profile->lanes;
+
+            gp_corner_pattern_e pattern = index == 0 ? _profile->enter : (last == GP_TRUE ? _profile->leave : GP_CORNER_PATTERN_STRIP);
+
+            __corner_rims( _mesh, _profile, pattern, a, b, _index_iterator );
+
+            if( _fan == GP_TRUE )
+            {
+                gp_uint16_t index_iterator = *_index_iterator;
+
+                gp_mesh_push_index( _mesh, index_iterator + 0, a + inner );
+                gp_mesh_push_index( _mesh, index_iterator + 1, _center + index_corner );
+                gp_mesh_push_index( _mesh, index_iterator + 2, b + inner );
+
+                *_index_iterator += 3;
+            }
+
+            a = b;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_render_corner( const gp_mesh_t * _mesh, gp_corner_template_t * _template, const gp_state_t * _state, gp_vec2f_t _point, float _width, float _height, const float * _radius, gp_bool_t _outline, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator )
+{
+    float half_thickness = _state->thickness * 0.5f;
+
+    gp_corner_shape_t shape;
+    shape.state = _state;
+
+    shape.x[0] = _point.x + 0.f;
+    shape.y[0] = _point.y + 0.f;
+    shape.x[1] = _point.x + _width;
+    shape.y[1] = _point.y + 0.f;
+    shape.x[2] = _point.x + _width;
+    shape.y[2] = _point.y + _height;
+    shape.x[3] = _point.x + 0.f;
+    shape.y[3] = _point.y + _height;
+
+    for( gp_uint32_t index = 0; index != 4; ++index )
+    {
+        shape.radius[index] = _radius[index];
+    }
+
+    shape.rounded_count = __corner_rounded_count( _radius );
+
+    shape.u_offset = -(shape.x[0] - half_thickness);
+    shape.v_offset = -(shape.y[0] - half_thickness);
+    shape.total_width = _width + _state->thickness;
+    shape.total_height = _height + _state->thickness;
+
+    const gp_corner_template_t * table = shape.rounded_count == 0 ? GP_NULLPTR : __corner_template( _template, _state );
+
+    gp_uint8_t quality = _state->rect_quality;
+
+    gp_argb_t argb = gp_mesh_color( _mesh, gp_color_fill_argb( &_mesh->color, _state ) );
+
+    gp_corner_profile_t profile;
+    __corner_profile( &profile, _mesh, _state, argb );
+
+    gp_bool_t fan = _state->fill == GP_TRUE && shape.rounded_count != 0 ? GP_TRUE : GP_FALSE;
+
+    gp_uint16_t center = *_vertex_iterator;
+
+    if( fan == GP_TRUE )
+    {
+        gp_corner_point_t centers[4];
+
+        for( gp_uint32_t index = 0; index != 4; ++index )
+        {
+            __corner_center( centers + index, &shape, center, index );
+
+            __corner_push_vertex( _mesh, &shape, &profile, centers[index].vertex, centers[index].x, centers[index].y, argb );
+        }
+
+        *_vertex_iterator += 4;
+
+        __corner_split_quad( _mesh, &shape, &profile, GP_CORNER_PATTERN_STRIP, centers + 0, centers + 1, centers + 3, centers + 2, _vertex_iterator, _index_iterator );
+    }
+
+    gp_corner_contour_t contour;
+    __corner_contour( _mesh, &shape, &profile, table, &contour, _vertex_iterator );
+
+    __corner_sides( _mesh, &shape, &profile, &contour, fan, center, _vertex_iterator, _index_iterator );
+
+    if( _state->fill == GP_TRUE && fan == GP_FALSE )
+    {
+        gp_uint16_t inner = profile.lanes - 1;
+
+        gp_corner_point_t corners[4];
+
+        for( gp_uint32_t index = 0; index != 4; ++index )
+        {
+            __corner_point( corners + index, &profile, contour.begin + index, inner );
+        }
+
+        __corner_split_quad( _mesh, &shape, &profile, GP_CORNER_PATTERN_STRIP, corners + 0, corners + 1, corners + 3, corners + 2, _vertex_iterator, _index_iterator );
+    }
+
+    __corner_arcs( _mesh, &shape, &profile, &contour, quality, fan, center, _index_iterator );
+
+    if( gp_corner_has_outline( _state, _outline ) == GP_FALSE )
+    {
+        return;
+    }
+
+    gp_argb_t outline_argb = gp_mesh_color( _mesh, gp_color_tint_argb( &_mesh->color, &_state->outline_color, _state->outline_argb ) );
+
+    gp_corner_profile_t outline_profile;
+    __corner_profile_outline( &outline_profile, _state, outline_argb );
+
+    gp_corner_contour_t outline_contour;
+    __corner_contour( _mesh, &shape, &outline_profile, table, &outline_contour, _vertex_iterator );
+
+    __corner_sides( _mesh, &shape, &outline_profile, &outline_contour, GP_FALSE, center, _vertex_iterator, _index_iterator );
+    __corner_arcs( _mesh, &shape, &outline_profile, &outline_contour, quality, GP_FALSE, center, _index_iterator );
+}
@@ -0,0 +1,19 @@
+#ifndef GP_CORNER_H_
+#define GP_CORNER_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+typedef struct gp_corner_template_t
+{
+    gp_uint8_t quality;
+    float cos[4][254];
+    float sin[4][254];
+} gp_corner_template_t;
+
+gp_bool_t gp_corner_has_outline( const gp_state_t * _state, gp_bool_t _outline );
+void gp_calculate_mesh_corner_size( const gp_state_t * _state, gp_vec2f_t _point, float _width, float _height, const float * _radius, gp_bool_t _outline, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count );
+void gp_render_corner( const gp_mesh_t * _mesh, gp_corner_template_t * _template, const gp_state_t * _state, gp_vec2f_t _point, float _width, float _height, const float * _radius, gp_bool_t _outline, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator );
+
+#endif
\ No newline at end of file
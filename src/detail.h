@@ -6,11 +6,15 @@
 
 #include "struct.h"
 
+#if defined(GP_ENABLE_SSE2)
+#include <emmintrin.h>
+#endif
+
 #define GP_NEW(c, t) ((t*)(*c->malloc)(sizeof(t), c->ud))
-#define GP_REALLOC(c, p, t, s) ((t*)(*c->realloc)((p), sizeof(t) * s, c->ud))
+#define GP_REALLOC(c, p, t, s) ((t*)(*c->realloc)((p), sizeof(t) * (s), c->ud))
 #define GP_FREE(c, p) (*c->free)((p), c->ud)
 
-#if defined(GP_DEBUG)
+#if defined(GP_DEBUG) || defined(GP_VALIDATION)
 #   define GP_CALL(m, args) if( m args == GP_FAILURE) return GP_FAILURE
 #else
 #   define GP_CALL(m, args) m args
@@ -19,6 +23,7 @@
 #define GP_LIST_FOREACH(t, list, e) for( t * e = list; e != GP_NULLPTR; e = e->next )
 #define GP_LIST_PUSHBACK(t, list, e) {if( list == GP_NULLPTR ){list = e; list->prev = e;}else{e->prev = list->prev; e->next = GP_NULLPTR; list->prev->next = e; list->prev = e;}}
 #define GP_LIST_BACK(list) (list->prev)
+#define GP_LIST_REMOVE(list, e) {if( e == list ){list = e->next; if( list != GP_NULLPTR ){list->prev = e->prev;}}else{e->prev->next = e->next; if( e->next != GP_NULLPTR ){e->next->prev = e->prev;}else{list->prev = e->prev;}}}
 #define GP_LIST_DESTROY(c, t, list) {for( t * __l = list; __l != GP_NULLPTR; ){ t * __r = __l; __l = __l->next; GP_FREE( c, __r ); } list = GP_NULLPTR;}
 
 #define GP_EQUAL_F(f, eps) (((f) >= -(eps)) && ((f) <= (eps)))
@@ -30,15 +35,485 @@ static const float gp_constant_half_pi = 1.5707963267948966192313216916398f;
 static const float gp_constant_one_and_a_half_pi = 4.7123889803846898576939650749193f;
 static const float gp_constant_two_pi = 6.283185307179586476925286766559f;
 
-void gp_color_mul( gp_color_t * _c, const gp_color_t * _c0, const gp_color_t * _c1 );
-gp_uint32_t gp_color_argb( const gp_color_t * _c );
+//////////////////////////////////////////////////////////////////////////
+static inline gp_bool_t gp_ellipse_is_arc( const gp_ellipse_t * _ellipse )
+{
+    float sweep = _ellipse->angle_sweep < 0.f ? -_ellipse->angle_sweep : _ellipse->angle_sweep;
+
+    return sweep < gp_constant_two_pi ? GP_TRUE : GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_bool_t gp_rounded_rect_is_uniform( const gp_rounded_rect_t * _rounded_rect )
+{
+    const float * radius = _rounded_rect->radius;
+
+    return radius[0] == radius[1] && radius[0] == radius[2] && radius[0] == radius[3] ? GP_TRUE : GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_color_mul( gp_color_t * _c, const gp_color_t * _c0, const gp_color_t * _c1 )
+{
+    _c->r = _c0->r * _c1->r;
+    _c->g = _c0->g * _c1->g;
+    _c->b = _c0->b * _c1->b;
+    _c->a = _c0->a * _c1->a;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_uint32_t gp_color_argb( const gp_color_t * _c )
+{
+    const float rgba_255 = 255.5f;
+
+    gp_uint8_t r8 = (gp_uint8_t)(GP_COLOR_R( _c ) * rgba_255);
+    gp_uint8_t g8 = (gp_uint8_t)(GP_COLOR_G( _c ) * rgba_255);
+    gp_uint8_t b8 = (gp_uint8_t)(GP_COLOR_B( _c ) * rgba_255);
+    gp_uint8_t a8 = (gp_uint8_t)(GP_COLOR_A( _c ) * rgba_255);
+
+    gp_uint32_t argb = (a8 << 24) | (r8 << 16) | (g8 << 8) | (b8 << 0);
+
+    return argb;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_bool_t __color_is_white( const gp_color_t * _c )
+{
+    return GP_COLOR_R( _c ) == 1.f && GP_COLOR_G( _c ) == 1.f && GP_COLOR_B( _c ) == 1.f && GP_COLOR_A( _c ) == 1.f;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_argb_t gp_color_tint_argb( const gp_color_t * _tint, const gp_color_t * _c, gp_argb_t _argb )
+{
+    if( __color_is_white( _tint ) == GP_TRUE )
+    {
+        return _argb;
+    }
+
+    gp_color_t color;
+    gp_color_mul( &color, _tint, _c );
+
+    gp_argb_t argb = gp_color_argb( &color );
+
+    return argb;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_argb_t gp_color_lerp_argb( const gp_color_t * _tint, const gp_color_t * _c0, const gp_color_t * _c1, float _t )
+{
+#if defined(GP_ENABLE_SSE2)
+    __m128 c0 = _mm_setr_ps( GP_COLOR_B( _c0 ), GP_COLOR_G( _c0 ), GP_COLOR_R( _c0 ), GP_COLOR_A( _c0 ) );
+    __m128 c1 = _mm_setr_ps( GP_COLOR_B( _c1 ), GP_COLOR_G( _c1 ), GP_COLOR_R( _c1 ), GP_COLOR_A( _c1 ) );
+    __m128 tint = _mm_setr_ps( GP_COLOR_B( _tint ), GP_COLOR_G( _tint ), GP_COLOR_R( _tint ), GP_COLOR_A( _tint ) );
+
+    __m128 t = _mm_set1_ps( _t );
+    __m128 it = _mm_set1_ps( 1.f - _t );
+
+    __m128 c = _mm_add_ps( _mm_mul_ps( c0, it ), _mm_mul_ps( c1, t ) );
+    c = _mm_mul_ps( c, tint );
+    c = _mm_mul_ps( c, _mm_set1_ps( 255.5f ) );
+
+    __m128i c32 = _mm_cvttps_epi32( c );
+    __m128i c16 = _mm_packs_epi32( c32, c32 );
+    __m128i c8 = _mm_packus_epi16( c16, c16 );
+
+    gp_argb_t argb = (gp_argb_t)_mm_cvtsi128_si32( c8 );
+
+    return argb;
+#else
+    gp_color_t c;
+    c.r = GP_COLOR_R( _c0 ) * (1.f - _t) + GP_COLOR_R( _c1 ) * _t;
+    c.g = GP_COLOR_G( _c0 ) * (1.f - _t) + GP_COLOR_G( _c1 ) * _t;
+    c.b = GP_COLOR_B( _c0 ) * (1.f - _t) + GP_COLOR_B( _c1 ) * _t;
+    c.a = GP_COLOR_A( _c0 ) * (1.f - _t) + GP_COLOR_A( _c1 ) * _t;
+
+    gp_color_t color;
+    gp_color_mul( &color, _tint, &c );
+
+    gp_argb_t argb = gp_color_argb( &color );
+
+    return argb;
+#endif
+}
+//////////////////////////////////////////////////////////////////////////
+static inline float gp_gradient_offset( const gp_state_t * _state, float _x, float _y )
+{
+    float dx = _x - _state->gradient_x0;
+    float dy = _y - _state->gradient_y0;
+
+    if( _state->gradient == GP_GRADIENT_RADIAL )
+    {
+        return GP_MATH_SQRTF( dx * dx + dy * dy ) / _state->gradient_radius;
+    }
+
+    float gx = _state->gradient_x1 - _state->gradient_x0;
+    float gy = _state->gradient_y1 - _state->gradient_y0;
+
+    return (dx * gx + dy * gy) / (gx * gx + gy * gy);
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_argb_t gp_gradient_argb( const gp_color_t * _tint, const gp_state_t * _state, float _x, float _y )
+{
+    float t = gp_gradient_offset( _state, _x, _y );
+
+    const gp_gradient_stop_t * stops = _state->gradient_stops;
+
+    if( t <= stops[0].offset )
+    {
+        return gp_color_lerp_argb( _tint, &stops[0].color, &stops[0].color, 0.f );
+    }
+
+    for( gp_uint32_t index = 1; index != _state->gradient_stop_count; ++index )
+    {
+        const gp_gradient_stop_t * s1 = stops + index;
+
+        if( t > s1->offset )
+        {
+            continue;
+        }
+
+        const gp_gradient_stop_t * s0 = s1 - 1;
+
+        float f = (t - s0->offset) / (s1->offset - s0->offset);
+
+        return gp_color_lerp_argb( _tint, &s0->color, &s1->color, f );
+    }
+
+    const gp_gradient_stop_t * last = stops + _state->gradient_stop_count - 1;
+
+    return gp_color_lerp_argb( _tint, &last->color, &last->color, 0.f );
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_argb_t gp_color_fill_argb( const gp_color_t * _tint, const gp_state_t * _state )
+{
+    if( _state->gradient != GP_GRADIENT_NONE )
+    {
+        return 0xffffffff;
+    }
+
+    return gp_color_tint_argb( _tint, &_state->color, _state->argb );
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_int16_t __quantize_short( float _value )
+{
+    if( _value <= -32768.f )
+    {
+        return -32768;
+    }
+
+    if( _value >= 32767.f )
+    {
+        return 32767;
+    }
+
+    gp_int16_t q = (gp_int16_t)(_value >= 0.f ? _value + 0.5f : _value - 0.5f);
+
+    return q;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_uint16_t __quantize_unorm16( float _value )
+{
+    if( _value <= 0.f )
+    {
+        return 0;
+    }
+
+    if( _value >= 1.f )
+    {
+        return 65535;
+    }
+
+    gp_uint16_t q = (gp_uint16_t)(_value * 65535.f + 0.5f);
+
+    return q;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_uint16_t __quantize_half( float _value )
+{
+    union
+    {
+        float f;
+        gp_uint32_t u;
+    } v;
+
+    v.f = _value;
+
+    gp_uint32_t sign = (v.u >> 16) & 0x8000;
+    gp_uint32_t exponent = (v.u >> 23) & 0xff;
+    gp_uint32_t mantissa = v.u & 0x007fffff;
+
+    if( exponent == 0xff )
+    {
+        return (gp_uint16_t)(sign | 0x7c00 | (mantissa != 0 ? 0x0200 : 0));
+    }
+
+    if( exponent >= 127 + 16 )
+    {
+        return (gp_uint16_t)(sign | 0x7c00);
+    }
+
+    if( exponent < 127 - 24 )
+    {
+        return (gp_uint16_t)sign;
+    }
+
+    if( exponent < 127 - 14 )
+    {
+        mantissa |= 0x00800000;
+
+        gp_uint32_t shift = 127 - 14 + 13 - exponent;
+        gp_uint32_t h = (mantissa >> shift) + ((mantissa >> (shift - 1)) & 1);
+
+        return (gp_uint16_t)(sign | h);
+    }
+
+    gp_uint32_t h = ((exponent - 127 + 15) << 10) | (mantissa >> 13);
+
+    h += (mantissa >> 12) & 1;
+
+    return (gp_uint16_t)(sign | h);
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_index( const gp_mesh_t * _mesh, gp_uint16_t _iterator, gp_uint16_t _index )
+{
+    if( _mesh->indices_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    * (gp_uint16_t *)((gp_uint8_t *)_mesh->indices_buffer + _mesh->indices_offset + _mesh->indices_stride * _iterator) = _index;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_position( const gp_mesh_t * _mesh, gp_uint16_t _iterator, float _x, float _y )
+{
+    if( _mesh->positions_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    void * buffer = (gp_uint8_t *)_mesh->positions_buffer + _mesh->positions_offset + _mesh->positions_stride * _iterator;
+
+    switch( _mesh->positions_format )
+    {
+    case GP_POSITION_FORMAT_FLOAT2:
+        {
+            gp_vec2f_t p;
+            p.x = _x;
+            p.y = _y;
+
+            *(gp_vec2f_t *)buffer = p;
+        }break;
+    case GP_POSITION_FORMAT_SHORT2:
+        {
+            float scale = _mesh->positions_scale;
+
+            gp_int16_t * p = (gp_int16_t *)buffer;
+            p[0] = __quantize_short( (_x - _mesh->positions_origin_x) * scale );
+            p[1] = __quantize_short( (_y - _mesh->positions_origin_y) * scale );
+        }break;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_argb_t __convert_color( gp_argb_t _c, gp_color_format_e _format, gp_bool_t _premultiplied )
+{
+    gp_uint32_t a = (_c >> 24) & 0xff;
+    gp_uint32_t r = (_c >> 16) & 0xff;
+    gp_uint32_t g = (_c >> 8) & 0xff;
+    gp_uint32_t b = (_c >> 0) & 0xff;
+
+    if( _premultiplied == GP_TRUE )
+    {
+        r = (r * a + 127) / 255;
+        g = (g * a + 127) / 255;
+        b = (b * a + 127) / 255;
+    }
+
+    gp_argb_t c = (a << 24) | (r << 16) | (g << 8) | (b << 0);
+
+    switch( _format )
+    {
+    case GP_COLOR_FORMAT_ARGB:
+        {
+        }break;
+    case GP_COLOR_FORMAT_ABGR:
+        {
+            c = (a << 24) | (b << 16) | (g << 8) | (r << 0);
+        }break;
+    case GP_COLOR_FORMAT_RGBA:
+        {
+            c = (r << 24) | (g << 16) | (b << 8) | (a << 0);
+        }break;
+    }
+
+    return c;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_argb_t gp_mesh_color( const gp_mesh_t * _mesh, gp_argb_t _argb )
+{
+    if( _mesh->colors_format == GP_COLOR_FORMAT_ARGB && _mesh->colors_premultiplied == GP_FALSE )
+    {
+        return _argb;
+    }
+
+    gp_argb_t c = __convert_color( _argb, _mesh->colors_format, _mesh->colors_premultiplied );
+
+    return c;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_argb_t gp_mesh_color_transparent( const gp_mesh_t * _mesh, gp_argb_t _c )
+{
+    if( _mesh->colors_premultiplied == GP_TRUE )
+    {
+        return 0;
+    }
+
+    if( _mesh->colors_format == GP_COLOR_FORMAT_RGBA )
+    {
+        return _c & 0xffffff00;
+    }
+
+    return _c & 0x00ffffff;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline gp_uint32_t gp_mesh_color_alpha( const gp_mesh_t * _mesh, gp_argb_t _c )
+{
+    if( _mesh->colors_format == GP_COLOR_FORMAT_RGBA )
+    {
+        return _c & 0xff;
+    }
+
+    return _c >> 24;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_color( const gp_mesh_t * _mesh, gp_uint16_t _iterator, gp_argb_t _c )
+{
+    if( _mesh->colors_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    * (gp_argb_t *)((gp_uint8_t *)_mesh->colors_buffer + _mesh->colors_offset + _mesh->colors_stride * _iterator) = _c;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_fill_color( const gp_state_t * _state, const gp_mesh_t * _mesh, gp_uint16_t _iterator, float _x, float _y, gp_argb_t _c )
+{
+    if( _mesh->colors_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    gp_argb_t c = _c;
+
+    if( _state->gradient != GP_GRADIENT_NONE )
+    {
+        gp_argb_t argb = gp_gradient_argb( &_mesh->color, _state, _x, _y );
+
+        c = gp_mesh_color( _mesh, argb ) & _c;
+    }
+
+    gp_mesh_push_color( _mesh, _iterator, c );
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_uv( const gp_state_t * _state, const gp_mesh_t * _mesh, gp_uint16_t _iterator, float _u, float _v )
+{
+    if( _mesh->uv_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    float u = _state->uv_ou + _u * _state->uv_su;
+    float v = _state->uv_ov + _v * _state->uv_sv;
+
+    void * buffer = (gp_uint8_t *)_mesh->uv_buffer + _mesh->uv_offset + _mesh->uv_stride * _iterator;
+
+    switch( _mesh->uv_format )
+    {
+    case GP_UV_FORMAT_FLOAT2:
+        {
+            gp_vec2f_t uv;
+            uv.x = u;
+            uv.y = v;
+
+            *(gp_vec2f_t *)buffer = uv;
+        }break;
+    case GP_UV_FORMAT_UNORM16:
+        {
+            gp_uint16_t * uv = (gp_uint16_t *)buffer;
+            uv[0] = __quantize_unorm16( u );
+            uv[1] = __quantize_unorm16( v );
+        }break;
+    case GP_UV_FORMAT_HALF2:
+        {
+            gp_uint16_t * uv = (gp_uint16_t *)buffer;
+            uv[0] = __quantize_half( u );
+            uv[1] = __quantize_half( v );
+        }break;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_uv_map( const gp_state_t * _state, const gp_mesh_t * _mesh, gp_uint16_t _iterator, float _x, float _y, float _ox, float _oy, float _w, float _h )
+{
+    if( _mesh->uv_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    float u = (_x + _ox) / _w;
+    float v = (_y + _oy) / _h;
+
+    gp_mesh_push_uv( _state, _mesh, _iterator, u, v );
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_sdf( const gp_mesh_t * _mesh, gp_uint16_t _iterator, const gp_sdf_t * _sdf )
+{
+    if( _mesh->sdf_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    *(gp_sdf_t *)((gp_uint8_t *)_mesh->sdf_buffer + _mesh->sdf_offset + _mesh->sdf_stride * _iterator) = *_sdf;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_push_range( const gp_mesh_t * _mesh, gp_uint32_t * _range_iterator, const gp_state_t * _state, gp_uint16_t _index_iterator )
+{
+    if( _mesh->ranges_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    gp_uint32_t range_iterator = *_range_iterator;
+
+    if( range_iterator != 0 )
+    {
+        gp_draw_range_t * back = _mesh->ranges_buffer + range_iterator - 1;
+
+        if( back->material == _state->material && back->blend == _state->blend )
+        {
+            return;
+        }
+
+        back->count = _index_iterator - back->first;
+    }
+
+    gp_draw_range_t * range = _mesh->ranges_buffer + range_iterator;
+
+    range->first = _index_iterator;
+    range->count = 0;
+    range->opaque_count = 0;
+    range->material = _state->material;
+    range->blend = _state->blend;
+
+    *_range_iterator = range_iterator + 1;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline void gp_mesh_finish_ranges( const gp_mesh_t * _mesh, gp_uint32_t _range_iterator, gp_uint16_t _index_iterator )
+{
+    if( _mesh->ranges_buffer == GP_NULLPTR )
+    {
+        return;
+    }
+
+    if( _range_iterator == 0 )
+    {
+        return;
+    }
 
-gp_result_t gp_mesh_push_index( const gp_mesh_t * _mesh, gp_uint16_t _iterator, gp_uint16_t _index );
-gp_result_t gp_mesh_push_position( const gp_mesh_t * _mesh, gp_uint16_t _iterator, float _x, float _y );
-gp_result_t gp_mesh_push_color( const gp_mesh_t * _mesh, gp_uint16_t _iterator, gp_argb_t _c );
-gp_result_t gp_mesh_push_uv( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t _iterator, float _u, float _v );
-gp_result_t gp_mesh_push_uv_map( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t _iterator, float _x, float _y, float _ox, float _oy, float _w, float _h );
+    gp_draw_range_t * back = _mesh->ranges_buffer + _range_iterator - 1;
 
-gp_result_t gp_mesh_get_position( const gp_mesh_t * _mesh, gp_uint16_t _iterator, gp_vec2f_t * const _pos );
+    back->count = _index_iterator - back->first;
+}
 
 #endif
\ No newline at end of file
@@ -0,0 +1,449 @@
+#include "dirty.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "validate.h"
+#include "hash.h"
+#include "spatial.h"
+
+//////////////////////////////////////////////////////////////////////////
+#define GP_DIRTY_SHAPE_TYPE_COUNT (4U)
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_dirty_set_t
+{
+    gp_box_t * boxes;
+    gp_uint32_t count;
+    gp_uint32_t capacity;
+} gp_dirty_set_t;
+//////////////////////////////////////////////////////////////////////////
+static const void * __primitive_first( const gp_canvas_t * _canvas, gp_uint32_t _type )
+{
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_LINE:
+        return _canvas->lines;
+    case GP_SHAPE_TYPE_RECT:
+        return _canvas->rects;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        return _canvas->rounded_rects;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        return _canvas->ellipses;
+    default:
+        return GP_NULLPTR;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static const void * __primitive_next( const void * _primitive, gp_uint32_t _type )
+{
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_LINE:
+        return ((const gp_line_t *)_primitive)->next;
+    case GP_SHAPE_TYPE_RECT:
+        return ((const gp_rect_t *)_primitive)->next;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        return ((const gp_rounded_rect_t *)_primitive)->next;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        return ((const gp_ellipse_t *)_primitive)->next;
+    default:
+        return GP_NULLPTR;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t __line_hash( const gp_line_t * _line )
+{
+    gp_uint64_t hash = GP_HASH_OFFSET_BASIS;
+
+    const gp_line_point_t * p = _line->points;
+
+    gp_hash_line_point( &hash, p, GP_NULLPTR );
+
+    const gp_line_edge_t * e = _line->edges;
+
+    for( p = p->next; p != GP_NULLPTR; p = p->next, e = e->next )
+    {
+        gp_hash_line_point( &hash, p, e );
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t __primitive_hash( const void * _primitive, gp_uint32_t _type )
+{
+    gp_uint64_t hash = GP_HASH_OFFSET_BASIS;
+
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_LINE:
+        {
+            hash = __line_hash( (const gp_line_t *)_primitive );
+        }break;
+    default:
+        {
+            hash = gp_hash_shape( (gp_shape_type_e)_type, _primitive );
+        }break;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __frame_item_setup( gp_frame_item_t * _item, const void * _primitive, gp_uint32_t _type, gp_bool_t _identity )
+{
+    _item->visible = gp_spatial_shape_box( (gp_shape_type_e)_type, _primitive, &_item->box );
+    _item->hash = __primitive_hash( _primitive, _type );
+    _item->key = _identity == GP_TRUE ? (gp_uint64_t)(gp_size_t)_primitive : _item->hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __frame_items_merge( const gp_frame_item_t * _src, gp_frame_item_t * _dst, gp_uint32_t _begin, gp_uint32_t _middle, gp_uint32_t _end )
+{
+    gp_uint32_t left = _begin;
+    gp_uint32_t right = _middle;
+
+    for( gp_uint32_t index = _begin; index != _end; ++index )
+    {
+        if( left < _middle && (right >= _end || _src[left].key <= _src[right].key) )
+        {
+            _dst[index] = _src[left++];
+        }
+        else
+        {
+            _dst[index] = _src[right++];
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __frame_items_sort( gp_frame_item_t * _items, gp_frame_item_t * _temp, gp_uint32_t _count )
+{
+    gp_frame_item_t * src = _items;
+    gp_frame_item_t * dst = _temp;
+
+    for( gp_uint32_t width = 1; width < _count; width *= 2 )
+    {
+        for( gp_uint32_t begin = 0; begin < _count; begin += width * 2 )
+        {
+            gp_uint32_t middle = begin + width < _count ? begin + width : _count;
+            gp_uint32_t end = begin + width * 2 < _count ? begin + width * 2 : _count;
+
+            __frame_items_merge( src, dst, begin, middle, end );
+        }
+
+        gp_frame_item_t * swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if( src != _items )
+    {
+        for( gp_uint32_t index = 0; index != _count; ++index )
+        {
+            _items[index] = src[index];
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_frame_item_t * __frame_items_find( const gp_frame_item_t * _items, gp_uint32_t _count, gp_uint64_t _key )
+{
+    gp_uint32_t begin = 0;
+    gp_uint32_t end = _count;
+
+    while( begin != end )
+    {
+        gp_uint32_t middle = begin + (end - begin) / 2;
+
+        if( _items[middle].key < _key )
+        {
+            begin = middle + 1;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+
+    if( begin == _count || _items[begin].key != _key )
+    {
+        return GP_NULLPTR;
+    }
+
+    return _items + begin;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_dirty_frame_reset( gp_canvas_t * _canvas )
+{
+    _canvas->frame_items = GP_NULLPTR;
+    _canvas->frame_identity = GP_FALSE;
+
+    for( gp_uint32_t type = 0; type != GP_DIRTY_SHAPE_TYPE_COUNT; ++type )
+    {
+        _canvas->frame_counts[type] = 0;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_dirty_frame_free( gp_canvas_t * _canvas )
+{
+    if( _canvas->frame_items != GP_NULLPTR )
+    {
+        GP_FREE( _canvas, _canvas->frame_items );
+    }
+
+    gp_dirty_frame_reset( _canvas );
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_dirty_frame_capture( gp_canvas_t * _canvas, gp_bool_t _identity )
+{
+    gp_dirty_frame_free( _canvas );
+
+    _canvas->frame_identity = _identity;
+
+    gp_uint32_t item_count = 0;
+
+    for( gp_uint32_t type = 0; type != GP_DIRTY_SHAPE_TYPE_COUNT; ++type )
+    {
+        gp_uint32_t count = 0;
+
+        for( const void * p = __primitive_first( _canvas, type ); p != GP_NULLPTR; p = __primitive_next( p, type ) )
+        {
+            ++count;
+        }
+
+        _canvas->frame_counts[type] = count;
+
+        item_count += count;
+    }
+
+    if( item_count == 0 )
+    {
+        return;
+    }
+
+    gp_frame_item_t * items = (gp_frame_item_t *)(*_canvas->malloc)(sizeof( gp_frame_item_t ) * item_count, _canvas->ud);
+    gp_frame_item_t * temp = (gp_frame_item_t *)(*_canvas->malloc)(sizeof( gp_frame_item_t ) * item_count, _canvas->ud);
+
+    gp_frame_item_t * item = items;
+
+    for( gp_uint32_t type = 0; type != GP_DIRTY_SHAPE_TYPE_COUNT; ++type )
+    {
+        gp_frame_item_t * type_items = item;
+
+        for( const void * p = __primitive_first( _canvas, type ); p != GP_NULLPTR; p = __primitive_next( p, type ) )
+        {
+            __frame_item_setup( item++, p, type, _identity );
+        }
+
+        __frame_items_sort( type_items, temp, _canvas->frame_counts[type] );
+    }
+
+    GP_FREE( _canvas, temp );
+
+    _canvas->frame_items = items;
+}
+//////////////////////////////////////////////////////////////////////////
+static float __box_area( const gp_box_t * _box )
+{
+    return (_box->max_x - _box->min_x) * (_box->max_y - _box->min_y);
+}
+//////////////////////////////////////////////////////////////////////////
+static void __box_union( gp_box_t * _out, const gp_box_t * _a, const gp_box_t * _b )
+{
+    _out->min_x = _a->min_x < _b->min_x ? _a->min_x : _b->min_x;
+    _out->min_y = _a->min_y < _b->min_y ? _a->min_y : _b->min_y;
+    _out->max_x = _a->max_x > _b->max_x ? _a->max_x : _b->max_x;
+    _out->max_y = _a->max_y > _b->max_y ? _a->max_y : _b->max_y;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __box_contains( const gp_box_t * _a, const gp_box_t * _b )
+{
+    return _a->min_x <= _b->min_x && _a->min_y <= _b->min_y && _a->max_x >= _b->max_x && _a->max_y >= _b->max_y;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __dirty_merge_best( gp_dirty_set_t * _set )
+{
+    gp_uint32_t best_i = 0;
+    gp_uint32_t best_j = 1;
+    float best_cost = 0.f;
+
+    for( gp_uint32_t i = 0; i != _set->count; ++i )
+    {
+        for( gp_uint32_t j = i + 1; j != _set->count; ++j )
+        {
+            gp_box_t u;
+            __box_union( &u, _set->boxes + i, _set->boxes + j );
+
+            float cost = __box_area( &u ) - __box_area( _set->boxes + i ) - __box_area( _set->boxes + j );
+
+            if( (i == 0 && j == 1) || cost < best_cost )
+            {
+                best_i = i;
+                best_j = j;
+                best_cost = cost;
+            }
+        }
+    }
+
+    __box_union( _set->boxes + best_i, _set->boxes + best_i, _set->boxes + best_j );
+
+    _set->boxes[best_j] = _set->boxes[--_set->count];
+}
+//////////////////////////////////////////////////////////////////////////
+static void __dirty_add( gp_dirty_set_t * _set, const gp_box_t * _box )
+{
+    for( gp_uint32_t index = 0; index != _set->count; ++index )
+    {
+        if( __box_contains( _set->boxes + index, _box ) == GP_TRUE )
+        {
+            return;
+        }
+    }
+
+    _set->boxes[_set->count++] = *_box;
+
+    if( _set->count > _set->capacity )
+    {
+        __dirty_merge_best( _set );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __dirty_add_item( gp_dirty_set_t * _set, const gp_frame_item_t * _item )
+{
+    if( _item->visible == GP_FALSE )
+    {
+        return;
+    }
+
+    __dirty_add( _set, &_item->box );
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_capture_frame( gp_canvas_t * _canvas )
+{
+    gp_dirty_frame_capture( _canvas, GP_TRUE );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_get_dirty_rects( const gp_canvas_t * _canvas, gp_dirty_rect_t * _rects, gp_uint32_t _capacity, gp_uint32_t * _count )
+{
+#if defined(GP_VALIDATION)
+    if( _capacity == 0 )
+    {
+        gp_validation_report( _canvas, "gp_canvas_get_dirty_rects: capacity must be positive" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    if( _capacity == 0 )
+    {
+        *_count = 0;
+
+        return GP_SUCCESSFUL;
+    }
+
+    gp_uint32_t frame_total = 0;
+    gp_uint32_t item_total = 0;
+
+    for( gp_uint32_t type = 0; type != GP_DIRTY_SHAPE_TYPE_COUNT; ++type )
+    {
+        frame_total += _canvas->frame_counts[type];
+
+        for( const void * p = __primitive_first( _canvas, type ); p != GP_NULLPTR; p = __primitive_next( p, type ) )
+        {
+            ++item_total;
+        }
+    }
+
+    gp_dirty_set_t set;
+    set.boxes = (gp_box_t *)(*_canvas->malloc)(sizeof( gp_box_t ) * (_capacity + 1), _canvas->ud);
+    set.count = 0;
+    set.capacity = _capacity;
+
+    gp_frame_item_t * added = (gp_frame_item_t *)(*_canvas->malloc)(sizeof( gp_frame_item_t ) * (item_total + 1), _canvas->ud);
+    gp_uint8_t * matched = (gp_uint8_t *)(*_canvas->malloc)(sizeof( gp_uint8_t ) * (frame_total + 1), _canvas->ud);
+
+    for( gp_uint32_t index = 0; index != frame_total; ++index )
+    {
+        matched[index] = 0;
+    }
+
+    gp_uint32_t added_count = 0;
+
+    const gp_frame_item_t * frame_items = _canvas->frame_items;
+    gp_uint8_t * frame_matched = matched;
+
+    for( gp_uint32_t type = 0; type != GP_DIRTY_SHAPE_TYPE_COUNT; ++type )
+    {
+        gp_uint32_t frame_count = _canvas->frame_counts[type];
+
+        for( const void * p = __primitive_first( _canvas, type ); p != GP_NULLPTR; p = __primitive_next( p, type ) )
+        {
+            gp_frame_item_t item;
+            __frame_item_setup( &item, p, type, _canvas->frame_identity );
+
+            const gp_frame_item_t * frame_item = __frame_items_find( frame_items, frame_count, item.key );
+
+            while( frame_item != GP_NULLPTR && frame_matched[frame_item - frame_items] != 0 )
+            {
+                ++frame_item;
+
+                if( frame_item == frame_items + frame_count || frame_item->key != item.key )
+                {
+                    frame_item = GP_NULLPTR;
+                }
+            }
+
+            if( frame_item == GP_NULLPTR )
+            {
+                added[added_count++] = item;
+
+                continue;
+            }
+
+            frame_matched[frame_item - frame_items] = 1;
+
+            if( frame_item->hash == item.hash )
+            {
+                continue;
+            }
+
+            __dirty_add_item( &set, frame_item );
+            __dirty_add_item( &set, &item );
+        }
+
+        frame_items += frame_count;
+        frame_matched += frame_count;
+    }
+
+    for( gp_uint32_t index = 0; index != frame_total; ++index )
+    {
+        if( matched[index] != 0 )
+        {
+            continue;
+        }
+
+        __dirty_add_item( &set, _canvas->frame_items + index );
+    }
+
+    for( gp_uint32_t index = 0; index != added_count; ++index )
+    {
+        __dirty_add_item( &set, added + index );
+    }
+
+    for( gp_uint32_t index = 0; index != set.count; ++index )
+    {
+        const gp_box_t * box = set.boxes + index;
+
+        gp_dirty_rect_t * rect = _rects + index;
+
+        rect->x = box->min_x;
+        rect->y = box->min_y;
+        rect->width = box->max_x - box->min_x;
+        rect->height = box->max_y - box->min_y;
+    }
+
+    *_count = set.count;
+
+    GP_FREE( _canvas, matched );
+    GP_FREE( _canvas, added );
+    GP_FREE( _canvas, set.boxes );
+
+    return GP_SUCCESSFUL;
+}
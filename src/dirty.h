@@ -0,0 +1,12 @@
+#ifndef GP_DIRTY_H_
+#define GP_DIRTY_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+void gp_dirty_frame_reset( gp_canvas_t * _canvas );
+void gp_dirty_frame_free( gp_canvas_t * _canvas );
+void gp_dirty_frame_capture( gp_canvas_t * _canvas, gp_bool_t _identity );
+
+#endif
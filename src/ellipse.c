@@ -1,74 +1,351 @@
 #include "ellipse.h"
+#include "sdf.h"
 
 #include "detail.h"
 #include "struct.h"
 
 //////////////////////////////////////////////////////////////////////////
-static gp_result_t __calculate_mesh_ellipse_size( const gp_canvas_t * _canvas, gp_uint16_t * _vertex_count, gp_uint16_t * _index_count )
+static gp_uint16_t __arc_segments( const gp_ellipse_t * _ellipse )
 {
-    gp_uint16_t vertex_count = 0;
-    gp_uint16_t index_count = 0;
+    float sweep = _ellipse->angle_sweep < 0.f ? -_ellipse->angle_sweep : _ellipse->angle_sweep;
 
-    for( const gp_ellipse_t * e = _canvas->ellipses; e != GP_NULLPTR; e = e->next )
+    float segments = -GP_MATH_FLOORF( -sweep * (float)_ellipse->state->ellipse_quality / gp_constant_two_pi );
+
+    if( segments < 1.f )
     {
-        uint8_t ellipse_quality = e->state->ellipse_quality;
+        return 1;
+    }
+
+    return (gp_uint16_t)segments;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_ellipse_trig_t
+{
+    gp_uint8_t quality;
+    float cos[256];
+    float sin[256];
+} gp_ellipse_trig_t;
+//////////////////////////////////////////////////////////////////////////
+static const gp_ellipse_trig_t * __ellipse_trig( gp_ellipse_trig_t * _trig, const gp_state_t * _state )
+{
+    gp_uint8_t ellipse_quality = _state->ellipse_quality;
 
-        if( e->state->fill == GP_TRUE )
+    if( _trig->quality == ellipse_quality )
+    {
+        return _trig;
+    }
+
+    float dt = gp_constant_two_pi * _state->ellipse_quality_inv;
+
+    float t = 0.f;
+
+    for( gp_uint32_t index = 0; index != ellipse_quality; ++index, t += dt )
+    {
+        _trig->cos[index] = GP_MATH_COSF( t );
+        _trig->sin[index] = GP_MATH_SINF( t );
+    }
+
+    _trig->quality = ellipse_quality;
+
+    return _trig;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_calculate_ellipse_size( const gp_ellipse_t * _ellipse, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count )
+{
+    const gp_state_t * state = _ellipse->state;
+
+    if( gp_ellipse_is_arc( _ellipse ) == GP_TRUE )
+    {
+        gp_uint16_t segments = __arc_segments( _ellipse );
+        gp_uint16_t stations = segments + 1;
+
+        if( state->fill == GP_TRUE )
         {
-            if( e->state->penumbra > 0.f )
+            if( state->penumbra > 0.f )
             {
-                vertex_count += ellipse_quality;
-                index_count += ellipse_quality * 6;
+                *_vertex_count += 1 + stations * 2;
+                *_index_count += segments * 9;
+            }
+            else
+            {
+                *_vertex_count += 1 + stations;
+                *_index_count += segments * 3;
             }
-
-            vertex_count += 1;
-            vertex_count += ellipse_quality;
-            index_count += ellipse_quality * 3;
         }
         else
         {
-            if( e->state->penumbra > 0.f )
+            if( state->penumbra > 0.f )
             {
-                vertex_count += ellipse_quality * 4;
-                index_count += ellipse_quality * 18;
+                *_vertex_count += stations * 4;
+                *_index_count += segments * 18;
             }
             else
             {
-                vertex_count += ellipse_quality * 2;
-                index_count += ellipse_quality * 6;
+                *_vertex_count += stations * 2;
+                *_index_count += segments * 6;
             }
         }
+
+        return;
     }
 
-    *_vertex_count = vertex_count;
-    *_index_count = index_count;
+    if( state->sdf == GP_TRUE )
+    {
+        *_vertex_count += 4;
+        *_index_count += 6;
 
-    return GP_SUCCESSFUL;
+        return;
+    }
+
+    uint8_t ellipse_quality = state->ellipse_quality;
+
+    if( state->fill == GP_TRUE )
+    {
+        if( state->penumbra > 0.f )
+        {
+            *_vertex_count += ellipse_quality;
+            *_index_count += ellipse_quality * 6;
+        }
+
+        *_vertex_count += 1;
+        *_vertex_count += ellipse_quality;
+        *_index_count += ellipse_quality * 3;
+    }
+    else
+    {
+        if( state->penumbra > 0.f )
+        {
+            *_vertex_count += ellipse_quality * 4;
+            *_index_count += ellipse_quality * 18;
+        }
+        else
+        {
+            *_vertex_count += ellipse_quality * 2;
+            *_index_count += ellipse_quality * 6;
+        }
+    }
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_calculate_mesh_ellipse_size( const gp_canvas_t * _canvas, gp_mesh_t * _mesh )
+static void __render_arc( const gp_mesh_t * _mesh, const gp_ellipse_t * _ellipse, gp_argb_t _argb, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator )
 {
-    gp_uint16_t vertex_count;
-    gp_uint16_t index_count;
+    gp_uint16_t vertex_iterator = *_vertex_iterator;
+    gp_uint16_t index_iterator = *_index_iterator;
 
-    GP_CALL( __calculate_mesh_ellipse_size, (_canvas, &vertex_count, &index_count) );
+    const gp_state_t * state = _ellipse->state;
 
-    _mesh->vertex_count += vertex_count;
-    _mesh->index_count += index_count;
+    gp_uint16_t segments = __arc_segments( _ellipse );
 
-    return GP_SUCCESSFUL;
+    gp_argb_t argb_soft = gp_mesh_color_transparent( _mesh, _argb );
+
+    float line_penumbra = state->penumbra;
+
+    float half_thickness = state->thickness * 0.5f;
+    float line_half_thickness_soft = half_thickness - line_penumbra;
+
+    float cx = _ellipse->point.x;
+    float cy = _ellipse->point.y;
+
+    float rx = _ellipse->radius_width;
+    float ry = _ellipse->radius_height;
+
+    float total_width = rx * 2.f + state->thickness;
+    float total_height = ry * 2.f + state->thickness;
+
+    float u_offset = -(cx - rx - half_thickness);
+    float v_offset = -(cy - ry - half_thickness);
+
+    float dt = _ellipse->angle_sweep / (float)segments;
+
+    float cdt = GP_MATH_COSF( dt );
+    float sdt = GP_MATH_SINF( dt );
+
+    float ct = GP_MATH_COSF( _ellipse->angle_start );
+    float st = GP_MATH_SINF( _ellipse->angle_start );
+
+    if( state->fill == GP_TRUE )
+    {
+        gp_uint16_t center = vertex_iterator;
+
+        gp_mesh_push_position( _mesh, center, cx, cy );
+        gp_mesh_push_fill_color( state, _mesh, center, cx, cy, _argb );
+        gp_mesh_push_uv_map( state, _mesh, center, cx, cy, u_offset, v_offset, total_width, total_height );
+
+        vertex_iterator += 1;
+
+        gp_uint16_t rim = line_penumbra > 0.f ? 2 : 1;
+
+        for( gp_uint16_t index = 0; index != segments; ++index )
+        {
+            gp_uint16_t v0 = center + 1 + index * rim;
+            gp_uint16_t v1 = v0 + rim;
+
+            if( line_penumbra > 0.f )
+            {
+                gp_mesh_push_index( _mesh, index_iterator + 0, v0 + 0 );
+                gp_mesh_push_index( _mesh, index_iterator + 1, v0 + 1 );
+                gp_mesh_push_index( _mesh, index_iterator + 2, v1 + 0 );
+                gp_mesh_push_index( _mesh, index_iterator + 3, v1 + 0 );
+                gp_mesh_push_index( _mesh, index_iterator + 4, v0 + 1 );
+                gp_mesh_push_index( _mesh, index_iterator + 5, v1 + 1 );
+
+                index_iterator += 6;
+
+                v0 += 1;
+                v1 += 1;
+            }
+
+            gp_mesh_push_index( _mesh, index_iterator + 0, v0 );
+            gp_mesh_push_index( _mesh, index_iterator + 1, v1 );
+            gp_mesh_push_index( _mesh, index_iterator + 2, center );
+
+            index_iterator += 3;
+        }
+
+        for( gp_uint16_t index = 0; index != segments + 1; ++index )
+        {
+            float x = cx + (rx + half_thickness) * ct;
+            float y = cy + (ry + half_thickness) * st;
+
+            if( line_penumbra > 0.f )
+            {
+                float x_soft = cx + (rx + line_half_thickness_soft) * ct;
+                float y_soft = cy + (ry + line_half_thickness_soft) * st;
+
+                gp_mesh_push_position( _mesh, vertex_iterator + 0, x, y );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 0, x, y, argb_soft );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 0, x, y, u_offset, v_offset, total_width, total_height );
+
+                gp_mesh_push_position( _mesh, vertex_iterator + 1, x_soft, y_soft );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 1, x_soft, y_soft, _argb );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 1, x_soft, y_soft, u_offset, v_offset, total_width, total_height );
+
+                vertex_iterator += 2;
+            }
+            else
+            {
+                gp_mesh_push_position( _mesh, vertex_iterator + 0, x, y );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 0, x, y, _argb );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 0, x, y, u_offset, v_offset, total_width, total_height );
+
+                vertex_iterator += 1;
+            }
+
+            float c = ct * cdt - st * sdt;
+            st = st * cdt + ct * sdt;
+            ct = c;
+        }
+    }
+    else
+    {
+        gp_uint16_t ring = line_penumbra > 0.f ? 4 : 2;
+
+        for( gp_uint16_t index = 0; index != segments; ++index )
+        {
+            gp_uint16_t v0 = vertex_iterator + index * ring;
+            gp_uint16_t v1 = v0 + ring;
+
+            for( gp_uint16_t band = 0; band != ring - 1; ++band )
+            {
+                gp_mesh_push_index( _mesh, index_iterator + 0, v0 + band + 0 );
+                gp_mesh_push_index( _mesh, index_iterator + 1, v0 + band + 1 );
+                gp_mesh_push_index( _mesh, index_iterator + 2, v1 + band + 0 );
+                gp_mesh_push_index( _mesh, index_iterator + 3, v1 + band + 0 );
+                gp_mesh_push_index( _mesh, index_iterator + 4, v0 + band + 1 );
+                gp_mesh_push_index( _mesh, index_iterator + 5, v1 + band + 1 );
+
+                index_iterator += 6;
+            }
+        }
+
+        for( gp_uint16_t index = 0; index != segments + 1; ++index )
+        {
+            float x0 = cx + (rx + half_thickness) * ct;
+            float y0 = cy + (ry + half_thickness) * st;
+
+            float x1 = cx + (rx - half_thickness) * ct;
+            float y1 = cy + (ry - half_thickness) * st;
+
+            if( line_penumbra > 0.f )
+            {
+                float x0_soft = cx + (rx + line_half_thickness_soft) * ct;
+                float y0_soft = cy + (ry + line_half_thickness_soft) * st;
+
+                float x1_soft = cx + (rx - line_half_thickness_soft) * ct;
+                float y1_soft = cy + (ry - line_half_thickness_soft) * st;
+
+                gp_mesh_push_position( _mesh, vertex_iterator + 0, x0, y0 );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 0, x0, y0, argb_soft );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 0, x0, y0, u_offset, v_offset, total_width, total_height );
+
+                gp_mesh_push_position( _mesh, vertex_iterator + 1, x0_soft, y0_soft );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 1, x0_soft, y0_soft, _argb );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 1, x0_soft, y0_soft, u_offset, v_offset, total_width, total_height );
+
+                gp_mesh_push_position( _mesh, vertex_iterator + 2, x1_soft, y1_soft );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 2, x1_soft, y1_soft, _argb );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 2, x1_soft, y1_soft, u_offset, v_offset, total_width, total_height );
+
+                gp_mesh_push_position( _mesh, vertex_iterator + 3, x1, y1 );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 3, x1, y1, argb_soft );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 3, x1, y1, u_offset, v_offset, total_width, total_height );
+
+                vertex_iterator += 4;
+            }
+            else
+            {
+                gp_mesh_push_position( _mesh, vertex_iterator + 0, x0, y0 );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 0, x0, y0, _argb );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 0, x0, y0, u_offset, v_offset, total_width, total_height );
+
+                gp_mesh_push_position( _mesh, vertex_iterator + 1, x1, y1 );
+                gp_mesh_push_fill_color( state, _mesh, vertex_iterator + 1, x1, y1, _argb );
+                gp_mesh_push_uv_map( state, _mesh, vertex_iterator + 1, x1, y1, u_offset, v_offset, total_width, total_height );
+
+                vertex_iterator += 2;
+            }
+
+            float c = ct * cdt - st * sdt;
+            st = st * cdt + ct * sdt;
+            ct = c;
+        }
+    }
+
+    *_vertex_iterator = vertex_iterator;
+    *_index_iterator = index_iterator;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator )
+gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator, gp_uint32_t * _range_iterator )
 {
     gp_uint16_t vertex_iterator = *_vertex_iterator;
     gp_uint16_t index_iterator = *_index_iterator;
 
+    gp_ellipse_trig_t trig;
+    trig.quality = 0;
+
     for( const gp_ellipse_t * e = _canvas->ellipses; e != GP_NULLPTR; e = e->next )
     {
-        gp_color_t total_color;
-        gp_color_mul( &total_color, &_mesh->color, &e->state->color );
-        gp_argb_t argb = gp_color_argb( &total_color );
+        gp_mesh_push_range( _mesh, _range_iterator, e->state, index_iterator );
+
+        if( gp_ellipse_is_arc( e ) == GP_TRUE )
+        {
+            gp_argb_t argb = gp_mesh_color( _mesh, gp_color_fill_argb( &_mesh->color, e->state ) );
+
+            __render_arc( _mesh, e, argb, &vertex_iterator, &index_iterator );
+
+            continue;
+        }
+
+        if( e->state->sdf == GP_TRUE )
+        {
+            gp_sdf_type_e type = e->state->fill == GP_TRUE ? GP_SDF_TYPE_ELLIPSE_FILL : GP_SDF_TYPE_ELLIPSE_STROKE;
+
+            GP_CALL( gp_render_sdf_quad, (_canvas, _mesh, e->state, e->point, e->radius_width, e->radius_height, 0.f, type, &vertex_iterator, &index_iterator) );
+
+            continue;
+        }
+
+        gp_argb_t argb = gp_mesh_color( _mesh, gp_color_fill_argb( &_mesh->color, e->state ) );
+        gp_argb_t argb_soft = gp_mesh_color_transparent( _mesh, argb );
 
         gp_uint8_t ellipse_quality = e->state->ellipse_quality;
         float line_penumbra = e->state->penumbra;
@@ -82,9 +359,7 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
         float u_offset = -(e->point.x - e->radius_width - half_thickness);
         float v_offset = -(e->point.y - e->radius_height - half_thickness);
 
-        float ellipse_quality_inv = e->state->ellipse_quality_inv;
-
-        float dt = gp_constant_two_pi * ellipse_quality_inv;
+        const gp_ellipse_trig_t * table = __ellipse_trig( &trig, e->state );
 
         if( e->state->fill == GP_FALSE )
         {
@@ -96,40 +371,38 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
 
                 for( gp_uint16_t index = 0; index != ellipse_quality; ++index )
                 {
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + (index * 4 + 0) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + (index * 4 + 1) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + (index * 4 + 4) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + (index * 4 + 4) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + (index * 4 + 1) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + (index * 4 + 5) % ellipse_quality2) );
+                    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + (index * 4 + 0) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + (index * 4 + 1) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator + (index * 4 + 4) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 3, vertex_iterator + (index * 4 + 4) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 4, vertex_iterator + (index * 4 + 1) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 5, vertex_iterator + (index * 4 + 5) % ellipse_quality2 );
 
                     index_iterator += 6;
 
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + (index * 4 + 1) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + (index * 4 + 2) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + (index * 4 + 5) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + (index * 4 + 5) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + (index * 4 + 2) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + (index * 4 + 6) % ellipse_quality2) );
+                    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + (index * 4 + 1) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + (index * 4 + 2) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator + (index * 4 + 5) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 3, vertex_iterator + (index * 4 + 5) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 4, vertex_iterator + (index * 4 + 2) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 5, vertex_iterator + (index * 4 + 6) % ellipse_quality2 );
 
                     index_iterator += 6;
 
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + (index * 4 + 2) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + (index * 4 + 3) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + (index * 4 + 6) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + (index * 4 + 6) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + (index * 4 + 3) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + (index * 4 + 7) % ellipse_quality2) );
+                    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + (index * 4 + 2) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + (index * 4 + 3) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator + (index * 4 + 6) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 3, vertex_iterator + (index * 4 + 6) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 4, vertex_iterator + (index * 4 + 3) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 5, vertex_iterator + (index * 4 + 7) % ellipse_quality2 );
 
                     index_iterator += 6;
                 }
 
-                float t = 0.f;
-
-                for( gp_uint32_t index = 0; index != ellipse_quality; ++index, t += dt )
+                for( gp_uint32_t index = 0; index != ellipse_quality; ++index )
                 {
-                    float ct = GP_MATH_COSF( t );
-                    float st = GP_MATH_SINF( t );
+                    float ct = table->cos[index];
+                    float st = table->sin[index];
 
                     float x0 = e->point.x + (e->radius_width + half_thickness) * ct;
                     float y0 = e->point.y + (e->radius_height + half_thickness) * st;
@@ -143,21 +416,21 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
                     float x1_soft = e->point.x + (e->radius_width - line_half_thickness_soft) * ct;
                     float y1_soft = e->point.y + (e->radius_height - line_half_thickness_soft) * st;
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, x0, y0) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb & 0x00ffffff) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 0, x0, y0, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 0, x0, y0 );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 0, x0, y0, argb_soft );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 0, x0, y0, u_offset, v_offset, total_width, total_height );
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, x0_soft, y0_soft) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 1, x0_soft, y0_soft, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 1, x0_soft, y0_soft );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 1, x0_soft, y0_soft, argb );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 1, x0_soft, y0_soft, u_offset, v_offset, total_width, total_height );
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 2, x1_soft, y1_soft) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 2, argb) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 2, x1_soft, y1_soft, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 2, x1_soft, y1_soft );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 2, x1_soft, y1_soft, argb );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 2, x1_soft, y1_soft, u_offset, v_offset, total_width, total_height );
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 3, x1, y1) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 3, argb & 0x00ffffff) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 3, x1, y1, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 3, x1, y1 );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 3, x1, y1, argb_soft );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 3, x1, y1, u_offset, v_offset, total_width, total_height );
 
                     vertex_iterator += 4;
                 }
@@ -168,22 +441,20 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
 
                 for( gp_uint16_t index = 0; index != ellipse_quality; ++index )
                 {
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + (index * 2 + 0) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + (index * 2 + 1) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + (index * 2 + 2) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + (index * 2 + 2) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + (index * 2 + 1) % ellipse_quality2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + (index * 2 + 3) % ellipse_quality2) );
+                    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + (index * 2 + 0) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + (index * 2 + 1) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator + (index * 2 + 2) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 3, vertex_iterator + (index * 2 + 2) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 4, vertex_iterator + (index * 2 + 1) % ellipse_quality2 );
+                    gp_mesh_push_index( _mesh, index_iterator + 5, vertex_iterator + (index * 2 + 3) % ellipse_quality2 );
 
                     index_iterator += 6;
                 }
 
-                float t = 0.f;
-
-                for( gp_uint32_t index = 0; index != ellipse_quality; ++index, t += dt )
+                for( gp_uint32_t index = 0; index != ellipse_quality; ++index )
                 {
-                    float ct = GP_MATH_COSF( t );
-                    float st = GP_MATH_SINF( t );
+                    float ct = table->cos[index];
+                    float st = table->sin[index];
 
                     float x0 = e->point.x + (e->radius_width + half_thickness) * ct;
                     float y0 = e->point.y + (e->radius_height + half_thickness) * st;
@@ -191,13 +462,13 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
                     float x1 = e->point.x + (e->radius_width - half_thickness) * ct;
                     float y1 = e->point.y + (e->radius_height - half_thickness) * st;
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, x0, y0) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 0, x0, y0, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 0, x0, y0 );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 0, x0, y0, argb );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 0, x0, y0, u_offset, v_offset, total_width, total_height );
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, x1, y1) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 1, x1, y1, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 1, x1, y1 );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 1, x1, y1, argb );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 1, x1, y1, u_offset, v_offset, total_width, total_height );
 
                     vertex_iterator += 2;
                 }
@@ -213,37 +484,35 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
 
                 for( gp_uint16_t index = 0; index != ellipse_quality; ++index )
                 {
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + (index * 2 + 0) % ellipse_quality2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + (index * 2 + 1) % ellipse_quality2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + (index * 2 + 2) % ellipse_quality2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + (index * 2 + 2) % ellipse_quality2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + (index * 2 + 1) % ellipse_quality2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + (index * 2 + 3) % ellipse_quality2 + 1) );
+                    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + (index * 2 + 0) % ellipse_quality2 + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + (index * 2 + 1) % ellipse_quality2 + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator + (index * 2 + 2) % ellipse_quality2 + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 3, vertex_iterator + (index * 2 + 2) % ellipse_quality2 + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 4, vertex_iterator + (index * 2 + 1) % ellipse_quality2 + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 5, vertex_iterator + (index * 2 + 3) % ellipse_quality2 + 1 );
 
                     index_iterator += 6;
                 }
 
                 for( gp_uint16_t index = 0; index != ellipse_quality; ++index )
                 {
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + (index * 2 + 1) % ellipse_quality2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + (index * 2 + 3) % ellipse_quality2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator) );
+                    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + (index * 2 + 1) % ellipse_quality2 + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + (index * 2 + 3) % ellipse_quality2 + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator );
 
                     index_iterator += 3;
                 }
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, e->point.x, e->point.y) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb) );
-                GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 0, e->point.x, e->point.y, u_offset, v_offset, total_width, total_height) );
+                gp_mesh_push_position( _mesh, vertex_iterator + 0, e->point.x, e->point.y );
+                gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 0, e->point.x, e->point.y, argb );
+                gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 0, e->point.x, e->point.y, u_offset, v_offset, total_width, total_height );
 
                 vertex_iterator += 1;
 
-                float t = 0.f;
-
-                for( gp_uint32_t index = 0; index != ellipse_quality; ++index, t += dt )
+                for( gp_uint32_t index = 0; index != ellipse_quality; ++index )
                 {
-                    float ct = GP_MATH_COSF( t );
-                    float st = GP_MATH_SINF( t );
+                    float ct = table->cos[index];
+                    float st = table->sin[index];
 
                     float x = e->point.x + (e->radius_width + half_thickness) * ct;
                     float y = e->point.y + (e->radius_height + half_thickness) * st;
@@ -251,13 +520,13 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
                     float x_soft = e->point.x + (e->radius_width + line_half_thickness_soft) * ct;
                     float y_soft = e->point.y + (e->radius_height + line_half_thickness_soft) * st;
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, x, y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb & 0x00ffffff) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 0, x, y, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 0, x, y );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 0, x, y, argb_soft );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 0, x, y, u_offset, v_offset, total_width, total_height );
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, x_soft, y_soft) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 1, x_soft, y_soft, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 1, x_soft, y_soft );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 1, x_soft, y_soft, argb );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 1, x_soft, y_soft, u_offset, v_offset, total_width, total_height );
 
                     vertex_iterator += 2;
                 }
@@ -266,32 +535,30 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
             {
                 for( gp_uint16_t index = 0; index != ellipse_quality; ++index )
                 {
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + (index + 0) % ellipse_quality + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + (index + 1) % ellipse_quality + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator) );
+                    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + (index + 0) % ellipse_quality + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + (index + 1) % ellipse_quality + 1 );
+                    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator );
 
                     index_iterator += 3;
                 }
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, e->point.x, e->point.y) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb) );
-                GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 0, e->point.x, e->point.y, u_offset, v_offset, total_width, total_height) );
+                gp_mesh_push_position( _mesh, vertex_iterator + 0, e->point.x, e->point.y );
+                gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 0, e->point.x, e->point.y, argb );
+                gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 0, e->point.x, e->point.y, u_offset, v_offset, total_width, total_height );
 
                 vertex_iterator += 1;
 
-                float t = 0.f;
-
-                for( gp_uint32_t index = 0; index != ellipse_quality; ++index, t += dt )
+                for( gp_uint32_t index = 0; index != ellipse_quality; ++index )
                 {
-                    float ct = GP_MATH_COSF( t );
-                    float st = GP_MATH_SINF( t );
+                    float ct = table->cos[index];
+                    float st = table->sin[index];
 
                     float x = e->point.x + (e->radius_width + half_thickness) * ct;
                     float y = e->point.y + (e->radius_height + half_thickness) * st;
 
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, x, y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb) );
-                    GP_CALL( gp_mesh_push_uv_map, (_canvas, _mesh, vertex_iterator + 0, x, y, u_offset, v_offset, total_width, total_height) );
+                    gp_mesh_push_position( _mesh, vertex_iterator + 0, x, y );
+                    gp_mesh_push_fill_color( e->state, _mesh, vertex_iterator + 0, x, y, argb );
+                    gp_mesh_push_uv_map( e->state, _mesh, vertex_iterator + 0, x, y, u_offset, v_offset, total_width, total_height );
 
                     vertex_iterator += 1;
                 }
@@ -299,26 +566,6 @@ gp_result_t gp_render_ellipse( const gp_canvas_t * _canvas, const gp_mesh_t * _m
         }
     }
 
-#if defined(GP_DEBUG)
-    gp_uint16_t test_vertex_count;
-    gp_uint16_t test_index_count;
-
-    if( __calculate_mesh_ellipse_size( _canvas, &test_vertex_count, &test_index_count ) == GP_FAILURE )
-    {
-        return GP_FAILURE;
-    }
-
-    if( test_vertex_count != vertex_iterator - *_vertex_iterator )
-    {
-        return GP_FAILURE;
-    }
-
-    if( test_index_count != index_iterator - *_index_iterator )
-    {
-        return GP_FAILURE;
-    }
-#endif
-
     * _vertex_iterator = vertex_iterator;
     *_index_iterator = index_iterator;
 
@@ -4,6 +4,14 @@
 #include "rect.h"
 #include "rounded_rect.h"
 #include "ellipse.h"
+#include "sdf.h"
+#include "hash.h"
+#include "spatial.h"
+#include "dirty.h"
+#include "split.h"
+#include "validate.h"
+#include "handle.h"
+#include "size.h"
 
 #include "struct.h"
 #include "detail.h"
@@ -24,6 +32,11 @@ float gp_get_default_outline_width( void )
     return 0.f;
 }
 //////////////////////////////////////////////////////////////////////////
+float gp_get_default_miter_limit( void )
+{
+    return 4.f;
+}
+//////////////////////////////////////////////////////////////////////////
 gp_uint8_t gp_get_default_curve_quality( void )
 {
     return 32;
@@ -42,9 +55,14 @@ gp_uint8_t gp_get_default_rect_quality( void )
 static void __canvas_default_state_setup( gp_canvas_t * _canvas )
 {
     _canvas->state_cook[0].fill = GP_FALSE;
+    _canvas->state_cook[0].sdf = GP_FALSE;
     _canvas->state_cook[0].thickness = gp_get_default_thickness();
     _canvas->state_cook[0].outline_width = 0.f;
     _canvas->state_cook[0].penumbra = gp_get_default_penumbra();
+    _canvas->state_cook[0].line_join = GP_LINE_JOIN_MITER;
+    _canvas->state_cook[0].miter_limit = gp_get_default_miter_limit();
+    _canvas->state_cook[0].dash_count = 0;
+    _canvas->state_cook[0].dash_offset = 0.f;
     _canvas->state_cook[0].color.r = 1.f;
     _canvas->state_cook[0].color.g = 1.f;
     _canvas->state_cook[0].color.b = 1.f;
@@ -53,10 +71,19 @@ static void __canvas_default_state_setup( gp_canvas_t * _canvas )
     _canvas->state_cook[0].outline_color.g = 1.f;
     _canvas->state_cook[0].outline_color.b = 1.f;
     _canvas->state_cook[0].outline_color.a = 1.f;
+    _canvas->state_cook[0].gradient = GP_GRADIENT_NONE;
+    _canvas->state_cook[0].gradient_x0 = 0.f;
+    _canvas->state_cook[0].gradient_y0 = 0.f;
+    _canvas->state_cook[0].gradient_x1 = 0.f;
+    _canvas->state_cook[0].gradient_y1 = 0.f;
+    _canvas->state_cook[0].gradient_radius = 0.f;
+    _canvas->state_cook[0].gradient_stop_count = 0;
     _canvas->state_cook[0].uv_ou = 0.f;
     _canvas->state_cook[0].uv_ov = 0.f;
     _canvas->state_cook[0].uv_su = 1.f;
     _canvas->state_cook[0].uv_sv = 1.f;
+    _canvas->state_cook[0].material = 0;
+    _canvas->state_cook[0].blend = GP_TRUE;
     _canvas->state_cook[0].curve_quality = gp_get_default_curve_quality();
     _canvas->state_cook[0].ellipse_quality = gp_get_default_ellipse_quality();
     _canvas->state_cook[0].rect_quality = gp_get_default_rect_quality();
@@ -67,6 +94,14 @@ static void __canvas_default_state_setup( gp_canvas_t * _canvas )
     _canvas->state_cook[0].prev = GP_NULLPTR;
 }
 //////////////////////////////////////////////////////////////////////////
+static void __canvas_hash_reset( gp_canvas_t * _canvas )
+{
+    _canvas->hash_lines = GP_HASH_OFFSET_BASIS;
+    _canvas->hash_rects = GP_HASH_OFFSET_BASIS;
+    _canvas->hash_rounded_rects = GP_HASH_OFFSET_BASIS;
+    _canvas->hash_ellipses = GP_HASH_OFFSET_BASIS;
+}
+//////////////////////////////////////////////////////////////////////////
 gp_result_t gp_canvas_create( gp_canvas_t ** _canvas, gp_malloc_t _malloc, gp_realloc_t _realloc, gp_free_t _free, void * _ud )
 {
     gp_canvas_t * canvas = (gp_canvas_t *)(*_malloc)(sizeof( gp_canvas_t ), _ud);
@@ -80,6 +115,19 @@ gp_result_t gp_canvas_create( gp_canvas_t ** _canvas, gp_malloc_t _malloc, gp_re
     canvas->rounded_rects = GP_NULLPTR;
     canvas->ellipses = GP_NULLPTR;
 
+    __canvas_hash_reset( canvas );
+
+    gp_mesh_size_reset( canvas );
+
+    gp_spatial_index_reset( &canvas->index );
+
+    gp_dirty_frame_reset( canvas );
+
+    gp_handle_table_reset( canvas );
+
+    canvas->validation = GP_NULLPTR;
+    canvas->validation_ud = GP_NULLPTR;
+
     __canvas_default_state_setup( canvas );
 
     canvas->malloc = _malloc;
@@ -92,16 +140,7 @@ gp_result_t gp_canvas_create( gp_canvas_t ** _canvas, gp_malloc_t _malloc, gp_re
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_canvas_destroy( gp_canvas_t * _canvas )
-{
-    gp_canvas_clear( _canvas );
-
-    GP_FREE( _canvas, _canvas );
-
-    return GP_SUCCESSFUL;
-}
-//////////////////////////////////////////////////////////////////////////
-gp_result_t gp_canvas_clear( gp_canvas_t * _canvas )
+static void __canvas_release( gp_canvas_t * _canvas )
 {
     GP_LIST_DESTROY( _canvas, gp_state_t, _canvas->states );
 
@@ -116,6 +155,34 @@ gp_result_t gp_canvas_clear( gp_canvas_t * _canvas )
     GP_LIST_DESTROY( _canvas, gp_rounded_rect_t, _canvas->rounded_rects );
     GP_LIST_DESTROY( _canvas, gp_ellipse_t, _canvas->ellipses );
 
+    gp_spatial_index_free( _canvas );
+
+    gp_handle_table_retire( _canvas );
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_destroy( gp_canvas_t * _canvas )
+{
+    __canvas_release( _canvas );
+
+    gp_handle_table_free( _canvas );
+
+    gp_dirty_frame_free( _canvas );
+
+    GP_FREE( _canvas, _canvas );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_clear( gp_canvas_t * _canvas )
+{
+    gp_dirty_frame_capture( _canvas, GP_FALSE );
+
+    __canvas_release( _canvas );
+
+    __canvas_hash_reset( _canvas );
+
+    gp_mesh_size_reset( _canvas );
+
     _canvas->state_stack = 0;
     _canvas->state_invalidate = GP_TRUE;
 
@@ -124,6 +191,69 @@ gp_result_t gp_canvas_clear( gp_canvas_t * _canvas )
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_get_hash( const gp_canvas_t * _canvas, gp_uint64_t * _hash )
+{
+    gp_uint64_t hash = GP_HASH_OFFSET_BASIS;
+
+    hash = gp_hash_u64( hash, _canvas->hash_lines );
+    hash = gp_hash_u64( hash, _canvas->hash_rects );
+    hash = gp_hash_u64( hash, _canvas->hash_rounded_rects );
+    hash = gp_hash_u64( hash, _canvas->hash_ellipses );
+
+    *_hash = hash;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_snapshot( gp_canvas_t * _canvas, const gp_canvas_t ** _snapshot )
+{
+    gp_dirty_frame_capture( _canvas, GP_FALSE );
+
+    gp_canvas_t * snapshot = GP_NEW( _canvas, gp_canvas_t );
+
+    *snapshot = *_canvas;
+
+    gp_dirty_frame_reset( snapshot );
+
+    _canvas->states = GP_NULLPTR;
+
+    _canvas->lines = GP_NULLPTR;
+    _canvas->rects = GP_NULLPTR;
+    _canvas->rounded_rects = GP_NULLPTR;
+    _canvas->ellipses = GP_NULLPTR;
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    __canvas_hash_reset( _canvas );
+
+    gp_mesh_size_reset( _canvas );
+
+    gp_spatial_index_reset( &_canvas->index );
+
+    gp_handle_table_retire( _canvas );
+
+    *_snapshot = snapshot;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_snapshot_release( const gp_canvas_t * _snapshot )
+{
+    gp_canvas_t * snapshot = (gp_canvas_t *)_snapshot;
+
+    gp_result_t result = gp_canvas_destroy( snapshot );
+
+    return result;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_set_validation( gp_canvas_t * _canvas, gp_validation_t _validation, void * _ud )
+{
+    _canvas->validation = _validation;
+    _canvas->validation_ud = _ud;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
 gp_result_t gp_set_thickness( gp_canvas_t * _canvas, float _thickness )
 {
     gp_state_t * state = GP_GET_STATE( _canvas );
@@ -153,9 +283,11 @@ gp_result_t gp_set_penumbra( gp_canvas_t * _canvas, float _penumbra )
 {
     gp_state_t * state = GP_GET_STATE( _canvas );
 
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( _penumbra > state->thickness * 0.5f )
     {
+        gp_validation_report( _canvas, "gp_set_penumbra: penumbra exceeds half thickness" );
+
         return GP_FAILURE;
     }
 #endif
@@ -206,14 +338,139 @@ gp_result_t gp_get_outline_width( const gp_canvas_t * _canvas, float * _width )
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_line_join( gp_canvas_t * _canvas, gp_line_join_e _join )
+{
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    if( state->line_join == _join )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    state->line_join = _join;
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_get_line_join( const gp_canvas_t * _canvas, gp_line_join_e * _join )
+{
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    *_join = state->line_join;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_miter_limit( gp_canvas_t * _canvas, float _limit )
+{
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+#if defined(GP_VALIDATION)
+    if( _limit < 1.f )
+    {
+        gp_validation_report( _canvas, "gp_set_miter_limit: miter limit below 1" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    if( state->miter_limit == _limit )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    state->miter_limit = _limit;
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_get_miter_limit( const gp_canvas_t * _canvas, float * _limit )
+{
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    *_limit = state->miter_limit;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_dash( gp_canvas_t * _canvas, const float * _pattern, gp_uint32_t _count, float _offset )
+{
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    if( _count > GP_DASH_PATTERN_MAX )
+    {
+#if defined(GP_VALIDATION)
+        gp_validation_report( _canvas, "gp_set_dash: dash count exceeds GP_DASH_PATTERN_MAX" );
+#endif
+
+        return GP_FAILURE;
+    }
+
+#if defined(GP_VALIDATION)
+    float length = 0.f;
+
+    for( gp_uint32_t index = 0; index != _count; ++index )
+    {
+        if( _pattern[index] < 0.f )
+        {
+            gp_validation_report( _canvas, "gp_set_dash: negative dash length" );
+
+            return GP_FAILURE;
+        }
+
+        length += _pattern[index];
+    }
+
+    if( _count != 0 && length <= 0.f )
+    {
+        gp_validation_report( _canvas, "gp_set_dash: dash pattern has zero length" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    state->dash_count = _count;
+    state->dash_offset = _offset;
+
+    for( gp_uint32_t index = 0; index != _count; ++index )
+    {
+        state->dash_pattern[index] = _pattern[index];
+    }
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_get_dash( const gp_canvas_t * _canvas, float * _pattern, gp_uint32_t * _count, float * _offset )
+{
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    for( gp_uint32_t index = 0; index != state->dash_count; ++index )
+    {
+        _pattern[index] = state->dash_pattern[index];
+    }
+
+    *_count = state->dash_count;
+    *_offset = state->dash_offset;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
 gp_result_t gp_set_outline_color( gp_canvas_t * _canvas, float _r, float _g, float _b, float _a )
 {
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( _r > 1.f || _r < 0.f ||
         _g > 1.f || _g < 0.f ||
         _b > 1.f || _b < 0.f ||
         _a > 1.f || _a < 0.f )
     {
+        gp_validation_report( _canvas, "gp_set_outline_color: color component out of [0, 1]" );
+
         return GP_FAILURE;
     }
 #endif
@@ -249,12 +506,14 @@ gp_result_t gp_get_outline_color( const gp_canvas_t * _canvas, gp_color_t * _col
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_set_color( gp_canvas_t * _canvas, float _r, float _g, float _b, float _a )
 {
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( _r > 1.f || _r < 0.f ||
         _g > 1.f || _g < 0.f ||
         _b > 1.f || _b < 0.f ||
         _a > 1.f || _a < 0.f )
     {
+        gp_validation_report( _canvas, "gp_set_color: color component out of [0, 1]" );
+
         return GP_FAILURE;
     }
 #endif
@@ -287,138 +546,399 @@ gp_result_t gp_get_color( const gp_canvas_t * _canvas, gp_color_t * _color )
 
     return GP_SUCCESSFUL;
 }
+#if defined(GP_VALIDATION)
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __gradient_stops_valid( const float * _stops, gp_uint32_t _count )
+{
+    float offset = 0.f;
+
+    for( gp_uint32_t index = 0; index != _count * 5; ++index )
+    {
+        float value = _stops[index];
+
+        if( value < 0.f || value > 1.f )
+        {
+            return GP_FALSE;
+        }
+
+        if( index % 5 != 0 )
+        {
+            continue;
+        }
+
+        if( value < offset )
+        {
+            return GP_FALSE;
+        }
+
+        offset = value;
+    }
+
+    return GP_TRUE;
+}
+#endif
+//////////////////////////////////////////////////////////////////////////
+static void __gradient_stops_setup( gp_state_t * _state, const float * _stops, gp_uint32_t _count )
+{
+    for( gp_uint32_t index = 0; index != _count; ++index )
+    {
+        const float * stop = _stops + index * 5;
+
+        gp_gradient_stop_t * s = _state->gradient_stops + index;
+
+        s->offset = stop[0];
+        s->color.r = stop[1];
+        s->color.g = stop[2];
+        s->color.b = stop[3];
+        s->color.a = stop[4];
+    }
+
+    _state->gradient_stop_count = _count;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_linear_gradient( gp_canvas_t * _canvas, float _x0, float _y0, float _x1, float _y1, const float * _stops, gp_uint32_t _count )
+{
+    if( _count == 0 || _count > GP_GRADIENT_STOP_MAX )
+    {
+#if defined(GP_VALIDATION)
+        gp_validation_report( _canvas, "gp_set_linear_gradient: expecting 1 to GP_GRADIENT_STOP_MAX stops" );
+#endif
+
+        return GP_FAILURE;
+    }
+
+#if defined(GP_VALIDATION)
+    if( _x0 == _x1 && _y0 == _y1 )
+    {
+        gp_validation_report( _canvas, "gp_set_linear_gradient: start and end points coincide" );
+
+        return GP_FAILURE;
+    }
+
+    if( __gradient_stops_valid( _stops, _count ) == GP_FALSE )
+    {
+        gp_validation_report( _canvas, "gp_set_linear_gradient: expecting stops of ascending offset and color in [0, 1]" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    state->gradient = GP_GRADIENT_LINEAR;
+    state->gradient_x0 = _x0;
+    state->gradient_y0 = _y0;
+    state->gradient_x1 = _x1;
+    state->gradient_y1 = _y1;
+    state->gradient_radius = 0.f;
+
+    __gradient_stops_setup( state, _stops, _count );
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_radial_gradient( gp_canvas_t * _canvas, float _x, float _y, float _radius, const float * _stops, gp_uint32_t _count )
+{
+    if( _count == 0 || _count > GP_GRADIENT_STOP_MAX )
+    {
+#if defined(GP_VALIDATION)
+        gp_validation_report( _canvas, "gp_set_radial_gradient: expecting 1 to GP_GRADIENT_STOP_MAX stops" );
+#endif
+
+        return GP_FAILURE;
+    }
+
+#if defined(GP_VALIDATION)
+    if( _radius <= 0.f )
+    {
+        gp_validation_report( _canvas, "gp_set_radial_gradient: radius must be positive" );
+
+        return GP_FAILURE;
+    }
+
+    if( __gradient_stops_valid( _stops, _count ) == GP_FALSE )
+    {
+        gp_validation_report( _canvas, "gp_set_radial_gradient: expecting stops of ascending offset and color in [0, 1]" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    state->gradient = GP_GRADIENT_RADIAL;
+    state->gradient_x0 = _x;
+    state->gradient_y0 = _y;
+    state->gradient_x1 = 0.f;
+    state->gradient_y1 = 0.f;
+    state->gradient_radius = _radius;
+
+    __gradient_stops_setup( state, _stops, _count );
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_clear_gradient( gp_canvas_t * _canvas )
+{
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    if( state->gradient == GP_GRADIENT_NONE )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    state->gradient = GP_GRADIENT_NONE;
+    state->gradient_x0 = 0.f;
+    state->gradient_y0 = 0.f;
+    state->gradient_x1 = 0.f;
+    state->gradient_y1 = 0.f;
+    state->gradient_radius = 0.f;
+    state->gradient_stop_count = 0;
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_get_gradient( const gp_canvas_t * _canvas, gp_gradient_e * _gradient, float * _stops, gp_uint32_t * _count )
+{
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    for( gp_uint32_t index = 0; index != state->gradient_stop_count; ++index )
+    {
+        const gp_gradient_stop_t * s = state->gradient_stops + index;
+
+        float * stop = _stops + index * 5;
+
+        stop[0] = s->offset;
+        stop[1] = s->color.r;
+        stop[2] = s->color.g;
+        stop[3] = s->color.b;
+        stop[4] = s->color.a;
+    }
+
+    *_gradient = state->gradient;
+    *_count = state->gradient_stop_count;
+
+    return GP_SUCCESSFUL;
+}
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_set_uv_offset( gp_canvas_t * _canvas, float _ou, float _ov, float _su, float _sv )
 {
     gp_state_t * state = GP_GET_STATE( _canvas );
 
-    if( state->uv_ou == _ou &&
-        state->uv_ov == _ov &&
-        state->uv_su == _su &&
-        state->uv_sv == _sv )
+    if( state->uv_ou == _ou &&
+        state->uv_ov == _ov &&
+        state->uv_su == _su &&
+        state->uv_sv == _sv )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    state->uv_ou = _ou;
+    state->uv_ov = _ov;
+    state->uv_su = _su;
+    state->uv_sv = _sv;
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_get_uv_offset( const gp_canvas_t * _canvas, float * _ou, float * _ov, float * _su, float * _sv )
+{
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    *_ou = state->uv_ou;
+    *_ov = state->uv_ov;
+    *_su = state->uv_su;
+    *_sv = state->uv_sv;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_curve_quality( gp_canvas_t * _canvas, gp_uint8_t _quality )
+{
+#if defined(GP_VALIDATION)
+    if( _quality == 0 )
+    {
+        gp_validation_report( _canvas, "gp_set_curve_quality: quality must be positive" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    if( state->curve_quality == _quality )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    state->curve_quality = _quality;
+    state->curve_quality_inv = 1.f / (float)_quality;
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_get_curve_quality( const gp_canvas_t * _canvas, gp_uint8_t * _quality )
+{
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    *_quality = state->curve_quality;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_ellipse_quality( gp_canvas_t * _canvas, gp_uint8_t _quality )
+{
+#if defined(GP_VALIDATION)
+    if( _quality < 4 )
+    {
+        gp_validation_report( _canvas, "gp_set_ellipse_quality: quality below 4" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    gp_uint8_t quality = (_quality + 3) / 4 * 4;
+
+    if( state->ellipse_quality == quality )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    state->ellipse_quality = quality;
+    state->ellipse_quality_inv = 1.f / (float)state->ellipse_quality;
+
+    _canvas->state_invalidate = GP_TRUE;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_get_ellipse_quality( const gp_canvas_t * _canvas, gp_uint8_t * _quality )
+{
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    *_quality = state->ellipse_quality;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_set_rect_quality( gp_canvas_t * _canvas, gp_uint8_t _quality )
+{
+#if defined(GP_VALIDATION)
+    if( _quality < 2 )
+    {
+        gp_validation_report( _canvas, "gp_set_rect_quality: quality below 2" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_state_t * state = GP_GET_STATE( _canvas );
+
+    if( state->rect_quality == _quality )
     {
         return GP_SUCCESSFUL;
     }
 
-    state->uv_ou = _ou;
-    state->uv_ov = _ov;
-    state->uv_su = _su;
-    state->uv_sv = _sv;
+    state->rect_quality = _quality;
+    state->rect_quality_inv = 1.f / (float)state->rect_quality;
 
     _canvas->state_invalidate = GP_TRUE;
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_get_uv_offset( const gp_canvas_t * _canvas, float * _ou, float * _ov, float * _su, float * _sv )
+gp_result_t gp_get_rect_quality( const gp_canvas_t * _canvas, gp_uint8_t * _quality )
 {
     const gp_state_t * state = GP_GET_STATE( _canvas );
 
-    *_ou = state->uv_ou;
-    *_ov = state->uv_ov;
-    *_su = state->uv_su;
-    *_sv = state->uv_sv;
+    *_quality = state->rect_quality;
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_set_curve_quality( gp_canvas_t * _canvas, gp_uint8_t _quality )
+gp_result_t gp_set_sdf( gp_canvas_t * _canvas, gp_bool_t _sdf )
 {
-#if defined(GP_DEBUG)
-    if( _quality == 0 )
-    {
-        return GP_FAILURE;
-    }
-#endif
-
     gp_state_t * state = GP_GET_STATE( _canvas );
 
-    if( state->curve_quality == _quality )
+    if( state->sdf == _sdf )
     {
         return GP_SUCCESSFUL;
     }
 
-    state->curve_quality = _quality;
-    state->curve_quality_inv = 1.f / (float)_quality;
+    state->sdf = _sdf;
 
     _canvas->state_invalidate = GP_TRUE;
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_get_curve_quality( const gp_canvas_t * _canvas, gp_uint8_t * _quality )
+gp_result_t gp_get_sdf( const gp_canvas_t * _canvas, gp_bool_t * _sdf )
 {
     const gp_state_t * state = GP_GET_STATE( _canvas );
 
-    *_quality = state->curve_quality;
+    *_sdf = state->sdf;
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_set_ellipse_quality( gp_canvas_t * _canvas, gp_uint8_t _quality )
+gp_result_t gp_set_material( gp_canvas_t * _canvas, gp_uint32_t _material )
 {
-#if defined(GP_DEBUG)
-    if( _quality < 4 )
-    {
-        return GP_FAILURE;
-    }
-#endif
-
     gp_state_t * state = GP_GET_STATE( _canvas );
 
-    gp_uint8_t quality = (_quality + 3) / 4 * 4;
-
-    if( state->ellipse_quality == quality )
+    if( state->material == _material )
     {
         return GP_SUCCESSFUL;
     }
 
-    state->ellipse_quality = quality;
-    state->ellipse_quality_inv = 1.f / (float)state->ellipse_quality;
+    state->material = _material;
 
     _canvas->state_invalidate = GP_TRUE;
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_get_ellipse_quality( const gp_canvas_t * _canvas, gp_uint8_t * _quality )
+gp_result_t gp_get_material( const gp_canvas_t * _canvas, gp_uint32_t * _material )
 {
     const gp_state_t * state = GP_GET_STATE( _canvas );
 
-    *_quality = state->ellipse_quality;
+    *_material = state->material;
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_set_rect_quality( gp_canvas_t * _canvas, gp_uint8_t _quality )
+gp_result_t gp_set_blend( gp_canvas_t * _canvas, gp_bool_t _blend )
 {
-#if defined(GP_DEBUG)
-    if( _quality < 2 )
-    {
-        return GP_FAILURE;
-    }
-#endif
-
     gp_state_t * state = GP_GET_STATE( _canvas );
 
-    if( state->rect_quality == _quality )
+    if( state->blend == _blend )
     {
         return GP_SUCCESSFUL;
     }
 
-    state->rect_quality = _quality;
-    state->rect_quality_inv = 1.f / (float)state->rect_quality;
+    state->blend = _blend;
 
     _canvas->state_invalidate = GP_TRUE;
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_get_rect_quality( const gp_canvas_t * _canvas, gp_uint8_t * _quality )
+gp_result_t gp_get_blend( const gp_canvas_t * _canvas, gp_bool_t * _blend )
 {
     const gp_state_t * state = GP_GET_STATE( _canvas );
 
-    *_quality = state->rect_quality;
+    *_blend = state->blend;
 
     return GP_SUCCESSFUL;
 }
@@ -427,9 +947,11 @@ gp_result_t gp_begin_fill( gp_canvas_t * _canvas )
 {
     gp_state_t * state = GP_GET_STATE( _canvas );
 
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( state->fill == GP_TRUE )
     {
+        gp_validation_report( _canvas, "gp_begin_fill: fill already begun" );
+
         return GP_FAILURE;
     }
 #endif    
@@ -445,9 +967,11 @@ gp_result_t gp_end_fill( gp_canvas_t * _canvas )
 {
     gp_state_t * state = GP_GET_STATE( _canvas );
 
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( state->fill == GP_FALSE )
     {
+        gp_validation_report( _canvas, "gp_end_fill: fill not begun" );
+
         return GP_FAILURE;
     }
 #endif
@@ -461,9 +985,11 @@ gp_result_t gp_end_fill( gp_canvas_t * _canvas )
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_push_state( gp_canvas_t * _canvas )
 {
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( _canvas->state_stack + 1 == GP_STATE_STACK_MAX )
     {
+        gp_validation_report( _canvas, "gp_push_state: state stack overflow" );
+
         return GP_FAILURE;
     }
 #endif
@@ -477,9 +1003,11 @@ gp_result_t gp_push_state( gp_canvas_t * _canvas )
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_pop_state( gp_canvas_t * _canvas )
 {
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( _canvas->state_stack == 0 )
     {
+        gp_validation_report( _canvas, "gp_pop_state: state stack underflow" );
+
         return GP_FAILURE;
     }
 #endif
@@ -504,6 +1032,11 @@ static const gp_state_t * __copy_state( gp_canvas_t * _canvas )
 
     *s = *GP_GET_STATE( _canvas );
 
+    s->argb = gp_color_argb( &s->color );
+    s->outline_argb = gp_color_argb( &s->outline_color );
+
+    s->hash = gp_hash_state( s );
+
     GP_LIST_PUSHBACK( gp_state_t, _canvas->states, s );
 
     _canvas->state_invalidate = GP_FALSE;
@@ -515,13 +1048,15 @@ static const gp_state_t * __copy_state( gp_canvas_t * _canvas )
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_move_to( gp_canvas_t * _canvas, float _x, float _y )
 {
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( _canvas->lines != GP_NULLPTR )
     {
         gp_line_t * l = GP_LIST_BACK( _canvas->lines );
 
         if( l->edges == GP_NULLPTR )
         {
+            gp_validation_report( _canvas, "gp_move_to: previous line has no edges" );
+
             return GP_FAILURE;
         }
     }
@@ -536,6 +1071,13 @@ gp_result_t gp_move_to( gp_canvas_t * _canvas, float _x, float _y )
 
     p->state = GP_COPY_STATE( _canvas );
 
+    gp_hash_line_point( &_canvas->hash_lines, p, GP_NULLPTR );
+
+    if( _canvas->lines != GP_NULLPTR )
+    {
+        gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_LINE, GP_LIST_BACK( _canvas->lines ) );
+    }
+
     gp_line_t * l = GP_NEW( _canvas, gp_line_t );
     l->next = GP_NULLPTR;
     l->prev = GP_NULLPTR;
@@ -546,6 +1088,8 @@ gp_result_t gp_move_to( gp_canvas_t * _canvas, float _x, float _y )
     l->edges = GP_NULLPTR;
     l->state = p->state;
 
+    gp_line_joints_begin( l );
+
     GP_LIST_PUSHBACK( gp_line_t, _canvas->lines, l );
 
     return GP_SUCCESSFUL;
@@ -553,9 +1097,11 @@ gp_result_t gp_move_to( gp_canvas_t * _canvas, float _x, float _y )
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_line_to( gp_canvas_t * _canvas, float _x, float _y )
 {
-#if defined(GP_DEBUG)
+#if defined(GP_VALIDATION)
     if( _canvas->lines == GP_NULLPTR )
     {
+        gp_validation_report( _canvas, "gp_line_to: no current line, call gp_move_to first" );
+
         return GP_FAILURE;
     }
 #endif
@@ -581,11 +1127,24 @@ gp_result_t gp_line_to( gp_canvas_t * _canvas, float _x, float _y )
 
     GP_LIST_PUSHBACK( gp_line_edge_t, l->edges, e );
 
+    gp_line_joints_advance( l );
+
+    gp_hash_line_point( &_canvas->hash_lines, p, e );
+
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_quadratic_curve_to( gp_canvas_t * _canvas, float _p0x, float _p0y, float _x, float _y )
 {
+#if defined(GP_VALIDATION)
+    if( _canvas->lines == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_quadratic_curve_to: no current line, call gp_move_to first" );
+
+        return GP_FAILURE;
+    }
+#endif
+
     gp_line_point_t * p = GP_NEW( _canvas, gp_line_point_t );
     p->next = GP_NULLPTR;
     p->prev = GP_NULLPTR;
@@ -608,11 +1167,24 @@ gp_result_t gp_quadratic_curve_to( gp_canvas_t * _canvas, float _p0x, float _p0y
 
     GP_LIST_PUSHBACK( gp_line_edge_t, line_back->edges, e );
 
+    gp_line_joints_advance( line_back );
+
+    gp_hash_line_point( &_canvas->hash_lines, p, e );
+
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_bezier_curve_to( gp_canvas_t * _canvas, float _p0x, float _p0y, float _p1x, float _p1y, float _x, float _y )
 {
+#if defined(GP_VALIDATION)
+    if( _canvas->lines == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_bezier_curve_to: no current line, call gp_move_to first" );
+
+        return GP_FAILURE;
+    }
+#endif
+
     gp_line_point_t * p = GP_NEW( _canvas, gp_line_point_t );
     p->next = GP_NULLPTR;
     p->prev = GP_NULLPTR;
@@ -637,6 +1209,10 @@ gp_result_t gp_bezier_curve_to( gp_canvas_t * _canvas, float _p0x, float _p0y, f
 
     GP_LIST_PUSHBACK( gp_line_edge_t, line_back->edges, e );
 
+    gp_line_joints_advance( line_back );
+
+    gp_hash_line_point( &_canvas->hash_lines, p, e );
+
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
@@ -645,6 +1221,7 @@ gp_result_t gp_rect( gp_canvas_t * _canvas, float _x, float _y, float _width, fl
     gp_rect_t * r = GP_NEW( _canvas, gp_rect_t );
     r->next = GP_NULLPTR;
     r->prev = GP_NULLPTR;
+    r->handle = 0;
 
     r->point.x = _x;
     r->point.y = _y;
@@ -655,25 +1232,44 @@ gp_result_t gp_rect( gp_canvas_t * _canvas, float _x, float _y, float _width, fl
 
     GP_LIST_PUSHBACK( gp_rect_t, _canvas->rects, r );
 
+    gp_hash_shape_append( _canvas, GP_SHAPE_TYPE_RECT, r );
+
+    gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_RECT, r );
+
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
 gp_result_t gp_rounded_rect( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _radius )
+{
+    GP_CALL( gp_rounded_rect_corners, (_canvas, _x, _y, _width, _height, _radius, _radius, _radius, _radius) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_rounded_rect_corners( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _top_left, float _top_right, float _bottom_right, float _bottom_left )
 {
     gp_rounded_rect_t * rr = GP_NEW( _canvas, gp_rounded_rect_t );
     rr->next = GP_NULLPTR;
     rr->prev = GP_NULLPTR;
+    rr->handle = 0;
 
     rr->point.x = _x;
     rr->point.y = _y;
     rr->width = _width;
     rr->height = _height;
-    rr->radius = _radius;
+    rr->radius[0] = _top_left;
+    rr->radius[1] = _top_right;
+    rr->radius[2] = _bottom_right;
+    rr->radius[3] = _bottom_left;
 
     rr->state = GP_COPY_STATE( _canvas );
 
     GP_LIST_PUSHBACK( gp_rounded_rect_t, _canvas->rounded_rects, rr );
 
+    gp_hash_shape_append( _canvas, GP_SHAPE_TYPE_ROUNDED_RECT, rr );
+
+    gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_ROUNDED_RECT, rr );
+
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
@@ -689,84 +1285,334 @@ gp_result_t gp_ellipse( gp_canvas_t * _canvas, float _x, float _y, float _width,
     gp_ellipse_t * e = GP_NEW( _canvas, gp_ellipse_t );
     e->next = GP_NULLPTR;
     e->prev = GP_NULLPTR;
+    e->handle = 0;
 
     e->point.x = _x;
     e->point.y = _y;
     e->radius_width = _width;
     e->radius_height = _height;
+    e->angle_start = 0.f;
+    e->angle_sweep = gp_constant_two_pi;
 
     e->state = GP_COPY_STATE( _canvas );
 
     GP_LIST_PUSHBACK( gp_ellipse_t, _canvas->ellipses, e );
 
+    gp_hash_shape_append( _canvas, GP_SHAPE_TYPE_ELLIPSE, e );
+
+    gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_ELLIPSE, e );
+
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_calculate_mesh_size( const gp_canvas_t * _canvas, gp_mesh_t * _mesh )
+gp_result_t gp_arc( gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, float _start, float _sweep )
 {
-    _mesh->vertex_count = 0;
-    _mesh->index_count = 0;
+#if defined(GP_VALIDATION)
+    if( _sweep == 0.f )
+    {
+        gp_validation_report( _canvas, "gp_arc: zero sweep" );
 
-    GP_CALL( gp_calculate_mesh_line_size, (_canvas, _mesh) );
-    GP_CALL( gp_calculate_mesh_rect_size, (_canvas, _mesh) );
-    GP_CALL( gp_calculate_mesh_rounded_rect_size, (_canvas, _mesh) );
-    GP_CALL( gp_calculate_mesh_ellipse_size, (_canvas, _mesh) );
+        return GP_FAILURE;
+    }
+#endif
 
-    _mesh->color.r = 1.f;
-    _mesh->color.g = 1.f;
-    _mesh->color.b = 1.f;
-    _mesh->color.a = 1.f;
+    gp_ellipse_t * e = GP_NEW( _canvas, gp_ellipse_t );
+    e->next = GP_NULLPTR;
+    e->prev = GP_NULLPTR;
+    e->handle = 0;
 
-    _mesh->positions_buffer = GP_NULLPTR;
-    _mesh->positions_offset = ~0U;
-    _mesh->positions_stride = ~0U;
+    e->point.x = _x;
+    e->point.y = _y;
+    e->radius_width = _width;
+    e->radius_height = _height;
+    e->angle_start = _start;
+    e->angle_sweep = _sweep;
 
-    _mesh->colors_buffer = GP_NULLPTR;
-    _mesh->colors_offset = ~0U;
-    _mesh->colors_stride = ~0U;
+    if( gp_ellipse_is_arc( e ) == GP_FALSE )
+    {
+        e->angle_start = 0.f;
+        e->angle_sweep = gp_constant_two_pi;
+    }
 
-    _mesh->uv_buffer = GP_NULLPTR;
-    _mesh->uv_offset = ~0U;
-    _mesh->uv_stride = ~0U;
+    e->state = GP_COPY_STATE( _canvas );
 
-    _mesh->indices_buffer = GP_NULLPTR;
-    _mesh->indices_offset = ~0U;
-    _mesh->indices_stride = ~0U;
+    GP_LIST_PUSHBACK( gp_ellipse_t, _canvas->ellipses, e );
+
+    gp_hash_shape_append( _canvas, GP_SHAPE_TYPE_ELLIPSE, e );
+
+    gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_ELLIPSE, e );
 
     return GP_SUCCESSFUL;
 }
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_render( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh )
+gp_result_t gp_arc_to( gp_canvas_t * _canvas, float _rx, float _ry, float _rotation, gp_bool_t _large_arc, gp_bool_t _sweep, float _x, float _y )
 {
-#if defined(GP_DEBUG)
-    if( _mesh->positions_buffer != GP_NULLPTR && (_mesh->positions_offset == ~0U || _mesh->positions_stride == ~0U) )
+#if defined(GP_VALIDATION)
+    if( _canvas->lines == GP_NULLPTR )
     {
+        gp_validation_report( _canvas, "gp_arc_to: no current line, call gp_move_to first" );
+
         return GP_FAILURE;
     }
+#endif
+
+    const gp_line_t * l = GP_LIST_BACK( _canvas->lines );
+    const gp_line_point_t * back = GP_LIST_BACK( l->points );
+
+    float x1 = back->p.x;
+    float y1 = back->p.y;
+
+    if( x1 == _x && y1 == _y )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    float rx = _rx < 0.f ? -_rx : _rx;
+    float ry = _ry < 0.f ? -_ry : _ry;
+
+    if( rx == 0.f || ry == 0.f )
+    {
+        GP_CALL( gp_line_to, (_canvas, _x, _y) );
+
+        return GP_SUCCESSFUL;
+    }
+
+    float cr = GP_MATH_COSF( _rotation );
+    float sr = GP_MATH_SINF( _rotation );
+
+    float hx = (x1 - _x) * 0.5f;
+    float hy = (y1 - _y) * 0.5f;
+
+    float px = cr * hx + sr * hy;
+    float py = -sr * hx + cr * hy;
+
+    float lambda = (px * px) / (rx * rx) + (py * py) / (ry * ry);
+
+    if( lambda > 1.f )
+    {
+        float scale = GP_MATH_SQRTF( lambda );
+
+        rx *= scale;
+        ry *= scale;
+    }
+
+    float rx2 = rx * rx;
+    float ry2 = ry * ry;
+
+    float numerator = rx2 * ry2 - rx2 * py * py - ry2 * px * px;
+    float denominator = rx2 * py * py + ry2 * px * px;
+
+    float coef = numerator > 0.f ? GP_MATH_SQRTF( numerator / denominator ) : 0.f;
+
+    if( _large_arc == _sweep )
+    {
+        coef = -coef;
+    }
+
+    float pcx = coef * rx * py / ry;
+    float pcy = -coef * ry * px / rx;
+
+    float cx = cr * pcx - sr * pcy + (x1 + _x) * 0.5f;
+    float cy = sr * pcx + cr * pcy + (y1 + _y) * 0.5f;
+
+    float theta = GP_MATH_ATAN2F( (py - pcy) / ry, (px - pcx) / rx );
+    float theta_end = GP_MATH_ATAN2F( (-py - pcy) / ry, (-px - pcx) / rx );
+
+    float sweep = theta_end - theta;
+
+    if( _sweep == GP_TRUE && sweep < 0.f )
+    {
+        sweep += gp_constant_two_pi;
+    }
+    else if( _sweep == GP_FALSE && sweep > 0.f )
+    {
+        sweep -= gp_constant_two_pi;
+    }
+
+    const gp_state_t * state = GP_GET_STATE( _canvas );
+
+    float segments_f = -GP_MATH_FLOORF( -(sweep < 0.f ? -sweep : sweep) * (float)state->ellipse_quality / gp_constant_two_pi );
+
+    gp_uint32_t segments = segments_f < 1.f ? 1 : (gp_uint32_t)segments_f;
+
+    float dt = sweep / (float)segments;
+
+    float cdt = GP_MATH_COSF( dt );
+    float sdt = GP_MATH_SINF( dt );
+
+    float ct = GP_MATH_COSF( theta );
+    float st = GP_MATH_SINF( theta );
+
+    for( gp_uint32_t index = 1; index != segments; ++index )
+    {
+        float c = ct * cdt - st * sdt;
+        st = st * cdt + ct * sdt;
+        ct = c;
+
+        float ex = rx * ct;
+        float ey = ry * st;
+
+        GP_CALL( gp_line_to, (_canvas, cx + cr * ex - sr * ey, cy + sr * ex + cr * ey) );
+    }
 
-    if( _mesh->colors_buffer != GP_NULLPTR && (_mesh->colors_offset == ~0U || _mesh->colors_stride == ~0U) )
+    GP_CALL( gp_line_to, (_canvas, _x, _y) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_polyline( gp_canvas_t * _canvas, const float * _points, gp_uint32_t _point_count )
+{
+#if defined(GP_VALIDATION)
+    if( _point_count < 2 )
     {
+        gp_validation_report( _canvas, "gp_polyline: polyline requires at least two points" );
+
         return GP_FAILURE;
     }
+#endif
+
+    GP_CALL( gp_move_to, (_canvas, _points[0], _points[1]) );
+
+    for( gp_uint32_t index = 1; index != _point_count; ++index )
+    {
+        const float * p = _points + index * 2;
+
+        GP_CALL( gp_line_to, (_canvas, p[0], p[1]) );
+    }
 
-    if( _mesh->uv_buffer != GP_NULLPTR && (_mesh->uv_offset == ~0U || _mesh->uv_stride == ~0U) )
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_rects( gp_canvas_t * _canvas, const float * _rects, gp_uint32_t _count )
+{
+    for( gp_uint32_t index = 0; index != _count; ++index )
+    {
+        const float * r = _rects + index * 4;
+
+        GP_CALL( gp_rect, (_canvas, r[0], r[1], r[2], r[3]) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_rounded_rects( gp_canvas_t * _canvas, const float * _rounded_rects, gp_uint32_t _count )
+{
+    for( gp_uint32_t index = 0; index != _count; ++index )
+    {
+        const float * rr = _rounded_rects + index * 5;
+
+        GP_CALL( gp_rounded_rect, (_canvas, rr[0], rr[1], rr[2], rr[3], rr[4]) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_circles( gp_canvas_t * _canvas, const float * _circles, gp_uint32_t _count )
+{
+    for( gp_uint32_t index = 0; index != _count; ++index )
+    {
+        const float * c = _circles + index * 3;
+
+        GP_CALL( gp_circle, (_canvas, c[0], c[1], c[2]) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_ellipses( gp_canvas_t * _canvas, const float * _ellipses, gp_uint32_t _count )
+{
+    for( gp_uint32_t index = 0; index != _count; ++index )
+    {
+        const float * e = _ellipses + index * 4;
+
+        GP_CALL( gp_ellipse, (_canvas, e[0], e[1], e[2], e[3]) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_calculate_mesh_size( const gp_canvas_t * _canvas, gp_mesh_t * _mesh )
+{
+    gp_uint32_t vertex_count;
+    gp_uint32_t index_count;
+    gp_uint32_t range_count;
+    gp_mesh_size_get( _canvas, &vertex_count, &index_count, &range_count );
+
+    if( vertex_count > GP_MESH_SIZE_MAX || index_count > GP_MESH_SIZE_MAX )
     {
+        gp_validation_report( _canvas, "gp_calculate_mesh_size: mesh exceeds 65535 vertices or indices" );
+
         return GP_FAILURE;
     }
 
-    if( _mesh->indices_buffer != GP_NULLPTR && (_mesh->indices_offset == ~0U || _mesh->indices_stride == ~0U) )
+    _mesh->vertex_count = (gp_uint16_t)vertex_count;
+    _mesh->index_count = (gp_uint16_t)index_count;
+    _mesh->range_count = range_count;
+
+    _mesh->color.r = 1.f;
+    _mesh->color.g = 1.f;
+    _mesh->color.b = 1.f;
+    _mesh->color.a = 1.f;
+
+    _mesh->positions_buffer = GP_NULLPTR;
+    _mesh->positions_offset = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->positions_stride = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->positions_format = GP_POSITION_FORMAT_FLOAT2;
+    _mesh->positions_origin_x = 0.f;
+    _mesh->positions_origin_y = 0.f;
+    _mesh->positions_scale = 1.f;
+
+    _mesh->colors_buffer = GP_NULLPTR;
+    _mesh->colors_offset = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->colors_stride = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->colors_format = GP_COLOR_FORMAT_ARGB;
+    _mesh->colors_premultiplied = GP_FALSE;
+
+    _mesh->uv_buffer = GP_NULLPTR;
+    _mesh->uv_offset = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->uv_stride = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->uv_format = GP_UV_FORMAT_FLOAT2;
+
+    _mesh->indices_buffer = GP_NULLPTR;
+    _mesh->indices_offset = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->indices_stride = GP_MESH_ATTRIBUTE_UNSET;
+
+    _mesh->sdf_buffer = GP_NULLPTR;
+    _mesh->sdf_offset = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->sdf_stride = GP_MESH_ATTRIBUTE_UNSET;
+
+    _mesh->depth_buffer = GP_NULLPTR;
+    _mesh->depth_offset = GP_MESH_ATTRIBUTE_UNSET;
+    _mesh->depth_stride = GP_MESH_ATTRIBUTE_UNSET;
+
+    _mesh->ranges_buffer = GP_NULLPTR;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_render( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh )
+{
+#if defined(GP_VALIDATION)
+    if( gp_validate_mesh( _canvas, _mesh ) == GP_FAILURE )
     {
         return GP_FAILURE;
     }
 #endif
 
+    GP_CALL( gp_render_sdf_clear, (_mesh) );
+
     gp_uint16_t vertex_iterator = 0;
     gp_uint16_t index_iterator = 0;
+    gp_uint32_t range_iterator = 0;
+
+    GP_CALL( gp_render_line, (_canvas, _mesh, &vertex_iterator, &index_iterator, &range_iterator) );
+    GP_CALL( gp_render_rect, (_canvas, _mesh, &vertex_iterator, &index_iterator, &range_iterator) );
+    GP_CALL( gp_render_rounded_rect, (_canvas, _mesh, &vertex_iterator, &index_iterator, &range_iterator) );
+    GP_CALL( gp_render_ellipse, (_canvas, _mesh, &vertex_iterator, &index_iterator, &range_iterator) );
+
+    gp_mesh_finish_ranges( _mesh, range_iterator, index_iterator );
 
-    GP_CALL( gp_render_line, (_canvas, _mesh, &vertex_iterator, &index_iterator) );
-    GP_CALL( gp_render_rect, (_canvas, _mesh, &vertex_iterator, &index_iterator) );
-    GP_CALL( gp_render_rounded_rect, (_canvas, _mesh, &vertex_iterator, &index_iterator) );
-    GP_CALL( gp_render_ellipse, (_canvas, _mesh, &vertex_iterator, &index_iterator) );
+    GP_CALL( gp_render_depth, (_canvas, _mesh) );
 
     return GP_SUCCESSFUL;
 }
\ No newline at end of file
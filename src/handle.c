@@ -0,0 +1,408 @@
+#include "handle.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "hash.h"
+#include "spatial.h"
+#include "size.h"
+#include "validate.h"
+
+//////////////////////////////////////////////////////////////////////////
+#define GP_HANDLE_INDEX_BITS (16U)
+#define GP_HANDLE_INDEX_MAX ((1U << GP_HANDLE_INDEX_BITS) - 1U)
+#define GP_HANDLE_GENERATION_MAX ((1U << (32U - GP_HANDLE_INDEX_BITS)) - 1U)
+//////////////////////////////////////////////////////////////////////////
+void gp_handle_table_reset( gp_canvas_t * _canvas )
+{
+    _canvas->handles = GP_NULLPTR;
+    _canvas->handle_count = 0;
+    _canvas->handle_capacity = 0;
+    _canvas->handle_free = 0;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __handle_slot_release( gp_canvas_t * _canvas, gp_uint32_t _index )
+{
+    gp_handle_slot_t * slot = _canvas->handles + _index;
+
+    slot->primitive = GP_NULLPTR;
+    slot->state = GP_NULLPTR;
+
+    if( slot->generation == GP_HANDLE_GENERATION_MAX )
+    {
+        slot->next_free = 0;
+
+        return;
+    }
+
+    ++slot->generation;
+
+    slot->next_free = _canvas->handle_free;
+
+    _canvas->handle_free = _index + 1;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_handle_table_retire( gp_canvas_t * _canvas )
+{
+    _canvas->handle_free = 0;
+
+    for( gp_uint32_t index = _canvas->handle_count; index != 0; --index )
+    {
+        __handle_slot_release( _canvas, index - 1 );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_handle_table_free( gp_canvas_t * _canvas )
+{
+    if( _canvas->handles != GP_NULLPTR )
+    {
+        GP_FREE( _canvas, _canvas->handles );
+    }
+
+    gp_handle_table_reset( _canvas );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_handle_slot_t * __handle_slot( const gp_canvas_t * _canvas, gp_shape_handle_t _handle )
+{
+    gp_uint32_t index = _handle & GP_HANDLE_INDEX_MAX;
+
+    if( index == 0 || index > _canvas->handle_count )
+    {
+        return GP_NULLPTR;
+    }
+
+    gp_handle_slot_t * slot = _canvas->handles + (index - 1);
+
+    if( slot->primitive == GP_NULLPTR || slot->generation != _handle >> GP_HANDLE_INDEX_BITS )
+    {
+        return GP_NULLPTR;
+    }
+
+    return slot;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * __last_primitive( const gp_canvas_t * _canvas, gp_shape_type_e _type )
+{
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        return _canvas->rects == GP_NULLPTR ? GP_NULLPTR : GP_LIST_BACK( _canvas->rects );
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        return _canvas->rounded_rects == GP_NULLPTR ? GP_NULLPTR : GP_LIST_BACK( _canvas->rounded_rects );
+    case GP_SHAPE_TYPE_ELLIPSE:
+        return _canvas->ellipses == GP_NULLPTR ? GP_NULLPTR : GP_LIST_BACK( _canvas->ellipses );
+    default:
+        return GP_NULLPTR;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t * __primitive_handle( gp_shape_type_e _type, void * _primitive )
+{
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        return &((gp_rect_t *)_primitive)->handle;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        return &((gp_rounded_rect_t *)_primitive)->handle;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        return &((gp_ellipse_t *)_primitive)->handle;
+    default:
+        return GP_NULLPTR;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __shape_invalidate( gp_canvas_t * _canvas )
+{
+    gp_spatial_index_free( _canvas );
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_shape_retain( gp_canvas_t * _canvas, gp_shape_type_e _type, gp_shape_handle_t * _handle )
+{
+    void * primitive = __last_primitive( _canvas, _type );
+
+    if( primitive == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_shape_retain: no rect, rounded rect or ellipse of this type to retain" );
+
+        return GP_FAILURE;
+    }
+
+    gp_uint32_t * primitive_handle = __primitive_handle( _type, primitive );
+
+    if( *primitive_handle != 0 )
+    {
+        *_handle = *primitive_handle;
+
+        return GP_SUCCESSFUL;
+    }
+
+    gp_uint32_t index;
+
+    if( _canvas->handle_free != 0 )
+    {
+        index = _canvas->handle_free - 1;
+
+        _canvas->handle_free = _canvas->handles[index].next_free;
+    }
+    else
+    {
+        if( _canvas->handle_count == GP_HANDLE_INDEX_MAX )
+        {
+            gp_validation_report( _canvas, "gp_shape_retain: handle table is full" );
+
+            return GP_FAILURE;
+        }
+
+        if( _canvas->handle_count == _canvas->handle_capacity )
+        {
+            gp_uint32_t capacity = _canvas->handle_capacity == 0 ? 16 : _canvas->handle_capacity * 2;
+
+            _canvas->handles = GP_REALLOC( _canvas, _canvas->handles, gp_handle_slot_t, capacity );
+            _canvas->handle_capacity = capacity;
+        }
+
+        index = _canvas->handle_count++;
+
+        _canvas->handles[index].generation = 0;
+    }
+
+    gp_handle_slot_t * slot = _canvas->handles + index;
+    slot->type = _type;
+    slot->primitive = primitive;
+    slot->state = GP_NULLPTR;
+    slot->next_free = 0;
+
+    *primitive_handle = (slot->generation << GP_HANDLE_INDEX_BITS) | (index + 1);
+
+    *_handle = *primitive_handle;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_shape_remove( gp_canvas_t * _canvas, gp_shape_handle_t _handle )
+{
+    gp_handle_slot_t * slot = __handle_slot( _canvas, _handle );
+
+    if( slot == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_shape_remove: invalid handle" );
+
+        return GP_FAILURE;
+    }
+
+    gp_mesh_size_remove( _canvas, slot->type, slot->primitive );
+    gp_hash_shape_remove( _canvas, slot->type, slot->primitive );
+
+    switch( slot->type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        {
+            gp_rect_t * r = (gp_rect_t *)slot->primitive;
+
+            GP_LIST_REMOVE( _canvas->rects, r );
+        }break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        {
+            gp_rounded_rect_t * rr = (gp_rounded_rect_t *)slot->primitive;
+
+            GP_LIST_REMOVE( _canvas->rounded_rects, rr );
+        }break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        {
+            gp_ellipse_t * e = (gp_ellipse_t *)slot->primitive;
+
+            GP_LIST_REMOVE( _canvas->ellipses, e );
+        }break;
+    default:
+        return GP_FAILURE;
+    }
+
+    GP_FREE( _canvas, slot->primitive );
+
+    if( slot->state != GP_NULLPTR )
+    {
+        gp_state_t * s = slot->state;
+
+        GP_LIST_REMOVE( _canvas->states, s );
+
+        GP_FREE( _canvas, s );
+    }
+
+    __shape_invalidate( _canvas );
+
+    __handle_slot_release( _canvas, (gp_uint32_t)(slot - _canvas->handles) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_shape_set_position( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _x, float _y )
+{
+    gp_handle_slot_t * slot = __handle_slot( _canvas, _handle );
+
+    if( slot == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_shape_set_position: invalid handle" );
+
+        return GP_FAILURE;
+    }
+
+    gp_vec2f_t * point;
+
+    switch( slot->type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        {
+            point = &((gp_rect_t *)slot->primitive)->point;
+        }break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        {
+            point = &((gp_rounded_rect_t *)slot->primitive)->point;
+        }break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        {
+            point = &((gp_ellipse_t *)slot->primitive)->point;
+        }break;
+    default:
+        return GP_FAILURE;
+    }
+
+    gp_mesh_size_remove( _canvas, slot->type, slot->primitive );
+    gp_hash_shape_remove( _canvas, slot->type, slot->primitive );
+
+    point->x = _x;
+    point->y = _y;
+
+    gp_mesh_size_append( _canvas, slot->type, slot->primitive );
+    gp_hash_shape_append( _canvas, slot->type, slot->primitive );
+
+    __shape_invalidate( _canvas );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_shape_set_size( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _width, float _height )
+{
+    gp_handle_slot_t * slot = __handle_slot( _canvas, _handle );
+
+    if( slot == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_shape_set_size: invalid handle" );
+
+        return GP_FAILURE;
+    }
+
+    gp_mesh_size_remove( _canvas, slot->type, slot->primitive );
+    gp_hash_shape_remove( _canvas, slot->type, slot->primitive );
+
+    switch( slot->type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        {
+            gp_rect_t * r = (gp_rect_t *)slot->primitive;
+
+            r->width = _width;
+            r->height = _height;
+        }break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        {
+            gp_rounded_rect_t * rr = (gp_rounded_rect_t *)slot->primitive;
+
+            rr->width = _width;
+            rr->height = _height;
+        }break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        {
+            gp_ellipse_t * e = (gp_ellipse_t *)slot->primitive;
+
+            e->radius_width = _width;
+            e->radius_height = _height;
+        }break;
+    default:
+        return GP_FAILURE;
+    }
+
+    gp_mesh_size_append( _canvas, slot->type, slot->primitive );
+    gp_hash_shape_append( _canvas, slot->type, slot->primitive );
+
+    __shape_invalidate( _canvas );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_state_t ** __primitive_state( gp_handle_slot_t * _slot )
+{
+    switch( _slot->type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        return &((gp_rect_t *)_slot->primitive)->state;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        return &((gp_rounded_rect_t *)_slot->primitive)->state;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        return &((gp_ellipse_t *)_slot->primitive)->state;
+    default:
+        return GP_NULLPTR;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_shape_set_color( gp_canvas_t * _canvas, gp_shape_handle_t _handle, float _r, float _g, float _b, float _a )
+{
+    gp_handle_slot_t * slot = __handle_slot( _canvas, _handle );
+
+    if( slot == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_shape_set_color: invalid handle" );
+
+        return GP_FAILURE;
+    }
+
+#if defined(GP_VALIDATION)
+    if( _r > 1.f || _r < 0.f ||
+        _g > 1.f || _g < 0.f ||
+        _b > 1.f || _b < 0.f ||
+        _a > 1.f || _a < 0.f )
+    {
+        gp_validation_report( _canvas, "gp_shape_set_color: color component out of [0, 1]" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    const gp_state_t ** primitive_state = __primitive_state( slot );
+
+    gp_mesh_size_range_unlink( _canvas, slot->type, slot->primitive );
+    gp_hash_shape_remove( _canvas, slot->type, slot->primitive );
+
+    if( slot->state == GP_NULLPTR )
+    {
+        gp_state_t * s = GP_NEW( _canvas, gp_state_t );
+
+        *s = **primitive_state;
+
+        s->next = GP_NULLPTR;
+        s->prev = GP_NULLPTR;
+
+        GP_LIST_PUSHBACK( gp_state_t, _canvas->states, s );
+
+        _canvas->state_invalidate = GP_TRUE;
+
+        slot->state = s;
+
+        *primitive_state = s;
+    }
+
+    gp_state_t * state = slot->state;
+
+    state->color.r = _r;
+    state->color.g = _g;
+    state->color.b = _b;
+    state->color.a = _a;
+
+    state->argb = gp_color_argb( &state->color );
+    state->hash = gp_hash_state( state );
+
+    gp_mesh_size_range_link( _canvas, slot->type, slot->primitive );
+    gp_hash_shape_append( _canvas, slot->type, slot->primitive );
+
+    __shape_invalidate( _canvas );
+
+    return GP_SUCCESSFUL;
+}
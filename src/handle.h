@@ -0,0 +1,12 @@
+#ifndef GP_HANDLE_H_
+#define GP_HANDLE_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+void gp_handle_table_reset( gp_canvas_t * _canvas );
+void gp_handle_table_retire( gp_canvas_t * _canvas );
+void gp_handle_table_free( gp_canvas_t * _canvas );
+
+#endif
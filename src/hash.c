@@ -0,0 +1,326 @@
+#include "hash.h"
+
+#include "detail.h"
+
+//////////////////////////////////////////////////////////////////////////
+#define GP_HASH_PRIME (0x00000100000001b3ULL)
+//////////////////////////////////////////////////////////////////////////
+typedef union gp_hash_float_t
+{
+    float f;
+    gp_uint32_t u;
+} gp_hash_float_t;
+//////////////////////////////////////////////////////////////////////////
+gp_uint64_t gp_hash_bytes( gp_uint64_t _hash, const void * _data, gp_size_t _size )
+{
+    gp_uint64_t hash = _hash;
+
+    const gp_uint8_t * data = (const gp_uint8_t *)_data;
+
+    for( gp_size_t index = 0; index != _size; ++index )
+    {
+        hash ^= data[index];
+        hash *= GP_HASH_PRIME;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_uint64_t gp_hash_u32( gp_uint64_t _hash, gp_uint32_t _value )
+{
+    gp_uint8_t bytes[4];
+    bytes[0] = (gp_uint8_t)(_value >> 0);
+    bytes[1] = (gp_uint8_t)(_value >> 8);
+    bytes[2] = (gp_uint8_t)(_value >> 16);
+    bytes[3] = (gp_uint8_t)(_value >> 24);
+
+    return gp_hash_bytes( _hash, bytes, 4 );
+}
+//////////////////////////////////////////////////////////////////////////
+gp_uint64_t gp_hash_u64( gp_uint64_t _hash, gp_uint64_t _value )
+{
+    gp_uint64_t hash = _hash;
+
+    hash = gp_hash_u32( hash, (gp_uint32_t)(_value >> 0) );
+    hash = gp_hash_u32( hash, (gp_uint32_t)(_value >> 32) );
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_uint64_t gp_hash_f32( gp_uint64_t _hash, float _value )
+{
+    gp_hash_float_t v;
+    v.f = _value;
+
+    return gp_hash_u32( _hash, v.u );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t __hash_color( gp_uint64_t _hash, const gp_color_t * _color )
+{
+    gp_uint64_t hash = _hash;
+
+    hash = gp_hash_f32( hash, _color->r );
+    hash = gp_hash_f32( hash, _color->g );
+    hash = gp_hash_f32( hash, _color->b );
+    hash = gp_hash_f32( hash, _color->a );
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t __hash_vec2f( gp_uint64_t _hash, const gp_vec2f_t * _v )
+{
+    gp_uint64_t hash = _hash;
+
+    hash = gp_hash_f32( hash, _v->x );
+    hash = gp_hash_f32( hash, _v->y );
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_uint64_t gp_hash_state( const gp_state_t * _state )
+{
+    gp_uint64_t hash = GP_HASH_OFFSET_BASIS;
+
+    hash = gp_hash_u32( hash, _state->fill );
+    hash = gp_hash_u32( hash, _state->sdf );
+
+    hash = gp_hash_f32( hash, _state->thickness );
+    hash = gp_hash_f32( hash, _state->outline_width );
+    hash = gp_hash_f32( hash, _state->penumbra );
+
+    hash = gp_hash_u32( hash, _state->line_join );
+    hash = gp_hash_f32( hash, _state->miter_limit );
+
+    hash = gp_hash_u32( hash, _state->dash_count );
+
+    for( gp_uint32_t index = 0; index != _state->dash_count; ++index )
+    {
+        hash = gp_hash_f32( hash, _state->dash_pattern[index] );
+    }
+
+    hash = gp_hash_f32( hash, _state->dash_offset );
+
+    hash = __hash_color( hash, &_state->color );
+    hash = __hash_color( hash, &_state->outline_color );
+
+    if( _state->gradient != GP_GRADIENT_NONE )
+    {
+        hash = gp_hash_u32( hash, _state->gradient );
+        hash = gp_hash_f32( hash, _state->gradient_x0 );
+        hash = gp_hash_f32( hash, _state->gradient_y0 );
+        hash = gp_hash_f32( hash, _state->gradient_x1 );
+        hash = gp_hash_f32( hash, _state->gradient_y1 );
+        hash = gp_hash_f32( hash, _state->gradient_radius );
+        hash = gp_hash_u32( hash, _state->gradient_stop_count );
+
+        for( gp_uint32_t index = 0; index != _state->gradient_stop_count; ++index )
+        {
+            const gp_gradient_stop_t * stop = _state->gradient_stops + index;
+
+            hash = gp_hash_f32( hash, stop->offset );
+            hash = __hash_color( hash, &stop->color );
+        }
+    }
+
+    hash = gp_hash_f32( hash, _state->uv_ou );
+    hash = gp_hash_f32( hash, _state->uv_ov );
+    hash = gp_hash_f32( hash, _state->uv_su );
+    hash = gp_hash_f32( hash, _state->uv_sv );
+
+    hash = gp_hash_u32( hash, _state->material );
+    hash = gp_hash_u32( hash, _state->blend );
+
+    hash = gp_hash_u32( hash, _state->curve_quality );
+    hash = gp_hash_u32( hash, _state->ellipse_quality );
+    hash = gp_hash_u32( hash, _state->rect_quality );
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_hash_line_point( gp_uint64_t * _hash, const gp_line_point_t * _point, const gp_line_edge_t * _edge )
+{
+    gp_uint64_t hash = *_hash;
+
+    if( _edge == GP_NULLPTR )
+    {
+        hash = gp_hash_u32( hash, ~0U );
+    }
+    else
+    {
+        hash = gp_hash_u32( hash, _edge->controls );
+
+        for( gp_uint32_t index = 0; index != _edge->controls; ++index )
+        {
+            hash = __hash_vec2f( hash, _edge->p + index );
+        }
+    }
+
+    hash = __hash_vec2f( hash, &_point->p );
+    hash = gp_hash_u64( hash, _point->state->hash );
+
+    *_hash = hash;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_hash_rect( gp_uint64_t * _hash, const gp_rect_t * _rect )
+{
+    gp_uint64_t hash = *_hash;
+
+    hash = __hash_vec2f( hash, &_rect->point );
+    hash = gp_hash_f32( hash, _rect->width );
+    hash = gp_hash_f32( hash, _rect->height );
+    hash = gp_hash_u64( hash, _rect->state->hash );
+
+    *_hash = hash;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_hash_rounded_rect( gp_uint64_t * _hash, const gp_rounded_rect_t * _rounded_rect )
+{
+    gp_uint64_t hash = *_hash;
+
+    hash = __hash_vec2f( hash, &_rounded_rect->point );
+    hash = gp_hash_f32( hash, _rounded_rect->width );
+    hash = gp_hash_f32( hash, _rounded_rect->height );
+    hash = gp_hash_f32( hash, _rounded_rect->radius[0] );
+
+    if( gp_rounded_rect_is_uniform( _rounded_rect ) == GP_FALSE )
+    {
+        hash = gp_hash_f32( hash, _rounded_rect->radius[1] );
+        hash = gp_hash_f32( hash, _rounded_rect->radius[2] );
+        hash = gp_hash_f32( hash, _rounded_rect->radius[3] );
+    }
+
+    hash = gp_hash_u64( hash, _rounded_rect->state->hash );
+
+    *_hash = hash;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_hash_ellipse( gp_uint64_t * _hash, const gp_ellipse_t * _ellipse )
+{
+    gp_uint64_t hash = *_hash;
+
+    hash = __hash_vec2f( hash, &_ellipse->point );
+    hash = gp_hash_f32( hash, _ellipse->radius_width );
+    hash = gp_hash_f32( hash, _ellipse->radius_height );
+
+    if( gp_ellipse_is_arc( _ellipse ) == GP_TRUE )
+    {
+        hash = gp_hash_f32( hash, _ellipse->angle_start );
+        hash = gp_hash_f32( hash, _ellipse->angle_sweep );
+    }
+
+    hash = gp_hash_u64( hash, _ellipse->state->hash );
+
+    *_hash = hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t * __hash_shape_total( gp_canvas_t * _canvas, gp_shape_type_e _type )
+{
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        return &_canvas->hash_rects;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        return &_canvas->hash_rounded_rects;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        return &_canvas->hash_ellipses;
+    default:
+        return GP_NULLPTR;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+gp_uint64_t gp_hash_shape( gp_shape_type_e _type, const void * _primitive )
+{
+    gp_uint64_t hash = GP_HASH_OFFSET_BASIS;
+
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        {
+            gp_hash_rect( &hash, (const gp_rect_t *)_primitive );
+        }break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        {
+            gp_hash_rounded_rect( &hash, (const gp_rounded_rect_t *)_primitive );
+        }break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        {
+            gp_hash_ellipse( &hash, (const gp_ellipse_t *)_primitive );
+        }break;
+    default:
+        break;
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t __hash_shape_pair( gp_uint64_t _prev, gp_uint64_t _next )
+{
+    gp_uint64_t hash = GP_HASH_OFFSET_BASIS;
+
+    hash = gp_hash_u64( hash, _prev );
+    hash = gp_hash_u64( hash, _next );
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint64_t __hash_shape_weight( const gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    const void * prev = GP_NULLPTR;
+    const void * next = GP_NULLPTR;
+
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        {
+            const gp_rect_t * r = (const gp_rect_t *)_primitive;
+
+            prev = r == _canvas->rects ? GP_NULLPTR : r->prev;
+            next = r->next;
+        }break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        {
+            const gp_rounded_rect_t * rr = (const gp_rounded_rect_t *)_primitive;
+
+            prev = rr == _canvas->rounded_rects ? GP_NULLPTR : rr->prev;
+            next = rr->next;
+        }break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        {
+            const gp_ellipse_t * e = (const gp_ellipse_t *)_primitive;
+
+            prev = e == _canvas->ellipses ? GP_NULLPTR : e->prev;
+            next = e->next;
+        }break;
+    default:
+        return 0;
+    }
+
+    gp_uint64_t hash = gp_hash_shape( _type, _primitive );
+    gp_uint64_t hash_prev = prev == GP_NULLPTR ? GP_HASH_OFFSET_BASIS : gp_hash_shape( _type, prev );
+
+    gp_uint64_t weight = __hash_shape_pair( hash_prev, hash );
+
+    if( next != GP_NULLPTR )
+    {
+        gp_uint64_t hash_next = gp_hash_shape( _type, next );
+
+        weight += __hash_shape_pair( hash, hash_next );
+        weight -= __hash_shape_pair( hash_prev, hash_next );
+    }
+
+    return weight;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_hash_shape_append( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    gp_uint64_t * total = __hash_shape_total( _canvas, _type );
+
+    *total += __hash_shape_weight( _canvas, _type, _primitive );
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_hash_shape_remove( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    gp_uint64_t * total = __hash_shape_total( _canvas, _type );
+
+    *total -= __hash_shape_weight( _canvas, _type, _primitive );
+}
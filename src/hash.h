@@ -0,0 +1,26 @@
+#ifndef GP_HASH_H_
+#define GP_HASH_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+#define GP_HASH_OFFSET_BASIS (0xcbf29ce484222325ULL)
+
+gp_uint64_t gp_hash_bytes( gp_uint64_t _hash, const void * _data, gp_size_t _size );
+gp_uint64_t gp_hash_u32( gp_uint64_t _hash, gp_uint32_t _value );
+gp_uint64_t gp_hash_u64( gp_uint64_t _hash, gp_uint64_t _value );
+gp_uint64_t gp_hash_f32( gp_uint64_t _hash, float _value );
+
+gp_uint64_t gp_hash_state( const gp_state_t * _state );
+
+void gp_hash_line_point( gp_uint64_t * _hash, const gp_line_point_t * _point, const gp_line_edge_t * _edge );
+void gp_hash_rect( gp_uint64_t * _hash, const gp_rect_t * _rect );
+void gp_hash_rounded_rect( gp_uint64_t * _hash, const gp_rounded_rect_t * _rounded_rect );
+void gp_hash_ellipse( gp_uint64_t * _hash, const gp_ellipse_t * _ellipse );
+
+gp_uint64_t gp_hash_shape( gp_shape_type_e _type, const void * _primitive );
+void gp_hash_shape_append( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive );
+void gp_hash_shape_remove( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive );
+
+#endif
@@ -0,0 +1,137 @@
+#include "joint.h"
+
+#include "detail.h"
+
+#if defined(GP_ENABLE_SSE)
+#include <xmmintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+#define GP_JOINT_LENGTH_EPSILON (0.000001f)
+#define GP_JOINT_MITER_EPSILON (0.00001f)
+//////////////////////////////////////////////////////////////////////////
+#if defined(GP_ENABLE_SSE)
+//////////////////////////////////////////////////////////////////////////
+static void __joint_batch_calculate_perps( gp_joint_batch_t * _batch, gp_uint32_t _segment_count )
+{
+    const __m128 half = _mm_set1_ps( 0.5f );
+    const __m128 three_half = _mm_set1_ps( 1.5f );
+    const __m128 eps = _mm_set1_ps( GP_JOINT_LENGTH_EPSILON );
+
+    for( gp_uint32_t index = 0; index < _segment_count; index += 4 )
+    {
+        __m128 x0 = _mm_loadu_ps( _batch->px + index + 0 );
+        __m128 y0 = _mm_loadu_ps( _batch->py + index + 0 );
+        __m128 x1 = _mm_loadu_ps( _batch->px + index + 1 );
+        __m128 y1 = _mm_loadu_ps( _batch->py + index + 1 );
+
+        __m128 dx = _mm_sub_ps( x1, x0 );
+        __m128 dy = _mm_sub_ps( y1, y0 );
+
+        __m128 l2 = _mm_add_ps( _mm_mul_ps( dx, dx ), _mm_mul_ps( dy, dy ) );
+
+        __m128 r = _mm_rsqrt_ps( l2 );
+        r = _mm_mul_ps( r, _mm_sub_ps( three_half, _mm_mul_ps( _mm_mul_ps( half, l2 ), _mm_mul_ps( r, r ) ) ) );
+        r = _mm_and_ps( r, _mm_cmpgt_ps( l2, eps ) );
+
+        _mm_storeu_ps( _batch->nx + index, _mm_mul_ps( _mm_sub_ps( _mm_setzero_ps(), dy ), r ) );
+        _mm_storeu_ps( _batch->ny + index, _mm_mul_ps( dx, r ) );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __joint_batch_calculate_miters( gp_joint_batch_t * _batch, gp_uint32_t _joint_count )
+{
+    const __m128 one = _mm_set1_ps( 1.f );
+    const __m128 two = _mm_set1_ps( 2.f );
+    const __m128 eps = _mm_set1_ps( GP_JOINT_MITER_EPSILON );
+
+    for( gp_uint32_t index = 0; index < _joint_count; index += 4 )
+    {
+        __m128 nx0 = _mm_loadu_ps( _batch->nx + index + 0 );
+        __m128 ny0 = _mm_loadu_ps( _batch->ny + index + 0 );
+        __m128 nx1 = _mm_loadu_ps( _batch->nx + index + 1 );
+        __m128 ny1 = _mm_loadu_ps( _batch->ny + index + 1 );
+
+        __m128 d = _mm_add_ps( one, _mm_add_ps( _mm_mul_ps( nx0, nx1 ), _mm_mul_ps( ny0, ny1 ) ) );
+
+        __m128 s = _mm_rcp_ps( d );
+        s = _mm_mul_ps( s, _mm_sub_ps( two, _mm_mul_ps( d, s ) ) );
+
+        __m128 mask = _mm_cmpgt_ps( d, eps );
+
+        __m128 mx = _mm_mul_ps( _mm_add_ps( nx0, nx1 ), s );
+        __m128 my = _mm_mul_ps( _mm_add_ps( ny0, ny1 ), s );
+
+        mx = _mm_or_ps( _mm_and_ps( mask, mx ), _mm_andnot_ps( mask, nx0 ) );
+        my = _mm_or_ps( _mm_and_ps( mask, my ), _mm_andnot_ps( mask, ny0 ) );
+
+        _mm_storeu_ps( _batch->mx + index, mx );
+        _mm_storeu_ps( _batch->my + index, my );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+#else
+//////////////////////////////////////////////////////////////////////////
+static void __joint_batch_calculate_perps( gp_joint_batch_t * _batch, gp_uint32_t _segment_count )
+{
+    for( gp_uint32_t index = 0; index != _segment_count; ++index )
+    {
+        float dx = _batch->px[index + 1] - _batch->px[index];
+        float dy = _batch->py[index + 1] - _batch->py[index];
+
+        float l2 = dx * dx + dy * dy;
+
+        float r = 0.f;
+
+        if( l2 > GP_JOINT_LENGTH_EPSILON )
+        {
+            r = 1.f / GP_MATH_SQRTF( l2 );
+        }
+
+        _batch->nx[index] = -dy * r;
+        _batch->ny[index] = dx * r;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __joint_batch_calculate_miters( gp_joint_batch_t * _batch, gp_uint32_t _joint_count )
+{
+    for( gp_uint32_t index = 0; index != _joint_count; ++index )
+    {
+        float nx0 = _batch->nx[index + 0];
+        float ny0 = _batch->ny[index + 0];
+        float nx1 = _batch->nx[index + 1];
+        float ny1 = _batch->ny[index + 1];
+
+        float d = 1.f + nx0 * nx1 + ny0 * ny1;
+
+        if( d > GP_JOINT_MITER_EPSILON )
+        {
+            float s = 1.f / d;
+
+            _batch->mx[index] = (nx0 + nx1) * s;
+            _batch->my[index] = (ny0 + ny1) * s;
+        }
+        else
+        {
+            _batch->mx[index] = nx0;
+            _batch->my[index] = ny0;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+#endif
+//////////////////////////////////////////////////////////////////////////
+void gp_joint_batch_calculate( gp_joint_batch_t * _batch, gp_uint32_t _point_count )
+{
+    float lx = _batch->px[_point_count - 1];
+    float ly = _batch->py[_point_count - 1];
+
+    for( gp_uint32_t index = _point_count; index != GP_JOINT_BATCH_CAPACITY; ++index )
+    {
+        _batch->px[index] = lx;
+        _batch->py[index] = ly;
+    }
+
+    __joint_batch_calculate_perps( _batch, _point_count - 1 );
+    __joint_batch_calculate_miters( _batch, _point_count - 2 );
+}
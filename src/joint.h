@@ -0,0 +1,22 @@
+#ifndef GP_JOINT_H_
+#define GP_JOINT_H_
+
+#include "graphics/config.h"
+
+#define GP_JOINT_BATCH_CAPACITY (GP_LINE_JOINT_BATCH + 6)
+
+typedef struct gp_joint_batch_t
+{
+    float px[GP_JOINT_BATCH_CAPACITY];
+    float py[GP_JOINT_BATCH_CAPACITY];
+
+    float nx[GP_JOINT_BATCH_CAPACITY];
+    float ny[GP_JOINT_BATCH_CAPACITY];
+
+    float mx[GP_JOINT_BATCH_CAPACITY];
+    float my[GP_JOINT_BATCH_CAPACITY];
+} gp_joint_batch_t;
+
+void gp_joint_batch_calculate( gp_joint_batch_t * _batch, gp_uint32_t _point_count );
+
+#endif
@@ -2,96 +2,43 @@
 
 #include "struct.h"
 #include "detail.h"
+#include "joint.h"
 
 //////////////////////////////////////////////////////////////////////////
-static gp_result_t __calculate_mesh_line_size( const gp_canvas_t * _canvas, gp_uint16_t * const _vertex_count, gp_uint16_t * const _index_count )
+static gp_uint16_t __line_join_sections( const gp_state_t * _state, const gp_vec2f_t * _p0, const gp_vec2f_t * _p1, const gp_vec2f_t * _p2 )
 {
-    gp_uint16_t vertex_count = 0;
-    gp_uint16_t index_count = 0;
+    float d0x = _p1->x - _p0->x;
+    float d0y = _p1->y - _p0->y;
+    float d1x = _p2->x - _p1->x;
+    float d1y = _p2->y - _p1->y;
 
-    GP_LIST_FOREACH( gp_line_t, _canvas->lines, l )
-    {
-        if( l->edges == GP_NULLPTR )
-        {
-            continue;
-        }
-
-        const gp_state_t * state = l->state;
+    float angle = GP_MATH_ATAN2F( d0x * d1y - d0y * d1x, d0x * d1x + d0y * d1y );
 
-        uint8_t curve_quality = state->curve_quality;
-
-        gp_uint16_t point_count = 0;
-
-        for( const gp_line_edge_t * e = l->edges; e != GP_NULLPTR; e = e->next )
-        {
-            switch( e->controls )
-            {
-            case 0:
-                point_count += 1;
-                break;
-            case 1:
-                point_count += curve_quality;
-                break;
-            case 2:
-                point_count += curve_quality;
-                break;
-            default:
-                return GP_FAILURE;
-            }
-        }
-
-        point_count += 1;
+    if( angle < 0.f )
+    {
+        angle = -angle;
+    }
 
-        float penumbra = state->penumbra;
-        float outline_width = state->outline_width;
+    if( _state->line_join == GP_LINE_JOIN_MITER )
+    {
+        float miter_cos = GP_MATH_COSF( angle * 0.5f );
 
-        if( penumbra > 0.f )
-        {
-            vertex_count += point_count * 4;
-            index_count += (point_count - 1) * 18;
-        }
-        else
-        {
-            if( outline_width > 0.f )
-            {
-                vertex_count += point_count * 6;
-                index_count += (point_count - 1) * 18;
-
-                for( gp_uint32_t index = 0; index != 4; ++index )
-                {
-                    vertex_count += 1;
-                    vertex_count += state->rect_quality - 1;
-                    
-                    index_count += state->rect_quality * 3;
-                }
-
-                index_count += 12;
-            }
-            else
-            {
-                vertex_count += point_count * 2;
-                index_count += (point_count - 1) * 6;
-            }
-        }
+        return miter_cos * _state->miter_limit < 1.f ? 2 : 1;
     }
 
-    *_vertex_count = vertex_count;
-    *_index_count = index_count;
-
-    return GP_SUCCESSFUL;
-}
-//////////////////////////////////////////////////////////////////////////
-gp_result_t gp_calculate_mesh_line_size( const gp_canvas_t * _canvas, gp_mesh_t * _mesh )
-{
-    gp_uint16_t vertex_count = 0;
-    gp_uint16_t index_count = 0;
+    float steps = angle * (float)_state->ellipse_quality / gp_constant_two_pi;
 
-    GP_CALL( __calculate_mesh_line_size, (_canvas, &vertex_count, &index_count) );
+    if( steps <= 1.f )
+    {
+        return 1;
+    }
 
-    _mesh->vertex_count += vertex_count;
-    _mesh->index_count += index_count;
+    if( _state->line_join == GP_LINE_JOIN_BEVEL )
+    {
+        return 2;
+    }
 
-    return GP_SUCCESSFUL;
+    return (gp_uint16_t)(-GP_MATH_FLOORF( -steps )) + 1;
 }
 //////////////////////////////////////////////////////////////////////////
 static inline float __vec2f_sqrlength( const gp_vec2f_t * _p )
@@ -215,926 +162,1063 @@ static inline void __calculate_bezier_position( gp_vec2f_t * _out, const gp_vec2
     }
 }
 //////////////////////////////////////////////////////////////////////////
-static inline void __make_line_from_two_point_v2( gp_linef_t * _line, const gp_vec2f_t * _a, const gp_vec2f_t * _b )
+static inline float __lerp( float _a, float _b, float _t )
+{
+    return _a * (1.f - _t) + _b * _t;
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_line_flatten_t
+{
+    const gp_mesh_t * mesh;
+    const gp_state_t * state;
+
+    const gp_line_point_t * point;
+    const gp_line_edge_t * edge;
+
+    gp_uint8_t step;
+    float t;
+} gp_line_flatten_t;
+//////////////////////////////////////////////////////////////////////////
+static void __line_flatten_begin( gp_line_flatten_t * _flatten, const gp_mesh_t * _mesh, const gp_line_t * _line )
 {
-    float a = _b->y - _a->y;
-    float b = _a->x - _b->x;
+    _flatten->mesh = _mesh;
+    _flatten->state = _line->state;
+
+    _flatten->point = _line->points;
+    _flatten->edge = _line->edges;
 
-    _line->a = a;
-    _line->b = b;
-    _line->c = a * _a->x + b * _a->y;
+    _flatten->step = 0;
+    _flatten->t = 0.f;
 }
 //////////////////////////////////////////////////////////////////////////
-static inline float __cross2( float _a, float _b, float _c, float _d )
+static void __line_flatten_color( const gp_line_flatten_t * _flatten, const gp_state_t * _s0, const gp_state_t * _s1, float _t, gp_points_t * _point )
 {
-    return _a * _d - _c * _b;
+    const gp_mesh_t * mesh = _flatten->mesh;
+
+    if( mesh == GP_NULLPTR )
+    {
+        return;
+    }
+
+    if( _s0 == _s1 || _t == 0.f )
+    {
+        _point->argb = gp_mesh_color( mesh, gp_color_tint_argb( &mesh->color, &_s0->color, _s0->argb ) );
+        _point->outline_argb = gp_mesh_color( mesh, gp_color_tint_argb( &mesh->color, &_s0->outline_color, _s0->outline_argb ) );
+
+        return;
+    }
+
+    _point->argb = gp_mesh_color( mesh, gp_color_lerp_argb( &mesh->color, &_s0->color, &_s1->color, _t ) );
+
+    _point->outline_argb = 0xffffffff;
+
+    if( _flatten->state->outline_width > 0.f )
+    {
+        _point->outline_argb = gp_mesh_color( mesh, gp_color_lerp_argb( &mesh->color, &_s0->outline_color, &_s1->outline_color, _t ) );
+    }
 }
 //////////////////////////////////////////////////////////////////////////
-static inline gp_bool_t __intersect_line( const gp_linef_t * _l1, const gp_linef_t * _l2, gp_vec2f_t * _p )
+static gp_bool_t __line_flatten_next( gp_line_flatten_t * _flatten, gp_points_t * _point )
 {
-    float zn = __cross2( _l1->a, _l1->b, _l2->a, _l2->b );
+    const gp_line_point_t * p0 = _flatten->point;
 
-    if( GP_EQUAL_F( zn, 0.00001f ) == GP_TRUE )
+    if( p0 == GP_NULLPTR )
     {
         return GP_FALSE;
     }
 
-    float inv_zn = 1.f / zn;
+    const gp_line_edge_t * e = _flatten->edge;
+
+    if( e == GP_NULLPTR )
+    {
+        _point->p = p0->p;
+        __line_flatten_color( _flatten, p0->state, p0->state, 0.f, _point );
+
+        _flatten->point = GP_NULLPTR;
+
+        return GP_TRUE;
+    }
+
+    const gp_line_point_t * p1 = p0->next;
+
+    if( e->controls == 0 )
+    {
+        _point->p = p0->p;
+        __line_flatten_color( _flatten, p0->state, p1->state, 0.f, _point );
+
+        _flatten->point = p1;
+        _flatten->edge = e->next;
+
+        return GP_TRUE;
+    }
+
+    float t = _flatten->t;
+
+    __calculate_bezier_position( &_point->p, &p0->p, &p1->p, e->p, e->controls, t );
+    __line_flatten_color( _flatten, p0->state, p1->state, t, _point );
 
-    _p->x = __cross2( _l1->c, _l1->b, _l2->c, _l2->b ) * inv_zn;
-    _p->y = __cross2( _l1->a, _l1->c, _l2->a, _l2->c ) * inv_zn;
+    _flatten->t += _flatten->state->curve_quality_inv;
+
+    if( ++_flatten->step == _flatten->state->curve_quality )
+    {
+        _flatten->step = 0;
+        _flatten->t = 0.f;
+
+        _flatten->point = p1;
+        _flatten->edge = e->next;
+    }
 
     return GP_TRUE;
 }
 //////////////////////////////////////////////////////////////////////////
-static inline float __lerp( float _a, float _b, float _t )
+static float __line_flatten_distance( const gp_mesh_t * _mesh, const gp_line_t * _line )
 {
-    return _a * (1.f - _t) + _b * _t;
+    gp_line_flatten_t flatten;
+    __line_flatten_begin( &flatten, _mesh, _line );
+
+    gp_points_t p0;
+    __line_flatten_next( &flatten, &p0 );
+
+    float total_distance = 0.f;
+
+    gp_points_t p1;
+    while( __line_flatten_next( &flatten, &p1 ) == GP_TRUE )
+    {
+        float d = __vec2f_distance( &p0.p, &p1.p );
+
+        total_distance += d;
+
+        p0 = p1;
+    }
+
+    return total_distance;
 }
 //////////////////////////////////////////////////////////////////////////
-static inline void __lerp_color( gp_color_t * _c, const gp_color_t * _a, const gp_color_t * _b, float _t )
-{
-    _c->r = __lerp( _a->r, _b->r, _t );
-    _c->g = __lerp( _a->g, _b->g, _t );
-    _c->b = __lerp( _a->b, _b->b, _t );
-    _c->a = __lerp( _a->a, _b->a, _t );
-}
+#define GP_LINE_DASH_EPSILON (0.0001f)
 //////////////////////////////////////////////////////////////////////////
-typedef struct gp_line_point_render_cache_t
+typedef struct gp_line_path_t
 {
-    gp_points_t points[GP_LINE_POINTS_MAX];
-    gp_uint16_t size;
-
-#if defined(GP_DISABLE_EXTRA_LINE_POINTS)
-    gp_points_t * extra_points;
-    gp_uint16_t extra_capacity;
-#endif
-} gp_line_point_render_cache_t;
+    gp_line_flatten_t flatten;
+
+    const float * dash_pattern;
+    gp_uint32_t dash_count;
+    gp_uint32_t dash_period;
+    gp_uint32_t dash_index;
+    float dash_remain;
+
+    gp_points_t p0;
+    gp_points_t p1;
+
+    float segment_length;
+    float segment_position;
+
+    float distance;
+    float emit_distance;
+
+    gp_bool_t open;
+} gp_line_path_t;
 //////////////////////////////////////////////////////////////////////////
-static gp_points_t * __get_render_point( gp_line_point_render_cache_t * _cache, gp_uint16_t _index )
+static void __line_path_begin( gp_line_path_t * _path, const gp_mesh_t * _mesh, const gp_line_t * _line )
 {
-#if defined(GP_DISABLE_EXTRA_LINE_POINTS)
-    return _cache->points + _index;
-#else
-    if( _index < GP_LINE_POINTS_MAX )
+    __line_flatten_begin( &_path->flatten, _mesh, _line );
+
+    const gp_state_t * state = _line->state;
+
+    _path->dash_pattern = state->dash_pattern;
+    _path->dash_count = state->dash_count;
+    _path->open = GP_FALSE;
+
+    if( state->dash_count == 0 )
     {
-        return _cache->points + _index;
+        return;
     }
 
-    return _cache->extra_points + _index - GP_LINE_POINTS_MAX;
-#endif
-}
-//////////////////////////////////////////////////////////////////////////
-static inline gp_result_t __incref_render_points( const gp_canvas_t * _canvas, gp_line_point_render_cache_t * _cache )
-{
-    if( (++_cache->size) < GP_LINE_POINTS_MAX )
+    gp_uint32_t dash_count = state->dash_count;
+    gp_uint32_t dash_period = (dash_count % 2 == 0) ? dash_count : dash_count * 2;
+
+    float period_length = 0.f;
+
+    for( gp_uint32_t index = 0; index != dash_period; ++index )
     {
-        return GP_SUCCESSFUL;
+        period_length += state->dash_pattern[index % dash_count];
     }
 
-#if defined(GP_DISABLE_EXTRA_LINE_POINTS)
-    GP_UNUSED( _canvas );
+    if( period_length <= GP_LINE_DASH_EPSILON )
+    {
+        _path->dash_count = 0;
 
-    return GP_FAILURE;
-#else
-    if( (_cache->size - GP_LINE_POINTS_MAX) < _cache->extra_capacity )
+        return;
+    }
+
+    float offset = state->dash_offset - period_length * GP_MATH_FLOORF( state->dash_offset / period_length );
+
+    gp_uint32_t dash_index = 0;
+
+    while( offset >= state->dash_pattern[dash_index % dash_count] )
     {
-        return GP_SUCCESSFUL;
+        offset -= state->dash_pattern[dash_index % dash_count];
+
+        dash_index = (dash_index + 1) % dash_period;
     }
 
-    _cache->extra_capacity += GP_LINE_POINTS_MAX;
+    _path->dash_period = dash_period;
+    _path->dash_index = dash_index;
+    _path->dash_remain = state->dash_pattern[dash_index % dash_count] - offset;
 
-    void * p = GP_REALLOC( _canvas, _cache->extra_points, gp_points_t, _cache->extra_capacity );
+    __line_flatten_next( &_path->flatten, &_path->p1 );
 
-    _cache->extra_points = p;
+    _path->p0 = _path->p1;
 
-    return GP_SUCCESSFUL;
-#endif
+    _path->segment_length = 0.f;
+    _path->segment_position = 0.f;
+
+    _path->distance = 0.f;
+    _path->emit_distance = 0.f;
 }
 //////////////////////////////////////////////////////////////////////////
-#if defined( GP_DEBUG )
-#define GP_POINTS_INCREF() if( __incref_render_points( _canvas, &points_cache ) == GP_FAILURE ) return GP_FAILURE
-#else
-#define GP_POINTS_INCREF() __incref_render_points( _canvas, &points_cache )
-#endif
-//////////////////////////////////////////////////////////////////////////
-#define GP_GET_POINT(i) __get_render_point( &points_cache, i )
+static void __line_path_dash_advance( gp_line_path_t * _path )
+{
+    _path->dash_index = (_path->dash_index + 1) % _path->dash_period;
+    _path->dash_remain = _path->dash_pattern[_path->dash_index % _path->dash_count];
+}
 //////////////////////////////////////////////////////////////////////////
-gp_result_t gp_render_line( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator )
+static void __line_path_emit( gp_line_path_t * _path, gp_points_t * _point, float * _distance )
 {
-    gp_uint16_t vertex_iterator = *_vertex_iterator;
-    gp_uint16_t index_iterator = *_index_iterator;
+    float segment_length = _path->segment_length;
+    float segment_position = _path->segment_position;
 
-    GP_LIST_FOREACH( gp_line_t, _canvas->lines, l )
+    if( segment_position >= segment_length )
     {
-        if( l->edges == GP_NULLPTR )
-        {
-            continue;
-        }
+        *_point = _path->p1;
+    }
+    else
+    {
+        float t = segment_position / segment_length;
 
-        const gp_state_t * state = l->state;
+        *_point = _path->p0;
+        _point->p.x = __lerp( _path->p0.p.x, _path->p1.p.x, t );
+        _point->p.y = __lerp( _path->p0.p.y, _path->p1.p.y, t );
+    }
+
+    float distance = _path->distance + segment_position;
 
-        float thickness = state->thickness;
-        float outline_width = state->outline_width;
-        float half_thickness = thickness * 0.5f;
+    _path->emit_distance = distance;
 
-        uint8_t curve_quality = state->curve_quality;
-        float curve_quality_inv = state->curve_quality_inv;
+    *_distance = distance;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __line_path_next( gp_line_path_t * _path, gp_points_t * _point, float * _distance, gp_bool_t * _begin )
+{
+    if( _path->dash_count == 0 )
+    {
+        *_begin = (_path->open == GP_FALSE) ? GP_TRUE : GP_FALSE;
+        *_distance = 0.f;
 
-        gp_line_point_render_cache_t points_cache;
-        points_cache.size = 0;
+        _path->open = GP_TRUE;
 
-#if defined(GP_DISABLE_EXTRA_LINE_POINTS)
-        points_cache.extra_capacity = 0;
-        points_cache.extra_points = GP_NULLPTR;
-#endif
+        return __line_flatten_next( &_path->flatten, _point );
+    }
 
+    for( ;; )
+    {
+        if( _path->segment_position >= _path->segment_length )
         {
-            const gp_line_point_t * point_iterator = l->points;
+            _path->p0 = _path->p1;
+            _path->distance += _path->segment_length;
 
-            for( const gp_line_edge_t * e = l->edges; e != GP_NULLPTR; e = e->next )
+            if( __line_flatten_next( &_path->flatten, &_path->p1 ) == GP_FALSE )
             {
-                const gp_line_point_t * p0 = point_iterator;
-                point_iterator = point_iterator->next;
-
-                gp_color_t point_color0;
-                gp_color_mul( &point_color0, &_mesh->color, &p0->state->color );
-                gp_argb_t argb0 = gp_color_argb( &point_color0 );
-
-                gp_argb_t outline_argb0 = 0xffffffff;
-
-                if( outline_width > 0.f )
-                {
-                    gp_color_t point_outline_color0;
-                    gp_color_mul( &point_outline_color0, &_mesh->color, &p0->state->outline_color );
-                    outline_argb0 = gp_color_argb( &point_outline_color0 );
-                }
-
-                switch( e->controls )
-                {
-                case 0:
-                    {
-                        gp_points_t * p = GP_GET_POINT( points_cache.size );
-                        p->p = p0->p;
-                        p->argb = argb0;
-                        p->outline_argb = outline_argb0;
-
-                        GP_POINTS_INCREF();
-                    }break;
-                case 1:
-                    {
-                        const gp_line_point_t * p1 = point_iterator;
-
-                        float t = 0.f;
-
-                        for( gp_uint8_t index = 0; index != curve_quality; ++index )
-                        {
-                            gp_color_t color01;
-                            __lerp_color( &color01, &p0->state->color, &p1->state->color, t );
-
-                            gp_color_t point_color1;
-                            gp_color_mul( &point_color1, &_mesh->color, &color01 );
-                            gp_argb_t argb01 = gp_color_argb( &point_color1 );
-
-                            gp_argb_t outline_argb01 = 0xffffffff;
-
-                            if( outline_width > 0.f )
-                            {
-                                gp_color_t outline_color01;
-                                __lerp_color( &outline_color01, &p0->state->outline_color, &p1->state->outline_color, t );
-
-                                gp_color_t point_outline_color1;
-                                gp_color_mul( &point_outline_color1, &_mesh->color, &outline_color01 );
-                                outline_argb01 = gp_color_argb( &point_outline_color1 );
-                            }
-
-                            gp_vec2f_t bp;
-                            __calculate_bezier_position( &bp, &p0->p, &p1->p, e->p, 1, t );
-
-                            t += curve_quality_inv;
-
-                            gp_points_t * p = GP_GET_POINT( points_cache.size );
-                            p->p = bp;
-                            p->argb = argb01;
-                            p->outline_argb = outline_argb01;
-
-                            GP_POINTS_INCREF();
-                        }
-                    }break;
-                case 2:
-                    {
-                        const gp_line_point_t * p1 = point_iterator;
-
-                        float t = 0.f;
-
-                        for( gp_uint8_t index = 0; index != curve_quality; ++index )
-                        {
-                            gp_color_t color01;
-                            __lerp_color( &color01, &p0->state->color, &p1->state->color, t );
-
-                            gp_color_t point_color1;
-                            gp_color_mul( &point_color1, &_mesh->color, &color01 );
-                            gp_argb_t argb01 = gp_color_argb( &point_color1 );
-
-                            gp_argb_t outline_argb01 = 0xffffffff;
-
-                            if( outline_width > 0.f )
-                            {
-                                gp_color_t outline_color01;
-                                __lerp_color( &outline_color01, &p0->state->outline_color, &p1->state->outline_color, t );
-
-                                gp_color_t point_outline_color1;
-                                gp_color_mul( &point_outline_color1, &_mesh->color, &outline_color01 );
-                                outline_argb01 = gp_color_argb( &point_outline_color1 );
-                            }
-
-                            gp_vec2f_t bp;
-                            __calculate_bezier_position( &bp, &p0->p, &p1->p, e->p, 2, t );
-
-                            t += curve_quality_inv;
-
-                            gp_points_t * p = GP_GET_POINT( points_cache.size );
-                            p->p = bp;
-                            p->argb = argb01;
-                            p->outline_argb = outline_argb01;
-
-                            GP_POINTS_INCREF();
-                        }
-                    }break;
-                default:
-                    return GP_FAILURE;
-                }
+                return GP_FALSE;
             }
 
-            {
-                const gp_line_point_t * p1 = point_iterator;
+            _path->segment_length = __vec2f_distance( &_path->p0.p, &_path->p1.p );
+            _path->segment_position = 0.f;
+
+            continue;
+        }
 
-                gp_color_t point_color1;
-                gp_color_mul( &point_color1, &_mesh->color, &p1->state->color );
-                gp_argb_t argb1 = gp_color_argb( &point_color1 );
+        gp_bool_t on = (_path->dash_index % 2 == 0) ? GP_TRUE : GP_FALSE;
 
-                gp_points_t * p = GP_GET_POINT( points_cache.size );
-                p->p = p1->p;
-                p->argb = argb1;
+        if( on == GP_TRUE && _path->open == GP_FALSE )
+        {
+            if( _path->dash_remain <= GP_LINE_DASH_EPSILON )
+            {
+                _path->segment_position += _path->dash_remain;
+
+                __line_path_dash_advance( _path );
 
-                GP_POINTS_INCREF();
+                continue;
             }
-        }
 
-        gp_uint16_t begin_vertex_iterator = vertex_iterator;
+            _path->open = GP_TRUE;
+
+            __line_path_emit( _path, _point, _distance );
+
+            *_begin = GP_TRUE;
 
-        float penumbra = state->penumbra;
+            return GP_TRUE;
+        }
+
+        float rest = _path->segment_length - _path->segment_position;
 
-        if( penumbra > 0.f )
+        if( _path->dash_remain <= rest )
         {
-            for( gp_uint16_t index = 0; index != points_cache.size - 1; ++index )
+            _path->segment_position += _path->dash_remain;
+
+            __line_path_dash_advance( _path );
+
+            if( on == GP_FALSE )
             {
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + index * 4 + 0) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + index * 4 + 1) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + index * 4 + 4) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + index * 4 + 4) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + index * 4 + 1) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + index * 4 + 5) );
-
-                index_iterator += 6;
-
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + index * 4 + 1) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + index * 4 + 2) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + index * 4 + 5) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + index * 4 + 5) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + index * 4 + 2) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + index * 4 + 6) );
-
-                index_iterator += 6;
-
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + index * 4 + 2) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + index * 4 + 3) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + index * 4 + 6) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + index * 4 + 6) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + index * 4 + 3) );
-                GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + index * 4 + 7) );
-
-                index_iterator += 6;
+                continue;
             }
+
+            _path->open = GP_FALSE;
         }
         else
         {
-            if( outline_width > 0.f )
-            {
-                for( gp_uint16_t index = 0; index != points_cache.size - 1; ++index )
-                {
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + index * 6 + 0) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + index * 6 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + index * 6 + 6) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + index * 6 + 6) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + index * 6 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + index * 6 + 7) );
-
-                    index_iterator += 6;
-
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + index * 6 + 2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + index * 6 + 3) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + index * 6 + 8) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + index * 6 + 8) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + index * 6 + 3) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + index * 6 + 9) );
-
-                    index_iterator += 6;
-
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + index * 6 + 4) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + index * 6 + 5) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + index * 6 + 10) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + index * 6 + 10) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + index * 6 + 5) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + index * 6 + 11) );
-
-                    index_iterator += 6;
-                }
-            }
-            else
+            _path->dash_remain -= rest;
+            _path->segment_position = _path->segment_length;
+
+            if( on == GP_FALSE )
             {
-                for( gp_uint16_t index = 0; index != points_cache.size - 1; ++index )
-                {
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, vertex_iterator + index * 2 + 0) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + index * 2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + index * 2 + 2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, vertex_iterator + index * 2 + 2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, vertex_iterator + index * 2 + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, vertex_iterator + index * 2 + 3) );
-
-                    index_iterator += 6;
-                }
+                continue;
             }
         }
 
-        float half_thickness_soft = 0.f;
-        float uv_soft_offset = 0.f;
-
-        if( penumbra > 0.f )
+        if( _path->distance + _path->segment_position - _path->emit_distance <= GP_LINE_DASH_EPSILON )
         {
-            half_thickness_soft = half_thickness - penumbra;
-            uv_soft_offset = half_thickness_soft / half_thickness * 0.5f;
+            continue;
         }
 
-        float total_distance = 0.f;
+        __line_path_emit( _path, _point, _distance );
+
+        *_begin = GP_FALSE;
+
+        return GP_TRUE;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __calculate_mesh_polyline_size( const gp_state_t * _state, gp_uint32_t _section_count, gp_uint32_t * const _vertex_count, gp_uint32_t * const _index_count )
+{
+    gp_uint32_t section_count = _section_count;
+
+    float penumbra = _state->penumbra;
+    float outline_width = _state->outline_width;
 
-        if( _mesh->uv_buffer != GP_NULLPTR )
+    if( penumbra > 0.f )
+    {
+        *_vertex_count += section_count * 4;
+        *_index_count += (section_count - 1) * 18;
+    }
+    else
+    {
+        if( outline_width > 0.f )
         {
-            for( gp_uint16_t index = 1; index != points_cache.size; ++index )
-            {
-                const gp_vec2f_t * p0 = &GP_GET_POINT( index - 1 )->p;
-                const gp_vec2f_t * p1 = &GP_GET_POINT( index + 0 )->p;
+            *_vertex_count += section_count * 6;
+            *_index_count += (section_count - 1) * 18;
 
-                float d = __vec2f_distance( p0, p1 );
+            for( gp_uint32_t index = 0; index != 4; ++index )
+            {
+                *_vertex_count += 1;
+                *_vertex_count += _state->rect_quality - 1;
 
-                total_distance += d;
+                *_index_count += _state->rect_quality * 3;
             }
-        }
 
+            *_index_count += 12;
+        }
+        else
         {
-            const gp_vec2f_t * p0 = &GP_GET_POINT( 0 )->p;
-            const gp_vec2f_t * p1 = &GP_GET_POINT( 1 )->p;
+            *_vertex_count += section_count * 2;
+            *_index_count += (section_count - 1) * 6;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __line_joints_push( gp_line_joints_t * _joints, const gp_state_t * _state, const gp_vec2f_t * _p )
+{
+    if( _joints->point_count >= 2 )
+    {
+        _joints->section_count += __line_join_sections( _state, &_joints->p0, &_joints->p1, _p );
+    }
 
-            gp_argb_t argb0 = GP_GET_POINT( 0 )->argb;
-            gp_argb_t outline_argb0 = GP_GET_POINT( 0 )->outline_argb;
+    _joints->p0 = _joints->p1;
+    _joints->p1 = *_p;
 
-            gp_vec2f_t perp;
-            __make_line_perp( &perp, p0, p1 );
+    _joints->point_count += 1;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_line_joints_begin( gp_line_t * _line )
+{
+    gp_line_joints_t * joints = &_line->joints;
 
-            if( penumbra > 0.f )
-            {
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, p0->x - perp.x * half_thickness, p0->y - perp.y * half_thickness) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb0 & 0x00ffffff) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 0.f, 0.f) );
+    joints->point = _line->points;
+    joints->edge = GP_NULLPTR;
+    joints->step = 0;
+    joints->t = 0.f;
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, p0->x - perp.x * half_thickness_soft, p0->y - perp.y * half_thickness_soft) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb0) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, 0.f, 0.5f - uv_soft_offset) );
+    joints->p0.x = 0.f;
+    joints->p0.y = 0.f;
+    joints->p1.x = 0.f;
+    joints->p1.y = 0.f;
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 2, p0->x + perp.x * half_thickness_soft, p0->y + perp.y * half_thickness_soft) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 2, argb0) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 2, 0.f, 0.5f + uv_soft_offset) );
+    joints->point_count = 0;
+    joints->section_count = 0;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_line_joints_advance( gp_line_t * _line )
+{
+    const gp_state_t * state = _line->state;
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 3, p0->x + perp.x * half_thickness, p0->y + perp.y * half_thickness) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 3, argb0 & 0x00ffffff) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 3, 0.f, 1.f) );
+    if( state->dash_count != 0 )
+    {
+        return;
+    }
 
-                vertex_iterator += 4;
-            }
-            else
+    gp_line_joints_t * joints = &_line->joints;
+
+    gp_line_flatten_t flatten;
+    flatten.mesh = GP_NULLPTR;
+    flatten.state = state;
+    flatten.point = joints->point;
+    flatten.edge = joints->edge != GP_NULLPTR ? joints->edge : GP_LIST_BACK( _line->edges );
+    flatten.step = joints->step;
+    flatten.t = joints->t;
+
+    while( flatten.edge != GP_NULLPTR )
+    {
+        gp_points_t point;
+        __line_flatten_next( &flatten, &point );
+
+        __line_joints_push( joints, state, &point.p );
+    }
+
+    joints->point = flatten.point;
+    joints->edge = flatten.edge;
+    joints->step = flatten.step;
+    joints->t = flatten.t;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_calculate_line_size( const gp_line_t * _line, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count )
+{
+    if( _line->edges == GP_NULLPTR )
+    {
+        return;
+    }
+
+    const gp_state_t * state = _line->state;
+
+    if( state->dash_count == 0 )
+    {
+        const gp_line_joints_t * joints = &_line->joints;
+
+        const gp_line_point_t * back = GP_LIST_BACK( _line->points );
+
+        gp_uint32_t section_count = joints->section_count + 2;
+
+        if( joints->point_count >= 2 )
+        {
+            section_count += __line_join_sections( state, &joints->p0, &joints->p1, &back->p );
+        }
+
+        __calculate_mesh_polyline_size( state, section_count, _vertex_count, _index_count );
+
+        return;
+    }
+
+    gp_line_path_t path;
+    __line_path_begin( &path, GP_NULLPTR, _line );
+
+    gp_line_joints_t joints;
+    joints.point_count = 0;
+    joints.section_count = 0;
+
+    gp_points_t point;
+    float distance;
+    gp_bool_t begin;
+
+    while( __line_path_next( &path, &point, &distance, &begin ) == GP_TRUE )
+    {
+        if( begin == GP_TRUE )
+        {
+            if( joints.point_count >= 2 )
             {
-                if( outline_width > 0.f )
-                {
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, p0->x - perp.x * (half_thickness + outline_width), p0->y - perp.y * (half_thickness + outline_width)) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 0.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, p0->x - perp.x * half_thickness, p0->y - perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, 0.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 2, p0->x - perp.x * half_thickness, p0->y - perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 2, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 2, 0.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 3, p0->x + perp.x * half_thickness, p0->y + perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 3, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 3, 0.f, 1.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 4, p0->x + perp.x * half_thickness, p0->y + perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 4, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 4, 0.f, 1.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 5, p0->x + perp.x * (half_thickness + outline_width), p0->y + perp.y * (half_thickness + outline_width)) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 5, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 5, 0.f, 1.f) );
-
-                    vertex_iterator += 6;
-                }
-                else
-                {
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, p0->x - perp.x * half_thickness, p0->y - perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 0.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, p0->x + perp.x * half_thickness, p0->y + perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, 0.f, 1.f) );
-
-                    vertex_iterator += 2;
-                }
+                __calculate_mesh_polyline_size( state, joints.section_count + 2, _vertex_count, _index_count );
             }
+
+            joints.point_count = 0;
+            joints.section_count = 0;
         }
 
-        float dd = 0.f;
+        __line_joints_push( &joints, state, &point.p );
+    }
 
-        for( gp_uint16_t index = 1; index != points_cache.size - 1; ++index )
-        {
-            const gp_vec2f_t * p0 = &GP_GET_POINT( index - 1 )->p;
-            const gp_vec2f_t * p1 = &GP_GET_POINT( index + 0 )->p;
-            const gp_vec2f_t * p2 = &GP_GET_POINT( index + 1 )->p;
+    if( joints.point_count >= 2 )
+    {
+        __calculate_mesh_polyline_size( state, joints.section_count + 2, _vertex_count, _index_count );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+typedef enum gp_line_lane_color_e
+{
+    GP_LINE_LANE_COLOR,
+    GP_LINE_LANE_COLOR_PENUMBRA,
+    GP_LINE_LANE_COLOR_OUTLINE
+} gp_line_lane_color_e;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_line_stroke_t
+{
+    const gp_mesh_t * mesh;
+    const gp_state_t * state;
 
-            float u = 0.f;
+    gp_uint8_t lane_count;
+    float lane_offsets[6];
+    float lane_v[6];
+    gp_line_lane_color_e lane_colors[6];
 
-            if( _mesh->uv_buffer != GP_NULLPTR )
-            {
-                float d = __vec2f_distance( p0, p1 );
+    gp_uint8_t quad_count;
+    gp_uint8_t quad_lanes[3];
 
-                dd += d;
+    float distance;
+    float total_distance;
 
-                u = dd / total_distance;
-            }
+    gp_uint32_t section_count;
+    gp_vec2f_t section_edges[4][2];
 
-            gp_argb_t argb0 = GP_GET_POINT( index + 0 )->argb;
-            gp_argb_t outline_argb0 = GP_GET_POINT( index + 0 )->outline_argb;
+    gp_uint16_t vertex_iterator;
+    gp_uint16_t index_iterator;
+} gp_line_stroke_t;
+//////////////////////////////////////////////////////////////////////////
+static void __line_stroke_begin( gp_line_stroke_t * _stroke, const gp_mesh_t * _mesh, const gp_state_t * _state )
+{
+    _stroke->mesh = _mesh;
+    _stroke->state = _state;
 
-            gp_vec2f_t perp01;
-            __make_line_perp( &perp01, p0, p1 );
+    float half_thickness = _state->thickness * 0.5f;
+    float penumbra = _state->penumbra;
+    float outline_width = _state->outline_width;
 
-            gp_vec2f_t perp12;
-            __make_line_perp( &perp12, p1, p2 );
+    if( penumbra > 0.f )
+    {
+        float half_thickness_soft = half_thickness - penumbra;
+        float uv_soft_offset = half_thickness_soft / half_thickness * 0.5f;
+
+        _stroke->lane_count = 4;
+
+        _stroke->lane_offsets[0] = -half_thickness;
+        _stroke->lane_offsets[1] = -half_thickness_soft;
+        _stroke->lane_offsets[2] = half_thickness_soft;
+        _stroke->lane_offsets[3] = half_thickness;
+
+        _stroke->lane_v[0] = 0.f;
+        _stroke->lane_v[1] = 0.5f - uv_soft_offset;
+        _stroke->lane_v[2] = 0.5f + uv_soft_offset;
+        _stroke->lane_v[3] = 1.f;
+
+        _stroke->lane_colors[0] = GP_LINE_LANE_COLOR_PENUMBRA;
+        _stroke->lane_colors[1] = GP_LINE_LANE_COLOR;
+        _stroke->lane_colors[2] = GP_LINE_LANE_COLOR;
+        _stroke->lane_colors[3] = GP_LINE_LANE_COLOR_PENUMBRA;
+
+        _stroke->quad_count = 3;
+        _stroke->quad_lanes[0] = 0;
+        _stroke->quad_lanes[1] = 1;
+        _stroke->quad_lanes[2] = 2;
+    }
+    else if( outline_width > 0.f )
+    {
+        _stroke->lane_count = 6;
+
+        _stroke->lane_offsets[0] = -(half_thickness + outline_width);
+        _stroke->lane_offsets[1] = -half_thickness;
+        _stroke->lane_offsets[2] = -half_thickness;
+        _stroke->lane_offsets[3] = half_thickness;
+        _stroke->lane_offsets[4] = half_thickness;
+        _stroke->lane_offsets[5] = half_thickness + outline_width;
+
+        _stroke->lane_v[0] = 0.f;
+        _stroke->lane_v[1] = 0.f;
+        _stroke->lane_v[2] = 0.f;
+        _stroke->lane_v[3] = 1.f;
+        _stroke->lane_v[4] = 1.f;
+        _stroke->lane_v[5] = 1.f;
+
+        _stroke->lane_colors[0] = GP_LINE_LANE_COLOR_OUTLINE;
+        _stroke->lane_colors[1] = GP_LINE_LANE_COLOR_OUTLINE;
+        _stroke->lane_colors[2] = GP_LINE_LANE_COLOR;
+        _stroke->lane_colors[3] = GP_LINE_LANE_COLOR;
+        _stroke->lane_colors[4] = GP_LINE_LANE_COLOR_OUTLINE;
+        _stroke->lane_colors[5] = GP_LINE_LANE_COLOR_OUTLINE;
+
+        _stroke->quad_count = 3;
+        _stroke->quad_lanes[0] = 0;
+        _stroke->quad_lanes[1] = 2;
+        _stroke->quad_lanes[2] = 4;
+    }
+    else
+    {
+        _stroke->lane_count = 2;
 
-            gp_vec2f_t linep00;
-            linep00.x = p0->x - perp01.x * half_thickness;
-            linep00.y = p0->y - perp01.y * half_thickness;
+        _stroke->lane_offsets[0] = -half_thickness;
+        _stroke->lane_offsets[1] = half_thickness;
 
-            gp_vec2f_t linep01;
-            linep01.x = p1->x - perp01.x * half_thickness;
-            linep01.y = p1->y - perp01.y * half_thickness;
+        _stroke->lane_v[0] = 0.f;
+        _stroke->lane_v[1] = 1.f;
 
-            gp_linef_t line01l;
-            __make_line_from_two_point_v2( &line01l, &linep00, &linep01 );
+        _stroke->lane_colors[0] = GP_LINE_LANE_COLOR;
+        _stroke->lane_colors[1] = GP_LINE_LANE_COLOR;
 
-            gp_vec2f_t linep10;
-            linep10.x = p1->x - perp12.x * half_thickness;
-            linep10.y = p1->y - perp12.y * half_thickness;
+        _stroke->quad_count = 1;
+        _stroke->quad_lanes[0] = 0;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __line_stroke_section( gp_line_stroke_t * _stroke, const gp_points_t * _point, const gp_vec2f_t * _inner, const gp_vec2f_t * _outer, float _turn, float _u, gp_bool_t _connect )
+{
+    const gp_mesh_t * mesh = _stroke->mesh;
+    const gp_state_t * state = _stroke->state;
 
-            gp_vec2f_t linep11;
-            linep11.x = p2->x - perp12.x * half_thickness;
-            linep11.y = p2->y - perp12.y * half_thickness;
+    gp_uint16_t vertex_iterator = _stroke->vertex_iterator;
+    gp_uint16_t index_iterator = _stroke->index_iterator;
 
-            gp_linef_t line12l;
-            __make_line_from_two_point_v2( &line12l, &linep10, &linep11 );
+    gp_uint8_t lane_count = _stroke->lane_count;
 
-            gp_vec2f_t pl;
-            if( __intersect_line( &line01l, &line12l, &pl ) == GP_FALSE )
-            {
-                pl.x = p1->x - perp01.x * half_thickness;
-                pl.y = p1->y - perp01.y * half_thickness;
-            }
+    if( _connect == GP_FALSE )
+    {
+        _stroke->section_count = 0;
+    }
 
-            gp_vec2f_t linep20;
-            linep20.x = p0->x + perp01.x * half_thickness;
-            linep20.y = p0->y + perp01.y * half_thickness;
+    if( _connect == GP_TRUE )
+    {
+        gp_uint16_t prev_vertex_iterator = vertex_iterator - lane_count;
 
-            gp_vec2f_t linep21;
-            linep21.x = p1->x + perp01.x * half_thickness;
-            linep21.y = p1->y + perp01.y * half_thickness;
+        for( gp_uint8_t index = 0; index != _stroke->quad_count; ++index )
+        {
+            gp_uint16_t a = prev_vertex_iterator + _stroke->quad_lanes[index];
+            gp_uint16_t b = vertex_iterator + _stroke->quad_lanes[index];
 
-            gp_linef_t line01r;
-            __make_line_from_two_point_v2( &line01r, &linep20, &linep21 );
+            gp_mesh_push_index( mesh, index_iterator + 0, a + 0 );
+            gp_mesh_push_index( mesh, index_iterator + 1, a + 1 );
+            gp_mesh_push_index( mesh, index_iterator + 2, b + 0 );
+            gp_mesh_push_index( mesh, index_iterator + 3, b + 0 );
+            gp_mesh_push_index( mesh, index_iterator + 4, a + 1 );
+            gp_mesh_push_index( mesh, index_iterator + 5, b + 1 );
 
-            gp_vec2f_t linep30;
-            linep30.x = p1->x + perp12.x * half_thickness;
-            linep30.y = p1->y + perp12.y * half_thickness;
+            index_iterator += 6;
+        }
+    }
 
-            gp_vec2f_t linep31;
-            linep31.x = p2->x + perp12.x * half_thickness;
-            linep31.y = p2->y + perp12.y * half_thickness;
+    gp_vec2f_t edges[2] = {{0.f, 0.f}, {0.f, 0.f}};
 
-            gp_linef_t line12r;
-            __make_line_from_two_point_v2( &line12r, &linep30, &linep31 );
+    for( gp_uint8_t lane = 0; lane != lane_count; ++lane )
+    {
+        float offset = _stroke->lane_offsets[lane];
 
-            gp_vec2f_t pr;
-            if( __intersect_line( &line01r, &line12r, &pr ) == GP_FALSE )
-            {
-                pr.x = p1->x + perp01.x * half_thickness;
-                pr.y = p1->y + perp01.y * half_thickness;
-            }
+        const gp_vec2f_t * n = (offset * _turn < 0.f) ? _outer : _inner;
 
-            if( penumbra > 0.f )
-            {
-                gp_vec2f_t linep40;
-                linep40.x = p0->x - perp01.x * half_thickness_soft;
-                linep40.y = p0->y - perp01.y * half_thickness_soft;
+        gp_vec2f_t p;
+        p.x = _point->p.x + n->x * offset;
+        p.y = _point->p.y + n->y * offset;
 
-                gp_vec2f_t linep41;
-                linep41.x = p1->x - perp01.x * half_thickness_soft;
-                linep41.y = p1->y - perp01.y * half_thickness_soft;
+        if( lane == 1 )
+        {
+            edges[0] = p;
+        }
+        else if( lane == 4 )
+        {
+            edges[1] = p;
+        }
 
-                gp_linef_t line01l_soft;
-                __make_line_from_two_point_v2( &line01l_soft, &linep40, &linep41 );
+        gp_argb_t argb;
 
-                gp_vec2f_t linep50;
-                linep50.x = p1->x - perp12.x * half_thickness_soft;
-                linep50.y = p1->y - perp12.y * half_thickness_soft;
+        switch( _stroke->lane_colors[lane] )
+        {
+        case GP_LINE_LANE_COLOR:
+            argb = _point->argb;
+            break;
+        case GP_LINE_LANE_COLOR_PENUMBRA:
+            argb = gp_mesh_color_transparent( mesh, _point->argb );
+            break;
+        default:
+            argb = _point->outline_argb;
+            break;
+        }
 
-                gp_vec2f_t linep51;
-                linep51.x = p2->x - perp12.x * half_thickness_soft;
-                linep51.y = p2->y - perp12.y * half_thickness_soft;
+        gp_mesh_push_position( mesh, vertex_iterator + 0, p.x, p.y );
+        gp_mesh_push_color( mesh, vertex_iterator + 0, argb );
+        gp_mesh_push_uv( state, mesh, vertex_iterator + 0, _u, _stroke->lane_v[lane] );
 
-                gp_linef_t line12l_soft;
-                __make_line_from_two_point_v2( &line12l_soft, &linep50, &linep51 );
+        vertex_iterator += 1;
+    }
 
-                gp_vec2f_t pl_soft;
-                if( __intersect_line( &line01l_soft, &line12l_soft, &pl_soft ) == GP_FALSE )
-                {
-                    pl_soft.x = p1->x - perp01.x * half_thickness_soft;
-                    pl_soft.y = p1->y - perp01.y * half_thickness_soft;
-                }
+    if( _stroke->section_count < 2 )
+    {
+        _stroke->section_edges[_stroke->section_count][0] = edges[0];
+        _stroke->section_edges[_stroke->section_count][1] = edges[1];
+    }
 
-                gp_vec2f_t linep60;
-                linep60.x = p0->x + perp01.x * half_thickness_soft;
-                linep60.y = p0->y + perp01.y * half_thickness_soft;
+    _stroke->section_edges[2][0] = _stroke->section_edges[3][0];
+    _stroke->section_edges[2][1] = _stroke->section_edges[3][1];
+    _stroke->section_edges[3][0] = edges[0];
+    _stroke->section_edges[3][1] = edges[1];
 
-                gp_vec2f_t linep61;
-                linep61.x = p1->x + perp01.x * half_thickness_soft;
-                linep61.y = p1->y + perp01.y * half_thickness_soft;
+    _stroke->section_count += 1;
 
-                gp_linef_t line01r_soft;
-                __make_line_from_two_point_v2( &line01r_soft, &linep60, &linep61 );
+    _stroke->vertex_iterator = vertex_iterator;
+    _stroke->index_iterator = index_iterator;
 
-                gp_vec2f_t linep70;
-                linep70.x = p1->x + perp12.x * half_thickness_soft;
-                linep70.y = p1->y + perp12.y * half_thickness_soft;
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __line_stroke_outline_caps( gp_line_stroke_t * _stroke, gp_uint16_t _begin_vertex_iterator, gp_uint16_t _end_vertex_iterator, gp_argb_t _outline_argb )
+{
+    const gp_mesh_t * mesh = _stroke->mesh;
+    const gp_state_t * state = _stroke->state;
 
-                gp_vec2f_t linep71;
-                linep71.x = p2->x + perp12.x * half_thickness_soft;
-                linep71.y = p2->y + perp12.y * half_thickness_soft;
+    gp_uint16_t vertex_iterator = _stroke->vertex_iterator;
+    gp_uint16_t index_iterator = _stroke->index_iterator;
 
-                gp_linef_t line12r_soft;
-                __make_line_from_two_point_v2( &line12r_soft, &linep70, &linep71 );
+    float outline_width = state->outline_width;
 
-                gp_vec2f_t pr_soft;
-                if( __intersect_line( &line01r_soft, &line12r_soft, &pr_soft ) == GP_FALSE )
-                {
-                    pr_soft.x = p1->x + perp01.x * half_thickness_soft;
-                    pr_soft.y = p1->y + perp01.y * half_thickness_soft;
-                }
+    gp_uint8_t rect_quality = state->rect_quality;
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, pl.x, pl.y) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb0 & 0x00ffffff) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, u, 0.f) );
+    for( gp_uint32_t index_arc = 0; index_arc != 4; ++index_arc )
+    {
+        gp_uint16_t i0[4] = {_begin_vertex_iterator + 1, _begin_vertex_iterator + 4, _end_vertex_iterator - 5, _end_vertex_iterator - 2};
+        gp_uint16_t i1[4] = {_begin_vertex_iterator + 0, _begin_vertex_iterator + 5, _end_vertex_iterator - 6, _end_vertex_iterator - 1};
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, pl_soft.x, pl_soft.y) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb0) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, u, 0.5f - uv_soft_offset) );
+        gp_mesh_push_index( mesh, index_iterator + 0, i0[index_arc] );
+        gp_mesh_push_index( mesh, index_iterator + 1, vertex_iterator + 0 );
+        gp_mesh_push_index( mesh, index_iterator + 2, vertex_iterator + 1 );
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 2, pr_soft.x, pr_soft.y) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 2, argb0) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 2, u, 0.5f + uv_soft_offset) );
+        index_iterator += 3;
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 3, pr.x, pr.y) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 3, argb0 & 0x00ffffff) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 3, u, 1.f) );
+        for( gp_uint16_t index = 0; index != rect_quality - 2; ++index )
+        {
+            gp_mesh_push_index( mesh, index_iterator + 0, i0[index_arc] );
+            gp_mesh_push_index( mesh, index_iterator + 1, vertex_iterator + 1 + index + 0 );
+            gp_mesh_push_index( mesh, index_iterator + 2, vertex_iterator + 1 + index + 1 );
 
-                vertex_iterator += 4;
-            }
-            else
-            {
-                if( outline_width > 0.f )
-                {
-                    gp_vec2f_t linep40;
-                    linep40.x = p0->x - perp01.x * (half_thickness + outline_width);
-                    linep40.y = p0->y - perp01.y * (half_thickness + outline_width);
-
-                    gp_vec2f_t linep41;
-                    linep41.x = p1->x - perp01.x * (half_thickness + outline_width);
-                    linep41.y = p1->y - perp01.y * (half_thickness + outline_width);
-
-                    gp_linef_t line01l_outline;
-                    __make_line_from_two_point_v2( &line01l_outline, &linep40, &linep41 );
-
-                    gp_vec2f_t linep50;
-                    linep50.x = p1->x - perp12.x * (half_thickness + outline_width);
-                    linep50.y = p1->y - perp12.y * (half_thickness + outline_width);
-
-                    gp_vec2f_t linep51;
-                    linep51.x = p2->x - perp12.x * (half_thickness + outline_width);
-                    linep51.y = p2->y - perp12.y * (half_thickness + outline_width);
-
-                    gp_linef_t line12l_outline;
-                    __make_line_from_two_point_v2( &line12l_outline, &linep50, &linep51 );
-
-                    gp_vec2f_t pl_outline;
-                    if( __intersect_line( &line01l_outline, &line12l_outline, &pl_outline ) == GP_FALSE )
-                    {
-                        pl_outline.x = p1->x - perp01.x * (half_thickness + outline_width);
-                        pl_outline.y = p1->y - perp01.y * (half_thickness + outline_width);
-                    }
-
-                    gp_vec2f_t linep60;
-                    linep60.x = p0->x + perp01.x * (half_thickness + outline_width);
-                    linep60.y = p0->y + perp01.y * (half_thickness + outline_width);
-
-                    gp_vec2f_t linep61;
-                    linep61.x = p1->x + perp01.x * (half_thickness + outline_width);
-                    linep61.y = p1->y + perp01.y * (half_thickness + outline_width);
-
-                    gp_linef_t line01r_outline;
-                    __make_line_from_two_point_v2( &line01r_outline, &linep60, &linep61 );
-
-                    gp_vec2f_t linep70;
-                    linep70.x = p1->x + perp12.x * (half_thickness + outline_width);
-                    linep70.y = p1->y + perp12.y * (half_thickness + outline_width);
-
-                    gp_vec2f_t linep71;
-                    linep71.x = p2->x + perp12.x * (half_thickness + outline_width);
-                    linep71.y = p2->y + perp12.y * (half_thickness + outline_width);
-
-                    gp_linef_t line12r_outline;
-                    __make_line_from_two_point_v2( &line12r_outline, &linep70, &linep71 );
-
-                    gp_vec2f_t pr_outline;
-                    if( __intersect_line( &line01r_outline, &line12r_outline, &pr_outline ) == GP_FALSE )
-                    {
-                        pr_outline.x = p1->x + perp01.x * (half_thickness + outline_width);
-                        pr_outline.y = p1->y + perp01.y * (half_thickness + outline_width);
-                    }
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, pl_outline.x, pl_outline.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, u, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, pl.x, pl.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, u, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 2, pl.x, pl.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 2, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 2, u, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 3, pr.x, pr.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 3, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 3, u, 1.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 4, pr.x, pr.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 4, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 4, u, 1.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 5, pr_outline.x, pr_outline.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 5, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 5, u, 1.f) );
-
-                    vertex_iterator += 6;
-                }
-                else
-                {
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, pl.x, pl.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, u, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, pr.x, pr.y) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, u, 1.f) );
-
-                    vertex_iterator += 2;
-                }
-            }
+            index_iterator += 3;
         }
 
+        gp_mesh_push_index( mesh, index_iterator + 0, i1[index_arc] );
+        gp_mesh_push_index( mesh, index_iterator + 1, i0[index_arc] );
+        gp_mesh_push_index( mesh, index_iterator + 2, vertex_iterator + 1 + rect_quality - 3 );
+
+        index_iterator += 3;
+
+        float dt = gp_constant_half_pi * state->rect_quality_inv;
+
+        const gp_vec2f_t * e1[4] = {&_stroke->section_edges[0][0], &_stroke->section_edges[0][1], &_stroke->section_edges[3][0], &_stroke->section_edges[3][1]};
+        const gp_vec2f_t * e7[4] = {&_stroke->section_edges[1][0], &_stroke->section_edges[1][1], &_stroke->section_edges[2][0], &_stroke->section_edges[2][1]};
+
+        gp_vec2f_t v1 = *e1[index_arc];
+        gp_vec2f_t v7 = *e7[index_arc];
+
+        gp_vec2f_t d17;
+        __make_line_dir( &d17, &v1, &v7 );
+
+        gp_mesh_push_position( mesh, vertex_iterator + 0, v1.x - d17.x * outline_width, v1.y - d17.y * outline_width );
+        gp_mesh_push_color( mesh, vertex_iterator + 0, _outline_argb );
+        gp_mesh_push_uv( state, mesh, vertex_iterator + 0, 0.f, 0.f );
+
+        vertex_iterator += 1;
+
+        float s0[4] = {1.f, -1.f, -1.f, 1.f};
+
+        for( gp_uint8_t index = 1; index != rect_quality; ++index )
         {
-            const gp_vec2f_t * p0 = &GP_GET_POINT( points_cache.size - 2 )->p;
-            const gp_vec2f_t * p1 = &GP_GET_POINT( points_cache.size - 1 )->p;
+            float t = s0[index_arc] * dt * index;
 
-            gp_argb_t argb0 = GP_GET_POINT( points_cache.size - 2 )->argb;
-            gp_argb_t outline_argb0 = GP_GET_POINT( points_cache.size - 2 )->outline_argb;
+            float ct = GP_MATH_COSF( t );
+            float st = GP_MATH_SINF( t );
 
-            gp_vec2f_t perp;
-            __make_line_perp( &perp, p0, p1 );
+            float x = v1.x - d17.x * outline_width * ct + d17.y * outline_width * st;
+            float y = v1.y - d17.y * outline_width * ct - d17.x * outline_width * st;
 
-            if( penumbra > 0.f )
-            {
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, p1->x - perp.x * half_thickness, p1->y - perp.y * half_thickness) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb0 & 0x00ffffff) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 1.f, 0.f) );
+            gp_mesh_push_position( mesh, vertex_iterator + 0, x, y );
+            gp_mesh_push_color( mesh, vertex_iterator + 0, _outline_argb );
+            gp_mesh_push_uv( state, mesh, vertex_iterator + 0, 0.f, 0.f );
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, p1->x - perp.x * half_thickness_soft, p1->y - perp.y * half_thickness_soft) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb0) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, 1.f, 0.5f - uv_soft_offset) );
+            vertex_iterator += 1;
+        }
+    }
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 2, p1->x + perp.x * half_thickness_soft, p1->y + perp.y * half_thickness_soft) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 2, argb0) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 2, 1.f, 0.5f + uv_soft_offset) );
+    gp_uint16_t total_arc_verices = (rect_quality - 1) + 1;
 
-                GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 3, p1->x + perp.x * half_thickness, p1->y + perp.y * half_thickness) );
-                GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 3, argb0 & 0x00ffffff) );
-                GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 3, 1.f, 1.f) );
+    gp_mesh_push_index( mesh, index_iterator + 0, _end_vertex_iterator + total_arc_verices * 0 );
+    gp_mesh_push_index( mesh, index_iterator + 1, _end_vertex_iterator + total_arc_verices * 1 );
+    gp_mesh_push_index( mesh, index_iterator + 2, _begin_vertex_iterator + 1 );
+    gp_mesh_push_index( mesh, index_iterator + 3, _begin_vertex_iterator + 1 );
+    gp_mesh_push_index( mesh, index_iterator + 4, _end_vertex_iterator + total_arc_verices * 1 );
+    gp_mesh_push_index( mesh, index_iterator + 5, _begin_vertex_iterator + 5 );
 
-                vertex_iterator += 4;
-            }
-            else
-            {
-                if( outline_width > 0.f )
-                {
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, p1->x - perp.x * (half_thickness + outline_width), p1->y - perp.y * (half_thickness + outline_width)) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 1.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, p1->x - perp.x * half_thickness, p1->y - perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, 1.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 2, p1->x - perp.x * half_thickness, p1->y - perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 2, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 2, 1.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 3, p1->x + perp.x * half_thickness, p1->y + perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 3, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 3, 1.f, 1.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 4, p1->x + perp.x * half_thickness, p1->y + perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 4, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 4, 1.f, 1.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 5, p1->x + perp.x * (half_thickness + outline_width), p1->y + perp.y * (half_thickness + outline_width)) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 5, outline_argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 5, 1.f, 1.f) );
-
-                    vertex_iterator += 6;
-                }
-                else
-                {
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, p1->x - perp.x * half_thickness, p1->y - perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 1.f, 0.f) );
-
-                    GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 1, p1->x + perp.x * half_thickness, p1->y + perp.y * half_thickness) );
-                    GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 1, argb0) );
-                    GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 1, 1.f, 1.f) );
-
-                    vertex_iterator += 2;
-                }                
-            }
+    index_iterator += 6;
 
-            gp_uint16_t end_vertex_iterator = vertex_iterator;
+    gp_mesh_push_index( mesh, index_iterator + 0, _end_vertex_iterator + total_arc_verices * 2 );
+    gp_mesh_push_index( mesh, index_iterator + 1, _end_vertex_iterator + total_arc_verices * 3 );
+    gp_mesh_push_index( mesh, index_iterator + 2, _end_vertex_iterator - 5 );
+    gp_mesh_push_index( mesh, index_iterator + 3, _end_vertex_iterator - 5 );
+    gp_mesh_push_index( mesh, index_iterator + 4, _end_vertex_iterator + total_arc_verices * 3 );
+    gp_mesh_push_index( mesh, index_iterator + 5, _end_vertex_iterator - 1 );
 
-            if( penumbra > 0.f )
-            {
-            }
-            else
-            {
-                if( outline_width > 0.f )
-                {
-                    for( gp_uint32_t index_arc = 0; index_arc != 4; ++index_arc )
-                    {
-                        gp_uint8_t rect_quality = l->state->rect_quality;
+    index_iterator += 6;
+
+    _stroke->vertex_iterator = vertex_iterator;
+    _stroke->index_iterator = index_iterator;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __line_stroke_join( gp_line_stroke_t * _stroke, const gp_joint_batch_t * _batch, gp_uint32_t _index, const gp_points_t * _points, float _u )
+{
+    const gp_points_t * point = _points + 1;
 
-                        gp_uint16_t i0[4] = {begin_vertex_iterator + 1, begin_vertex_iterator + 4, end_vertex_iterator - 5, end_vertex_iterator - 2};
-                        gp_uint16_t i1[4] = {begin_vertex_iterator + 0, begin_vertex_iterator + 5, end_vertex_iterator - 6, end_vertex_iterator - 1};
-                        gp_uint16_t i2[4] = {begin_vertex_iterator + 7, begin_vertex_iterator + 10, end_vertex_iterator - 11, end_vertex_iterator - 8};
+    const gp_state_t * state = _stroke->state;
 
-                        GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, i0[index_arc]) );
-                        GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + 0) );
-                        GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + 1) );
+    gp_vec2f_t n0;
+    n0.x = _batch->nx[_index + 0];
+    n0.y = _batch->ny[_index + 0];
 
-                        index_iterator += 3;
+    gp_vec2f_t n1;
+    n1.x = _batch->nx[_index + 1];
+    n1.y = _batch->ny[_index + 1];
 
-                        for( gp_uint16_t index = 0; index != rect_quality - 2; ++index )
-                        {
-                            GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, i0[index_arc]) );
-                            GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, vertex_iterator + 1 + index + 0) );
-                            GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + 1 + index + 1) );
+    gp_vec2f_t m;
+    m.x = _batch->mx[_index];
+    m.y = _batch->my[_index];
 
-                            index_iterator += 3;
-                        }
+    float miter_limit = state->miter_limit;
 
-                        GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, i1[index_arc]) );
-                        GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, i0[index_arc]) );
-                        GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, vertex_iterator + 1 + rect_quality - 3) );
+    float m_sqrlength = __vec2f_sqrlength( &m );
 
-                        index_iterator += 3;
+    if( m_sqrlength > miter_limit * miter_limit )
+    {
+        float s = miter_limit / GP_MATH_SQRTF( m_sqrlength );
 
-                        float dt = gp_constant_half_pi * l->state->rect_quality_inv;
-                    
-                        gp_vec2f_t v1;
-                        GP_CALL( gp_mesh_get_position, (_mesh, i0[index_arc], &v1) );
+        m.x *= s;
+        m.y *= s;
+    }
 
-                        gp_vec2f_t v7;
-                        GP_CALL( gp_mesh_get_position, (_mesh, i2[index_arc], &v7) );
+    gp_uint16_t sections = __line_join_sections( state, &_points[0].p, &_points[1].p, &_points[2].p );
 
-                        gp_vec2f_t d17;
-                        __make_line_dir( &d17, &v1, &v7 );
+    if( sections == 1 )
+    {
+        GP_CALL( __line_stroke_section, (_stroke, point, &m, &m, 0.f, _u, GP_TRUE) );
 
-                        GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, v1.x - d17.x * outline_width, v1.y - d17.y * outline_width) );
-                        GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, outline_argb0) );
-                        GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 0.f, 0.f) );
+        return GP_SUCCESSFUL;
+    }
 
-                        vertex_iterator += 1;
+    float turn = n0.x * n1.y - n0.y * n1.x;
+    float angle = GP_MATH_ATAN2F( turn, n0.x * n1.x + n0.y * n1.y );
+    float dt = angle / (float)(sections - 1);
 
-                        float s0[4] = {1.f, -1.f, -1.f, 1.f};
+    for( gp_uint16_t index = 0; index != sections; ++index )
+    {
+        float t = dt * index;
 
-                        for( gp_uint8_t index = 1; index != rect_quality; ++index )
-                        {
-                            float t = s0[index_arc] * dt * index;
+        float ct = GP_MATH_COSF( t );
+        float st = GP_MATH_SINF( t );
 
-                            float ct = GP_MATH_COSF( t );
-                            float st = GP_MATH_SINF( t );
+        gp_vec2f_t o;
+        o.x = n0.x * ct - n0.y * st;
+        o.y = n0.x * st + n0.y * ct;
 
-                            float x = v1.x - d17.x * outline_width * ct + d17.y * outline_width * st;
-                            float y = v1.y - d17.y * outline_width * ct - d17.x * outline_width * st;
+        GP_CALL( __line_stroke_section, (_stroke, point, &m, &o, turn, _u, GP_TRUE) );
+    }
 
-                            GP_CALL( gp_mesh_push_position, (_mesh, vertex_iterator + 0, x, y) );
-                            GP_CALL( gp_mesh_push_color, (_mesh, vertex_iterator + 0, outline_argb0) );
-                            GP_CALL( gp_mesh_push_uv, (_canvas, _mesh, vertex_iterator + 0, 0.f, 0.f) );
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __line_stroke_joints( gp_line_stroke_t * _stroke, gp_joint_batch_t * _batch, const gp_points_t * _points, gp_uint32_t _point_count )
+{
+    if( _point_count < 3 )
+    {
+        return GP_SUCCESSFUL;
+    }
 
-                            vertex_iterator += 1;
-                        }
-                    }
+    for( gp_uint32_t index = 0; index != _point_count; ++index )
+    {
+        _batch->px[index] = _points[index].p.x;
+        _batch->py[index] = _points[index].p.y;
+    }
 
-                    gp_uint16_t total_arc_verices = (state->rect_quality - 1) + 1;
+    gp_joint_batch_calculate( _batch, _point_count );
 
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, end_vertex_iterator + total_arc_verices * 0) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, end_vertex_iterator + total_arc_verices * 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, begin_vertex_iterator + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, begin_vertex_iterator + 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, end_vertex_iterator + total_arc_verices * 1) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, begin_vertex_iterator + 5) );
+    const gp_mesh_t * mesh = _stroke->mesh;
 
-                    index_iterator += 6;
+    for( gp_uint32_t index = 0; index != _point_count - 2; ++index )
+    {
+        float u = 0.f;
 
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 0, end_vertex_iterator + total_arc_verices * 2) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 1, end_vertex_iterator + total_arc_verices * 3) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 2, end_vertex_iterator - 5) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 3, end_vertex_iterator - 5) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 4, end_vertex_iterator + total_arc_verices * 3) );
-                    GP_CALL( gp_mesh_push_index, (_mesh, index_iterator + 5, end_vertex_iterator - 1) );
+        if( mesh->uv_buffer != GP_NULLPTR )
+        {
+            float d = __vec2f_distance( &_points[index + 0].p, &_points[index + 1].p );
 
-                    index_iterator += 6;
-                }
-            }
+            _stroke->distance += d;
 
-#if defined(GP_DISABLE_EXTRA_LINE_POINTS)
-            if( points_cache.extra_points != GP_NULLPTR )
-            {
-                GP_FREE( _canvas, points_cache.extra_points );
-            }
-#endif
+            u = _stroke->distance / _stroke->total_distance;
         }
+
+        GP_CALL( __line_stroke_join, (_stroke, _batch, index, _points + index, u) );
     }
 
-#if defined(GP_DEBUG)
-    gp_uint16_t test_vertex_count;
-    gp_uint16_t test_index_count;
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __line_stroke_end( gp_line_stroke_t * _stroke, gp_joint_batch_t * _batch, const gp_points_t * _points, gp_uint32_t _point_count, gp_uint16_t _begin_vertex_iterator )
+{
+    GP_CALL( __line_stroke_joints, (_stroke, _batch, _points, _point_count) );
+
+    const gp_points_t * p0 = _points + _point_count - 2;
+    const gp_points_t * p1 = _points + _point_count - 1;
+
+    float u = 0.f;
 
-    if( __calculate_mesh_line_size( _canvas, &test_vertex_count, &test_index_count ) == GP_FAILURE )
+    if( _stroke->mesh->uv_buffer != GP_NULLPTR )
     {
-        return GP_FAILURE;
+        float d = __vec2f_distance( &p0->p, &p1->p );
+
+        _stroke->distance += d;
+
+        u = _stroke->distance / _stroke->total_distance;
     }
 
-    if( test_vertex_count != vertex_iterator - *_vertex_iterator )
+    gp_vec2f_t perp1;
+    __make_line_perp( &perp1, &p0->p, &p1->p );
+
+    gp_points_t end_point = *p1;
+    end_point.argb = p0->argb;
+    end_point.outline_argb = p0->outline_argb;
+
+    GP_CALL( __line_stroke_section, (_stroke, &end_point, &perp1, &perp1, 0.f, u, GP_TRUE) );
+
+    gp_uint16_t end_vertex_iterator = _stroke->vertex_iterator;
+
+    if( _stroke->state->penumbra <= 0.f && _stroke->state->outline_width > 0.f )
     {
-        return GP_FAILURE;
+        GP_CALL( __line_stroke_outline_caps, (_stroke, _begin_vertex_iterator, end_vertex_iterator, p0->outline_argb) );
     }
 
-    if( test_index_count != index_iterator - *_index_iterator )
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __line_stroke( gp_line_stroke_t * _stroke, const gp_line_t * _line )
+{
+    const gp_mesh_t * mesh = _stroke->mesh;
+
+    _stroke->distance = 0.f;
+    _stroke->total_distance = 0.f;
+
+    if( mesh->uv_buffer != GP_NULLPTR )
     {
-        return GP_FAILURE;
+        _stroke->total_distance = __line_flatten_distance( mesh, _line );
     }
-#endif
 
-    * _vertex_iterator = vertex_iterator;
-    *_index_iterator = index_iterator;
+    gp_line_path_t path;
+    __line_path_begin( &path, mesh, _line );
+
+    gp_points_t points[GP_LINE_JOINT_BATCH + 2];
+    gp_joint_batch_t batch;
+
+    gp_uint32_t point_count = 0;
+    gp_uint16_t begin_vertex_iterator = _stroke->vertex_iterator;
+    gp_bool_t open = GP_FALSE;
+
+    for( ;; )
+    {
+        gp_points_t point;
+        float distance;
+        gp_bool_t begin;
+
+        gp_bool_t next = __line_path_next( &path, &point, &distance, &begin );
+
+        if( next == GP_FALSE || begin == GP_TRUE )
+        {
+            if( open == GP_TRUE )
+            {
+                GP_CALL( __line_stroke_end, (_stroke, &batch, points, point_count, begin_vertex_iterator) );
+
+                open = GP_FALSE;
+            }
+
+            if( next == GP_FALSE )
+            {
+                break;
+            }
+
+            point_count = 0;
+
+            _stroke->distance = distance;
+        }
+
+        points[point_count++] = point;
+
+        if( open == GP_FALSE )
+        {
+            if( point_count != 2 )
+            {
+                continue;
+            }
+
+            float u = 0.f;
+
+            if( mesh->uv_buffer != GP_NULLPTR && _stroke->total_distance > 0.f )
+            {
+                u = _stroke->distance / _stroke->total_distance;
+            }
+
+            begin_vertex_iterator = _stroke->vertex_iterator;
+
+            gp_vec2f_t perp0;
+            __make_line_perp( &perp0, &points[0].p, &points[1].p );
+
+            GP_CALL( __line_stroke_section, (_stroke, points + 0, &perp0, &perp0, 0.f, u, GP_FALSE) );
+
+            open = GP_TRUE;
+
+            continue;
+        }
+
+        if( point_count != GP_LINE_JOINT_BATCH + 2 )
+        {
+            continue;
+        }
+
+        GP_CALL( __line_stroke_joints, (_stroke, &batch, points, point_count) );
+
+        points[0] = points[point_count - 2];
+        points[1] = points[point_count - 1];
+
+        point_count = 2;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_render_line( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator, gp_uint32_t * _range_iterator )
+{
+    gp_line_stroke_t stroke;
+    stroke.vertex_iterator = *_vertex_iterator;
+    stroke.index_iterator = *_index_iterator;
+
+    GP_LIST_FOREACH( gp_line_t, _canvas->lines, l )
+    {
+        if( l->edges == GP_NULLPTR )
+        {
+            continue;
+        }
+
+        gp_mesh_push_range( _mesh, _range_iterator, l->state, stroke.index_iterator );
+
+        __line_stroke_begin( &stroke, _mesh, l->state );
+
+        GP_CALL( __line_stroke, (&stroke, l) );
+    }
+
+    *_vertex_iterator = stroke.vertex_iterator;
+    *_index_iterator = stroke.index_iterator;
 
     return GP_SUCCESSFUL;
-}
\ No newline at end of file
+}
@@ -3,7 +3,11 @@
 
 #include "graphics/graphics.h"
 
-gp_result_t gp_calculate_mesh_line_size( const gp_canvas_t * _canvas, gp_mesh_t * _mesh );
-gp_result_t gp_render_line( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator );
+#include "struct.h"
+
+void gp_line_joints_begin( gp_line_t * _line );
+void gp_line_joints_advance( gp_line_t * _line );
+void gp_calculate_line_size( const gp_line_t * _line, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count );
+gp_result_t gp_render_line( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator, gp_uint32_t * _range_iterator );
 
 #endif
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "range.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "validate.h"
+
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_range_counter_t
+{
+    gp_uint32_t count;
+    const gp_state_t * state;
+} gp_range_counter_t;
+//////////////////////////////////////////////////////////////////////////
+static void __range_count_state( gp_range_counter_t * _counter, const gp_state_t * _state )
+{
+    const gp_state_t * back = _counter->state;
+
+    _counter->state = _state;
+
+    if( back != GP_NULLPTR && back->material == _state->material && back->blend == _state->blend )
+    {
+        return;
+    }
+
+    ++_counter->count;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_calculate_mesh_range_count( const gp_canvas_t * _canvas, gp_uint32_t * _range_count )
+{
+    gp_range_counter_t counter;
+    counter.count = 0;
+    counter.state = GP_NULLPTR;
+
+    GP_LIST_FOREACH( const gp_line_t, _canvas->lines, l )
+    {
+        if( l->edges == GP_NULLPTR )
+        {
+            continue;
+        }
+
+        __range_count_state( &counter, l->state );
+    }
+
+    GP_LIST_FOREACH( const gp_rect_t, _canvas->rects, r )
+    {
+        __range_count_state( &counter, r->state );
+    }
+
+    GP_LIST_FOREACH( const gp_rounded_rect_t, _canvas->rounded_rects, rr )
+    {
+        __range_count_state( &counter, rr->state );
+    }
+
+    GP_LIST_FOREACH( const gp_ellipse_t, _canvas->ellipses, e )
+    {
+        __range_count_state( &counter, e->state );
+    }
+
+    *_range_count = counter.count;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __ranges_merge( const gp_draw_range_t * _src, gp_draw_range_t * _dst, gp_uint32_t _begin, gp_uint32_t _middle, gp_uint32_t _end )
+{
+    gp_uint32_t left = _begin;
+    gp_uint32_t right = _middle;
+
+    for( gp_uint32_t index = _begin; index != _end; ++index )
+    {
+        if( left < _middle && (right == _end || _src[left].material <= _src[right].material) )
+        {
+            _dst[index] = _src[left++];
+        }
+        else
+        {
+            _dst[index] = _src[right++];
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_draw_range_t * __ranges_sort( gp_draw_range_t * _ranges, gp_draw_range_t * _temp, gp_uint32_t _count )
+{
+    gp_draw_range_t * src = _ranges;
+    gp_draw_range_t * dst = _temp;
+
+    for( gp_uint32_t width = 1; width < _count; width *= 2 )
+    {
+        for( gp_uint32_t begin = 0; begin < _count; begin += width * 2 )
+        {
+            gp_uint32_t middle = begin + width < _count ? begin + width : _count;
+            gp_uint32_t end = begin + width * 2 < _count ? begin + width * 2 : _count;
+
+            __ranges_merge( src, dst, begin, middle, end );
+        }
+
+        gp_draw_range_t * swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    return src;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_reorder_ranges( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint32_t * _range_count )
+{
+#if defined(GP_VALIDATION)
+    if( _mesh->ranges_buffer == GP_NULLPTR || _mesh->indices_buffer == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_reorder_ranges: mesh requires ranges and indices buffers" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_uint32_t range_count = _mesh->range_count;
+
+    if( range_count == 0 )
+    {
+        *_range_count = 0;
+
+        return GP_SUCCESSFUL;
+    }
+
+    gp_draw_range_t * ranges = _mesh->ranges_buffer;
+
+    gp_draw_range_t * temp = (gp_draw_range_t *)(*_canvas->malloc)(sizeof( gp_draw_range_t ) * range_count, _canvas->ud);
+
+    gp_draw_range_t * sorted = __ranges_sort( ranges, temp, range_count );
+
+    gp_uint16_t * indices = (gp_uint16_t *)(*_canvas->malloc)(sizeof( gp_uint16_t ) * _mesh->index_count, _canvas->ud);
+
+    const gp_uint8_t * indices_buffer = (const gp_uint8_t *)_mesh->indices_buffer + _mesh->indices_offset;
+
+    gp_uint16_t index_iterator = 0;
+    gp_uint32_t range_iterator = 0;
+
+    for( gp_uint32_t index = 0; index != range_count; ++index )
+    {
+        gp_draw_range_t range = sorted[index];
+
+        for( gp_uint16_t iterator = 0; iterator != range.count; ++iterator )
+        {
+            indices[index_iterator + iterator] = *(const gp_uint16_t *)(indices_buffer + _mesh->indices_stride * (range.first + iterator));
+        }
+
+        range.first = index_iterator;
+
+        index_iterator += range.count;
+
+        if( range_iterator != 0 )
+        {
+            gp_draw_range_t * back = ranges + range_iterator - 1;
+
+            if( back->material == range.material && back->blend == range.blend )
+            {
+                if( back->opaque_count == back->count )
+                {
+                    back->opaque_count += range.opaque_count;
+                }
+
+                back->count += range.count;
+
+                continue;
+            }
+        }
+
+        ranges[range_iterator++] = range;
+    }
+
+    for( gp_uint16_t iterator = 0; iterator != index_iterator; ++iterator )
+    {
+        gp_mesh_push_index( _mesh, iterator, indices[iterator] );
+    }
+
+    GP_FREE( _canvas, indices );
+    GP_FREE( _canvas, temp );
+
+    *_range_count = range_iterator;
+
+    return GP_SUCCESSFUL;
+}
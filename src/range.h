@@ -0,0 +1,10 @@
+#ifndef GP_RANGE_H_
+#define GP_RANGE_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+gp_result_t gp_calculate_mesh_range_count( const gp_canvas_t * _canvas, gp_uint32_t * _range_count );
+
+#endif
@@ -0,0 +1,750 @@
+#include "graphics/graphics.h"
+
+#include "struct.h"
+#include "detail.h"
+
+//////////////////////////////////////////////////////////////////////////
+static float __srgb_decode( float _value )
+{
+    if( _value <= 0.04045f )
+    {
+        return _value / 12.92f;
+    }
+
+    return GP_MATH_POWF( (_value + 0.055f) / 1.055f, 2.4f );
+}
+//////////////////////////////////////////////////////////////////////////
+static float __srgb_encode( float _value )
+{
+    if( _value <= 0.0031308f )
+    {
+        return _value * 12.92f;
+    }
+
+    return 1.055f * GP_MATH_POWF( _value, 1.f / 2.4f ) - 0.055f;
+}
+//////////////////////////////////////////////////////////////////////////
+static float __saturate( float _value )
+{
+    return _value < 0.f ? 0.f : (_value > 1.f ? 1.f : _value);
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_raster_create( gp_raster_t ** _raster, gp_malloc_t _malloc, gp_realloc_t _realloc, gp_free_t _free, void * _ud )
+{
+    gp_raster_t * raster = (gp_raster_t *)(*_malloc)(sizeof( gp_raster_t ), _ud);
+
+    raster->textured = GP_FALSE;
+    raster->blend = GP_RASTER_BLEND_LINEAR;
+
+    raster->positions = GP_NULLPTR;
+    raster->colors = GP_NULLPTR;
+    raster->uvs = GP_NULLPTR;
+    raster->vertex_capacity = 0;
+
+    raster->triangles = GP_NULLPTR;
+    raster->triangle_capacity = 0;
+
+    raster->tiles_x = 0;
+    raster->tiles_y = 0;
+    raster->tile_offsets = GP_NULLPTR;
+    raster->tile_capacity = 0;
+
+    raster->bins = GP_NULLPTR;
+    raster->bin_capacity = 0;
+
+    for( gp_uint32_t index = 0; index != 256; ++index )
+    {
+        raster->srgb_to_linear[index] = __srgb_decode( (float)index / 255.f );
+    }
+
+    for( gp_uint32_t index = 0; index != 4096; ++index )
+    {
+        raster->linear_to_srgb[index] = (gp_uint8_t)(__srgb_encode( (float)index / 4095.f ) * 255.f + 0.5f);
+    }
+
+    raster->malloc = _malloc;
+    raster->realloc = _realloc;
+    raster->free = _free;
+    raster->ud = _ud;
+
+    *_raster = raster;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_raster_destroy( gp_raster_t * _raster )
+{
+    if( _raster->positions != GP_NULLPTR )
+    {
+        GP_FREE( _raster, _raster->positions );
+        GP_FREE( _raster, _raster->colors );
+        GP_FREE( _raster, _raster->uvs );
+    }
+
+    if( _raster->triangles != GP_NULLPTR )
+    {
+        GP_FREE( _raster, _raster->triangles );
+    }
+
+    if( _raster->tile_offsets != GP_NULLPTR )
+    {
+        GP_FREE( _raster, _raster->tile_offsets );
+    }
+
+    if( _raster->bins != GP_NULLPTR )
+    {
+        GP_FREE( _raster, _raster->bins );
+    }
+
+    GP_FREE( _raster, _raster );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static float __half_to_float( gp_uint16_t _half )
+{
+    gp_uint32_t sign = (gp_uint32_t)(_half & 0x8000) << 16;
+    gp_uint32_t exponent = (_half >> 10) & 0x1f;
+    gp_uint32_t mantissa = _half & 0x03ff;
+
+    union
+    {
+        float f;
+        gp_uint32_t u;
+    } v;
+
+    if( exponent == 0x1f )
+    {
+        v.u = sign | 0x7f800000 | (mantissa << 13);
+    }
+    else if( exponent != 0 )
+    {
+        v.u = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    else
+    {
+        v.f = (float)mantissa / 16777216.f;
+        v.u |= sign;
+    }
+
+    return v.f;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __raster_decode_color( const gp_raster_t * _raster, const gp_mesh_t * _mesh, gp_argb_t _c, gp_color_t * _color )
+{
+    gp_uint32_t r;
+    gp_uint32_t g;
+    gp_uint32_t b;
+    gp_uint32_t a;
+
+    switch( _mesh->colors_format )
+    {
+    case GP_COLOR_FORMAT_ABGR:
+        {
+            a = (_c >> 24) & 0xff;
+            b = (_c >> 16) & 0xff;
+            g = (_c >> 8) & 0xff;
+            r = (_c >> 0) & 0xff;
+        }break;
+    case GP_COLOR_FORMAT_RGBA:
+        {
+            r = (_c >> 24) & 0xff;
+            g = (_c >> 16) & 0xff;
+            b = (_c >> 8) & 0xff;
+            a = (_c >> 0) & 0xff;
+        }break;
+    default:
+        {
+            a = (_c >> 24) & 0xff;
+            r = (_c >> 16) & 0xff;
+            g = (_c >> 8) & 0xff;
+            b = (_c >> 0) & 0xff;
+        }break;
+    }
+
+    float alpha = (float)a / 255.f;
+
+    gp_color_t straight;
+
+    if( _mesh->colors_premultiplied == GP_TRUE )
+    {
+        float unit = a == 0 ? 0.f : 1.f / (float)a;
+
+        straight.r = __saturate( (float)r * unit );
+        straight.g = __saturate( (float)g * unit );
+        straight.b = __saturate( (float)b * unit );
+    }
+    else
+    {
+        straight.r = (float)r / 255.f;
+        straight.g = (float)g / 255.f;
+        straight.b = (float)b / 255.f;
+    }
+
+    if( _raster->blend == GP_RASTER_BLEND_SRGB )
+    {
+        straight.r = __srgb_decode( straight.r );
+        straight.g = __srgb_decode( straight.g );
+        straight.b = __srgb_decode( straight.b );
+    }
+
+    _color->r = straight.r * alpha;
+    _color->g = straight.g * alpha;
+    _color->b = straight.b * alpha;
+    _color->a = alpha;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __raster_decode_vertices( gp_raster_t * _raster, const gp_mesh_t * _mesh )
+{
+    gp_uint32_t vertex_count = _mesh->vertex_count;
+
+    if( _raster->vertex_capacity < vertex_count )
+    {
+        _raster->positions = GP_REALLOC( _raster, _raster->positions, gp_vec2f_t, vertex_count );
+        _raster->colors = GP_REALLOC( _raster, _raster->colors, gp_color_t, vertex_count );
+        _raster->uvs = GP_REALLOC( _raster, _raster->uvs, gp_vec2f_t, vertex_count );
+        _raster->vertex_capacity = vertex_count;
+    }
+
+    gp_color_t base;
+
+    if( _mesh->colors_buffer == GP_NULLPTR )
+    {
+        const gp_color_t * c = &_mesh->color;
+
+        float r = GP_COLOR_R( c );
+        float g = GP_COLOR_G( c );
+        float b = GP_COLOR_B( c );
+        float a = GP_COLOR_A( c );
+
+        if( _raster->blend == GP_RASTER_BLEND_SRGB )
+        {
+            r = __srgb_decode( r );
+            g = __srgb_decode( g );
+            b = __srgb_decode( b );
+        }
+
+        base.r = r * a;
+        base.g = g * a;
+        base.b = b * a;
+        base.a = a;
+    }
+
+    for( gp_uint32_t index = 0; index != vertex_count; ++index )
+    {
+        const gp_uint8_t * position = (const gp_uint8_t *)_mesh->positions_buffer + _mesh->positions_offset + _mesh->positions_stride * index;
+
+        gp_vec2f_t * p = _raster->positions + index;
+
+        switch( _mesh->positions_format )
+        {
+        case GP_POSITION_FORMAT_FLOAT2:
+            {
+                *p = *(const gp_vec2f_t *)position;
+            }break;
+        case GP_POSITION_FORMAT_SHORT2:
+            {
+                const gp_int16_t * q = (const gp_int16_t *)position;
+
+                p->x = _mesh->positions_origin_x + (float)q[0] / _mesh->positions_scale;
+                p->y = _mesh->positions_origin_y + (float)q[1] / _mesh->positions_scale;
+            }break;
+        }
+
+        if( _mesh->colors_buffer != GP_NULLPTR )
+        {
+            gp_argb_t c = *(const gp_argb_t *)((const gp_uint8_t *)_mesh->colors_buffer + _mesh->colors_offset + _mesh->colors_stride * index);
+
+            __raster_decode_color( _raster, _mesh, c, _raster->colors + index );
+        }
+        else
+        {
+            _raster->colors[index] = base;
+        }
+
+        if( _raster->textured == GP_FALSE )
+        {
+            continue;
+        }
+
+        const gp_uint8_t * uv = (const gp_uint8_t *)_mesh->uv_buffer + _mesh->uv_offset + _mesh->uv_stride * index;
+
+        gp_vec2f_t * t = _raster->uvs + index;
+
+        switch( _mesh->uv_format )
+        {
+        case GP_UV_FORMAT_FLOAT2:
+            {
+                *t = *(const gp_vec2f_t *)uv;
+            }break;
+        case GP_UV_FORMAT_UNORM16:
+            {
+                const gp_uint16_t * q = (const gp_uint16_t *)uv;
+
+                t->x = (float)q[0] / 65535.f;
+                t->y = (float)q[1] / 65535.f;
+            }break;
+        case GP_UV_FORMAT_HALF2:
+            {
+                const gp_uint16_t * q = (const gp_uint16_t *)uv;
+
+                t->x = __half_to_float( q[0] );
+                t->y = __half_to_float( q[1] );
+            }break;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __raster_setup_edge( gp_raster_edge_t * _edge, const gp_vec2f_t * _a, const gp_vec2f_t * _b )
+{
+    _edge->x = _a->x;
+    _edge->y = _a->y;
+    _edge->dx = _b->x - _a->x;
+    _edge->dy = _b->y - _a->y;
+    _edge->top_left = (_edge->dy > 0.f || (_edge->dy == 0.f && _edge->dx < 0.f)) ? GP_TRUE : GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_int32_t __raster_clamp_pixel( float _value, gp_uint32_t _size )
+{
+    if( _value < 0.f )
+    {
+        return 0;
+    }
+
+    if( _value > (float)(_size - 1) )
+    {
+        return (gp_int32_t)(_size - 1);
+    }
+
+    return (gp_int32_t)_value;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __raster_setup_triangle( const gp_raster_t * _raster, gp_raster_triangle_t * _triangle, gp_uint16_t _i0, gp_uint16_t _i1, gp_uint16_t _i2 )
+{
+    const gp_vec2f_t * p0 = _raster->positions + _i0;
+    const gp_vec2f_t * p1 = _raster->positions + _i1;
+    const gp_vec2f_t * p2 = _raster->positions + _i2;
+
+    float area = (p0->x - p1->x) * (p2->y - p1->y) - (p0->y - p1->y) * (p2->x - p1->x);
+
+    if( area == 0.f || area != area )
+    {
+        return GP_FALSE;
+    }
+
+    if( area < 0.f )
+    {
+        const gp_vec2f_t * swap = p1;
+        p1 = p2;
+        p2 = swap;
+
+        gp_uint16_t iswap = _i1;
+        _i1 = _i2;
+        _i2 = iswap;
+
+        area = -area;
+    }
+
+    float minx = p0->x < p1->x ? (p0->x < p2->x ? p0->x : p2->x) : (p1->x < p2->x ? p1->x : p2->x);
+    float miny = p0->y < p1->y ? (p0->y < p2->y ? p0->y : p2->y) : (p1->y < p2->y ? p1->y : p2->y);
+    float maxx = p0->x > p1->x ? (p0->x > p2->x ? p0->x : p2->x) : (p1->x > p2->x ? p1->x : p2->x);
+    float maxy = p0->y > p1->y ? (p0->y > p2->y ? p0->y : p2->y) : (p1->y > p2->y ? p1->y : p2->y);
+
+    if( maxx < 0.f || maxy < 0.f || minx > (float)_raster->target.width || miny > (float)_raster->target.height )
+    {
+        return GP_FALSE;
+    }
+
+    _triangle->x0 = __raster_clamp_pixel( GP_MATH_FLOORF( minx ), _raster->target.width );
+    _triangle->y0 = __raster_clamp_pixel( GP_MATH_FLOORF( miny ), _raster->target.height );
+    _triangle->x1 = __raster_clamp_pixel( GP_MATH_FLOORF( maxx ), _raster->target.width );
+    _triangle->y1 = __raster_clamp_pixel( GP_MATH_FLOORF( maxy ), _raster->target.height );
+
+    __raster_setup_edge( _triangle->edges + 0, p1, p2 );
+    __raster_setup_edge( _triangle->edges + 1, p2, p0 );
+    __raster_setup_edge( _triangle->edges + 2, p0, p1 );
+
+    _triangle->inv_area = 1.f / area;
+
+    _triangle->vertices[0] = _i0;
+    _triangle->vertices[1] = _i1;
+    _triangle->vertices[2] = _i2;
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint16_t __raster_get_index( const gp_mesh_t * _mesh, gp_uint32_t _iterator )
+{
+    gp_uint16_t index = *(const gp_uint16_t *)((const gp_uint8_t *)_mesh->indices_buffer + _mesh->indices_offset + _mesh->indices_stride * _iterator);
+
+    return index;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_raster_bin( gp_raster_t * _raster, const gp_mesh_t * _mesh, const gp_image_t * _target, const gp_image_t * _texture, gp_raster_blend_e _blend, gp_uint32_t * _tile_count )
+{
+#if defined(GP_VALIDATION)
+    if( _mesh->positions_buffer == GP_NULLPTR || _mesh->indices_buffer == GP_NULLPTR )
+    {
+        return GP_FAILURE;
+    }
+
+    if( _target->pixels == GP_NULLPTR || _target->pitch < (gp_size_t)_target->width * 4 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( _texture != GP_NULLPTR && _texture->pixels != GP_NULLPTR && (_texture->width == 0 || _texture->height == 0 || _texture->pitch < (gp_size_t)_texture->width * 4) )
+    {
+        return GP_FAILURE;
+    }
+#endif
+
+    _raster->target = *_target;
+    _raster->blend = _blend;
+    _raster->textured = GP_FALSE;
+
+    if( _texture != GP_NULLPTR && _texture->pixels != GP_NULLPTR && _mesh->uv_buffer != GP_NULLPTR )
+    {
+        _raster->texture = *_texture;
+        _raster->textured = GP_TRUE;
+    }
+
+    _raster->tiles_x = (_target->width + GP_RASTER_TILE_SIZE - 1) / GP_RASTER_TILE_SIZE;
+    _raster->tiles_y = (_target->height + GP_RASTER_TILE_SIZE - 1) / GP_RASTER_TILE_SIZE;
+
+    gp_uint32_t tile_count = _raster->tiles_x * _raster->tiles_y;
+
+    *_tile_count = tile_count;
+
+    if( tile_count == 0 )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    __raster_decode_vertices( _raster, _mesh );
+
+    gp_uint32_t triangle_count = _mesh->index_count / 3;
+
+    if( _raster->triangle_capacity < triangle_count )
+    {
+        _raster->triangles = GP_REALLOC( _raster, _raster->triangles, gp_raster_triangle_t, triangle_count );
+        _raster->triangle_capacity = triangle_count;
+    }
+
+    if( _raster->tile_capacity < tile_count + 1 )
+    {
+        _raster->tile_offsets = GP_REALLOC( _raster, _raster->tile_offsets, gp_uint32_t, tile_count + 1 );
+        _raster->tile_capacity = tile_count + 1;
+    }
+
+    gp_uint32_t * offsets = _raster->tile_offsets;
+
+    for( gp_uint32_t tile = 0; tile != tile_count + 1; ++tile )
+    {
+        offsets[tile] = 0;
+    }
+
+    gp_uint32_t visible_count = 0;
+
+    for( gp_uint32_t index = 0; index != triangle_count; ++index )
+    {
+        gp_uint16_t i0 = __raster_get_index( _mesh, index * 3 + 0 );
+        gp_uint16_t i1 = __raster_get_index( _mesh, index * 3 + 1 );
+        gp_uint16_t i2 = __raster_get_index( _mesh, index * 3 + 2 );
+
+        gp_raster_triangle_t * triangle = _raster->triangles + visible_count;
+
+        if( __raster_setup_triangle( _raster, triangle, i0, i1, i2 ) == GP_FALSE )
+        {
+            continue;
+        }
+
+        ++visible_count;
+
+        for( gp_int32_t ty = triangle->y0 / GP_RASTER_TILE_SIZE; ty <= triangle->y1 / GP_RASTER_TILE_SIZE; ++ty )
+        {
+            for( gp_int32_t tx = triangle->x0 / GP_RASTER_TILE_SIZE; tx <= triangle->x1 / GP_RASTER_TILE_SIZE; ++tx )
+            {
+                ++offsets[ty * _raster->tiles_x + tx + 1];
+            }
+        }
+    }
+
+    for( gp_uint32_t tile = 0; tile != tile_count; ++tile )
+    {
+        offsets[tile + 1] += offsets[tile];
+    }
+
+    gp_uint32_t bin_count = offsets[tile_count];
+
+    if( _raster->bin_capacity < bin_count )
+    {
+        _raster->bins = GP_REALLOC( _raster, _raster->bins, gp_uint32_t, bin_count );
+        _raster->bin_capacity = bin_count;
+    }
+
+    for( gp_uint32_t index = 0; index != visible_count; ++index )
+    {
+        const gp_raster_triangle_t * triangle = _raster->triangles + index;
+
+        for( gp_int32_t ty = triangle->y0 / GP_RASTER_TILE_SIZE; ty <= triangle->y1 / GP_RASTER_TILE_SIZE; ++ty )
+        {
+            for( gp_int32_t tx = triangle->x0 / GP_RASTER_TILE_SIZE; tx <= triangle->x1 / GP_RASTER_TILE_SIZE; ++tx )
+            {
+                _raster->bins[offsets[ty * _raster->tiles_x + tx]++] = index;
+            }
+        }
+    }
+
+    for( gp_uint32_t tile = tile_count; tile != 0; --tile )
+    {
+        offsets[tile] = offsets[tile - 1];
+    }
+
+    offsets[0] = 0;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static float __raster_decode_channel( const gp_raster_t * _raster, gp_uint8_t _value )
+{
+    if( _raster->blend == GP_RASTER_BLEND_SRGB )
+    {
+        return _raster->srgb_to_linear[_value];
+    }
+
+    return (float)_value / 255.f;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint8_t __raster_encode_channel( const gp_raster_t * _raster, float _value )
+{
+    float value = __saturate( _value );
+
+    if( _raster->blend == GP_RASTER_BLEND_SRGB )
+    {
+        return _raster->linear_to_srgb[(gp_uint32_t)(value * 4095.f + 0.5f)];
+    }
+
+    return (gp_uint8_t)(value * 255.f + 0.5f);
+}
+//////////////////////////////////////////////////////////////////////////
+static void __raster_sample( const gp_raster_t * _raster, float _u, float _v, gp_color_t * _texel )
+{
+    const gp_image_t * texture = &_raster->texture;
+
+    gp_int32_t tx = __raster_clamp_pixel( GP_MATH_FLOORF( _u * (float)texture->width ), texture->width );
+    gp_int32_t ty = __raster_clamp_pixel( GP_MATH_FLOORF( _v * (float)texture->height ), texture->height );
+
+    const gp_uint8_t * texel = (const gp_uint8_t *)texture->pixels + texture->pitch * ty + tx * 4;
+
+    float alpha = (float)texel[3] / 255.f;
+
+    _texel->r = __raster_decode_channel( _raster, texel[0] ) * alpha;
+    _texel->g = __raster_decode_channel( _raster, texel[1] ) * alpha;
+    _texel->b = __raster_decode_channel( _raster, texel[2] ) * alpha;
+    _texel->a = alpha;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __raster_shade( const gp_raster_t * _raster, const gp_raster_triangle_t * _triangle, gp_int32_t _x, gp_int32_t _y, float _w1, float _w2 )
+{
+    float l1 = _w1 * _triangle->inv_area;
+    float l2 = _w2 * _triangle->inv_area;
+
+    const gp_color_t * c0 = _raster->colors + _triangle->vertices[0];
+    const gp_color_t * c1 = _raster->colors + _triangle->vertices[1];
+    const gp_color_t * c2 = _raster->colors + _triangle->vertices[2];
+
+    gp_color_t src;
+    src.r = c0->r + (c1->r - c0->r) * l1 + (c2->r - c0->r) * l2;
+    src.g = c0->g + (c1->g - c0->g) * l1 + (c2->g - c0->g) * l2;
+    src.b = c0->b + (c1->b - c0->b) * l1 + (c2->b - c0->b) * l2;
+    src.a = c0->a + (c1->a - c0->a) * l1 + (c2->a - c0->a) * l2;
+
+    if( _raster->textured == GP_TRUE )
+    {
+        const gp_vec2f_t * t0 = _raster->uvs + _triangle->vertices[0];
+        const gp_vec2f_t * t1 = _raster->uvs + _triangle->vertices[1];
+        const gp_vec2f_t * t2 = _raster->uvs + _triangle->vertices[2];
+
+        float u = t0->x + (t1->x - t0->x) * l1 + (t2->x - t0->x) * l2;
+        float v = t0->y + (t1->y - t0->y) * l1 + (t2->y - t0->y) * l2;
+
+        gp_color_t texel;
+        __raster_sample( _raster, u, v, &texel );
+
+        gp_color_mul( &src, &src, &texel );
+    }
+
+    gp_uint8_t * pixel = (gp_uint8_t *)_raster->target.pixels + _raster->target.pitch * _y + _x * 4;
+
+    float dst_a = (float)pixel[3] / 255.f;
+    float inv_a = 1.f - __saturate( src.a );
+
+    float a = __saturate( src.a ) + dst_a * inv_a;
+
+    if( a <= 0.f )
+    {
+        pixel[0] = 0;
+        pixel[1] = 0;
+        pixel[2] = 0;
+        pixel[3] = 0;
+
+        return;
+    }
+
+    float unit = 1.f / a;
+
+    float r = (src.r + __raster_decode_channel( _raster, pixel[0] ) * dst_a * inv_a) * unit;
+    float g = (src.g + __raster_decode_channel( _raster, pixel[1] ) * dst_a * inv_a) * unit;
+    float b = (src.b + __raster_decode_channel( _raster, pixel[2] ) * dst_a * inv_a) * unit;
+
+    pixel[0] = __raster_encode_channel( _raster, r );
+    pixel[1] = __raster_encode_channel( _raster, g );
+    pixel[2] = __raster_encode_channel( _raster, b );
+    pixel[3] = (gp_uint8_t)(__saturate( a ) * 255.f + 0.5f);
+}
+//////////////////////////////////////////////////////////////////////////
+#if !defined(GP_ENABLE_SSE2)
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __raster_inside( float _w, gp_bool_t _top_left )
+{
+    return _w > 0.f || (_w == 0.f && _top_left == GP_TRUE);
+}
+#endif
+//////////////////////////////////////////////////////////////////////////
+static void __raster_span( const gp_raster_t * _raster, const gp_raster_triangle_t * _triangle, gp_int32_t _y, gp_int32_t _x0, gp_int32_t _x1 )
+{
+    const gp_raster_edge_t * e0 = _triangle->edges + 0;
+    const gp_raster_edge_t * e1 = _triangle->edges + 1;
+    const gp_raster_edge_t * e2 = _triangle->edges + 2;
+
+    float py = (float)_y + 0.5f;
+
+    float row0 = (py - e0->y) * e0->dx;
+    float row1 = (py - e1->y) * e1->dx;
+    float row2 = (py - e2->y) * e2->dx;
+
+#if defined(GP_ENABLE_SSE2)
+    const __m128 lane = _mm_setr_ps( 0.f, 1.f, 2.f, 3.f );
+    const __m128 zero = _mm_setzero_ps();
+
+    const __m128 ex0 = _mm_set1_ps( e0->x );
+    const __m128 ex1 = _mm_set1_ps( e1->x );
+    const __m128 ex2 = _mm_set1_ps( e2->x );
+
+    const __m128 edy0 = _mm_set1_ps( e0->dy );
+    const __m128 edy1 = _mm_set1_ps( e1->dy );
+    const __m128 edy2 = _mm_set1_ps( e2->dy );
+
+    const __m128 erow0 = _mm_set1_ps( row0 );
+    const __m128 erow1 = _mm_set1_ps( row1 );
+    const __m128 erow2 = _mm_set1_ps( row2 );
+
+    const __m128 tl0 = _mm_castsi128_ps( _mm_set1_epi32( e0->top_left == GP_TRUE ? -1 : 0 ) );
+    const __m128 tl1 = _mm_castsi128_ps( _mm_set1_epi32( e1->top_left == GP_TRUE ? -1 : 0 ) );
+    const __m128 tl2 = _mm_castsi128_ps( _mm_set1_epi32( e2->top_left == GP_TRUE ? -1 : 0 ) );
+
+    for( gp_int32_t x = _x0; x <= _x1; x += 4 )
+    {
+        __m128 px = _mm_add_ps( _mm_set1_ps( (float)x + 0.5f ), lane );
+
+        __m128 w0 = _mm_sub_ps( _mm_mul_ps( _mm_sub_ps( px, ex0 ), edy0 ), erow0 );
+        __m128 w1 = _mm_sub_ps( _mm_mul_ps( _mm_sub_ps( px, ex1 ), edy1 ), erow1 );
+        __m128 w2 = _mm_sub_ps( _mm_mul_ps( _mm_sub_ps( px, ex2 ), edy2 ), erow2 );
+
+        __m128 in0 = _mm_or_ps( _mm_cmpgt_ps( w0, zero ), _mm_and_ps( _mm_cmpeq_ps( w0, zero ), tl0 ) );
+        __m128 in1 = _mm_or_ps( _mm_cmpgt_ps( w1, zero ), _mm_and_ps( _mm_cmpeq_ps( w1, zero ), tl1 ) );
+        __m128 in2 = _mm_or_ps( _mm_cmpgt_ps( w2, zero ), _mm_and_ps( _mm_cmpeq_ps( w2, zero ), tl2 ) );
+
+        gp_int32_t mask = _mm_movemask_ps( _mm_and_ps( _mm_and_ps( in0, in1 ), in2 ) );
+
+        if( _x1 - x < 3 )
+        {
+            mask &= (1 << (_x1 - x + 1)) - 1;
+        }
+
+        if( mask == 0 )
+        {
+            continue;
+        }
+
+        float weights1[4];
+        float weights2[4];
+        _mm_storeu_ps( weights1, w1 );
+        _mm_storeu_ps( weights2, w2 );
+
+        for( gp_int32_t index = 0; index != 4; ++index )
+        {
+            if( (mask & (1 << index)) == 0 )
+            {
+                continue;
+            }
+
+            __raster_shade( _raster, _triangle, x + index, _y, weights1[index], weights2[index] );
+        }
+    }
+#else
+    for( gp_int32_t x = _x0; x <= _x1; ++x )
+    {
+        float px = (float)x + 0.5f;
+
+        float w0 = (px - e0->x) * e0->dy - row0;
+        float w1 = (px - e1->x) * e1->dy - row1;
+        float w2 = (px - e2->x) * e2->dy - row2;
+
+        if( __raster_inside( w0, e0->top_left ) == GP_FALSE || __raster_inside( w1, e1->top_left ) == GP_FALSE || __raster_inside( w2, e2->top_left ) == GP_FALSE )
+        {
+            continue;
+        }
+
+        __raster_shade( _raster, _triangle, x, _y, w1, w2 );
+    }
+#endif
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_raster_tile( const gp_raster_t * _raster, gp_uint32_t _tile )
+{
+#if defined(GP_VALIDATION)
+    if( _tile >= _raster->tiles_x * _raster->tiles_y )
+    {
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_int32_t tx0 = (gp_int32_t)(_tile % _raster->tiles_x) * GP_RASTER_TILE_SIZE;
+    gp_int32_t ty0 = (gp_int32_t)(_tile / _raster->tiles_x) * GP_RASTER_TILE_SIZE;
+    gp_int32_t tx1 = tx0 + GP_RASTER_TILE_SIZE - 1;
+    gp_int32_t ty1 = ty0 + GP_RASTER_TILE_SIZE - 1;
+
+    gp_uint32_t begin = _raster->tile_offsets[_tile];
+    gp_uint32_t end = _raster->tile_offsets[_tile + 1];
+
+    for( gp_uint32_t iterator = begin; iterator != end; ++iterator )
+    {
+        const gp_raster_triangle_t * triangle = _raster->triangles + _raster->bins[iterator];
+
+        gp_int32_t x0 = triangle->x0 > tx0 ? triangle->x0 : tx0;
+        gp_int32_t y0 = triangle->y0 > ty0 ? triangle->y0 : ty0;
+        gp_int32_t x1 = triangle->x1 < tx1 ? triangle->x1 : tx1;
+        gp_int32_t y1 = triangle->y1 < ty1 ? triangle->y1 : ty1;
+
+        for( gp_int32_t y = y0; y <= y1; ++y )
+        {
+            __raster_span( _raster, triangle, y, x0, x1 );
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_raster_tiles( const gp_raster_t * _raster )
+{
+    gp_uint32_t tile_count = _raster->tiles_x * _raster->tiles_y;
+
+    for( gp_uint32_t tile = 0; tile != tile_count; ++tile )
+    {
+        GP_CALL( gp_raster_tile, (_raster, tile) );
+    }
+
+    return GP_SUCCESSFUL;
+}
@@ -0,0 +1,91 @@
+#include "sdf.h"
+
+#include "struct.h"
+#include "detail.h"
+
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_render_sdf_clear( const gp_mesh_t * _mesh )
+{
+    if( _mesh->sdf_buffer == GP_NULLPTR )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    gp_sdf_t sdf;
+    sdf.x = 0.f;
+    sdf.y = 0.f;
+    sdf.width = 0.f;
+    sdf.height = 0.f;
+    sdf.radius = 0.f;
+    sdf.thickness = 0.f;
+    sdf.penumbra = 0.f;
+    sdf.type = GP_SDF_TYPE_NONE;
+
+    for( gp_uint16_t index = 0; index != _mesh->vertex_count; ++index )
+    {
+        gp_mesh_push_sdf( _mesh, index, &sdf );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_render_sdf_quad( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, const gp_state_t * _state, gp_vec2f_t _center, float _width, float _height, float _radius, gp_sdf_type_e _type, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator )
+{
+    gp_uint16_t vertex_iterator = *_vertex_iterator;
+    gp_uint16_t index_iterator = *_index_iterator;
+
+    gp_argb_t argb = gp_mesh_color( _mesh, gp_color_fill_argb( &_mesh->color, _state ) );
+
+    float thickness = _state->thickness;
+    float half_thickness = thickness * 0.5f;
+
+    float extent_width = _width + half_thickness;
+    float extent_height = _height + half_thickness;
+
+    float total_width = extent_width * 2.f;
+    float total_height = extent_height * 2.f;
+
+    float u_offset = -(_center.x - extent_width);
+    float v_offset = -(_center.y - extent_height);
+
+    gp_mesh_push_index( _mesh, index_iterator + 0, vertex_iterator + 0 );
+    gp_mesh_push_index( _mesh, index_iterator + 1, vertex_iterator + 1 );
+    gp_mesh_push_index( _mesh, index_iterator + 2, vertex_iterator + 3 );
+    gp_mesh_push_index( _mesh, index_iterator + 3, vertex_iterator + 3 );
+    gp_mesh_push_index( _mesh, index_iterator + 4, vertex_iterator + 1 );
+    gp_mesh_push_index( _mesh, index_iterator + 5, vertex_iterator + 2 );
+
+    index_iterator += 6;
+
+    const float sx[4] = {-1.f, 1.f, 1.f, -1.f};
+    const float sy[4] = {-1.f, -1.f, 1.f, 1.f};
+
+    gp_sdf_t sdf;
+    sdf.width = _width;
+    sdf.height = _height;
+    sdf.radius = _radius;
+    sdf.thickness = thickness;
+    sdf.penumbra = _state->penumbra;
+    sdf.type = _type;
+
+    for( gp_uint32_t index = 0; index != 4; ++index )
+    {
+        sdf.x = sx[index] * extent_width;
+        sdf.y = sy[index] * extent_height;
+
+        float x = _center.x + sdf.x;
+        float y = _center.y + sdf.y;
+
+        gp_mesh_push_position( _mesh, vertex_iterator + 0, x, y );
+        gp_mesh_push_fill_color( _state, _mesh, vertex_iterator + 0, x, y, argb );
+        gp_mesh_push_uv_map( _state, _mesh, vertex_iterator + 0, x, y, u_offset, v_offset, total_width, total_height );
+        gp_mesh_push_sdf( _mesh, vertex_iterator + 0, &sdf );
+
+        vertex_iterator += 1;
+    }
+
+    *_vertex_iterator = vertex_iterator;
+    *_index_iterator = index_iterator;
+
+    return GP_SUCCESSFUL;
+}
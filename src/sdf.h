@@ -0,0 +1,11 @@
+#ifndef GP_SDF_H_
+#define GP_SDF_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+gp_result_t gp_render_sdf_clear( const gp_mesh_t * _mesh );
+gp_result_t gp_render_sdf_quad( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, const gp_state_t * _state, gp_vec2f_t _center, float _width, float _height, float _radius, gp_sdf_type_e _type, gp_uint16_t * _vertex_iterator, gp_uint16_t * _index_iterator );
+
+#endif
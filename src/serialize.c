@@ -0,0 +1,782 @@
+#include "graphics/graphics.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "hash.h"
+#include "size.h"
+#include "line.h"
+
+//////////////////////////////////////////////////////////////////////////
+#define GP_SERIALIZE_MAGIC (0x42435047U)
+#define GP_SERIALIZE_VERSION (6U)
+//////////////////////////////////////////////////////////////////////////
+#define GP_SERIALIZE_HEADER_SIZE (10 * 4)
+#define GP_SERIALIZE_STATE_SIZE (8 + 26 * 4)
+#define GP_SERIALIZE_DASH_SIZE (1 * 4)
+#define GP_SERIALIZE_GRADIENT_STOP_SIZE (5 * 4)
+#define GP_SERIALIZE_LINE_SIZE (1 * 4)
+#define GP_SERIALIZE_POINT_SIZE (8 * 4)
+#define GP_SERIALIZE_RECT_SIZE (5 * 4)
+#define GP_SERIALIZE_ROUNDED_RECT_SIZE (9 * 4)
+#define GP_SERIALIZE_ELLIPSE_SIZE (7 * 4)
+//////////////////////////////////////////////////////////////////////////
+typedef union gp_serialize_float_t
+{
+    float f;
+    gp_uint32_t u;
+} gp_serialize_float_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_serialize_header_t
+{
+    gp_uint32_t magic;
+    gp_uint32_t version;
+    gp_uint32_t state_count;
+    gp_uint32_t dash_count;
+    gp_uint32_t gradient_stop_count;
+    gp_uint32_t line_count;
+    gp_uint32_t point_count;
+    gp_uint32_t rect_count;
+    gp_uint32_t rounded_rect_count;
+    gp_uint32_t ellipse_count;
+} gp_serialize_header_t;
+//////////////////////////////////////////////////////////////////////////
+static gp_uint8_t * __write_u8( gp_uint8_t * _p, gp_uint8_t _value )
+{
+    _p[0] = _value;
+
+    return _p + 1;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint8_t * __write_u32( gp_uint8_t * _p, gp_uint32_t _value )
+{
+    _p[0] = (gp_uint8_t)(_value >> 0);
+    _p[1] = (gp_uint8_t)(_value >> 8);
+    _p[2] = (gp_uint8_t)(_value >> 16);
+    _p[3] = (gp_uint8_t)(_value >> 24);
+
+    return _p + 4;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint8_t * __write_f32( gp_uint8_t * _p, float _value )
+{
+    gp_serialize_float_t v;
+    v.f = _value;
+
+    return __write_u32( _p, v.u );
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_uint8_t * __read_u8( const gp_uint8_t * _p, gp_uint8_t * _value )
+{
+    *_value = _p[0];
+
+    return _p + 1;
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_uint8_t * __read_u32( const gp_uint8_t * _p, gp_uint32_t * _value )
+{
+    *_value = ((gp_uint32_t)_p[0] << 0) | ((gp_uint32_t)_p[1] << 8) | ((gp_uint32_t)_p[2] << 16) | ((gp_uint32_t)_p[3] << 24);
+
+    return _p + 4;
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_uint8_t * __read_f32( const gp_uint8_t * _p, float * _value )
+{
+    gp_serialize_float_t v;
+    const gp_uint8_t * p = __read_u32( _p, &v.u );
+
+    *_value = v.f;
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __calculate_size( const gp_serialize_header_t * _header )
+{
+    gp_size_t size = GP_SERIALIZE_HEADER_SIZE;
+
+    size += (gp_size_t)_header->state_count * GP_SERIALIZE_STATE_SIZE;
+    size += (gp_size_t)_header->dash_count * GP_SERIALIZE_DASH_SIZE;
+    size += (gp_size_t)_header->gradient_stop_count * GP_SERIALIZE_GRADIENT_STOP_SIZE;
+    size += (gp_size_t)_header->line_count * GP_SERIALIZE_LINE_SIZE;
+    size += (gp_size_t)_header->point_count * GP_SERIALIZE_POINT_SIZE;
+    size += (gp_size_t)_header->rect_count * GP_SERIALIZE_RECT_SIZE;
+    size += (gp_size_t)_header->rounded_rect_count * GP_SERIALIZE_ROUNDED_RECT_SIZE;
+    size += (gp_size_t)_header->ellipse_count * GP_SERIALIZE_ELLIPSE_SIZE;
+
+    return size;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __make_header( const gp_canvas_t * _canvas, gp_serialize_header_t * _header )
+{
+    _header->magic = GP_SERIALIZE_MAGIC;
+    _header->version = GP_SERIALIZE_VERSION;
+    _header->state_count = 0;
+    _header->dash_count = 0;
+    _header->gradient_stop_count = 0;
+    _header->line_count = 0;
+    _header->point_count = 0;
+    _header->rect_count = 0;
+    _header->rounded_rect_count = 0;
+    _header->ellipse_count = 0;
+
+    GP_LIST_FOREACH( const gp_state_t, _canvas->states, s )
+    {
+        ++_header->state_count;
+
+        _header->dash_count += s->dash_count;
+        _header->gradient_stop_count += s->gradient_stop_count;
+    }
+
+    GP_LIST_FOREACH( const gp_line_t, _canvas->lines, l )
+    {
+        ++_header->line_count;
+
+        GP_LIST_FOREACH( const gp_line_point_t, l->points, p )
+        {
+            ++_header->point_count;
+        }
+    }
+
+    GP_LIST_FOREACH( const gp_rect_t, _canvas->rects, r )
+    {
+        ++_header->rect_count;
+    }
+
+    GP_LIST_FOREACH( const gp_rounded_rect_t, _canvas->rounded_rects, rr )
+    {
+        ++_header->rounded_rect_count;
+    }
+
+    GP_LIST_FOREACH( const gp_ellipse_t, _canvas->ellipses, e )
+    {
+        ++_header->ellipse_count;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_serialize_cursor_t
+{
+    const gp_state_t * states;
+    const gp_state_t * state;
+    gp_uint32_t index;
+} gp_serialize_cursor_t;
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t __find_state_index( gp_serialize_cursor_t * _cursor, const gp_state_t * _state )
+{
+    gp_uint32_t index = _cursor->index;
+
+    for( const gp_state_t * s = _cursor->state; s != GP_NULLPTR; s = s->next, ++index )
+    {
+        if( s == _state )
+        {
+            _cursor->state = s;
+            _cursor->index = index;
+
+            return index;
+        }
+    }
+
+    index = 0;
+
+    for( const gp_state_t * s = _cursor->states; s != _cursor->state; s = s->next, ++index )
+    {
+        if( s == _state )
+        {
+            _cursor->state = s;
+            _cursor->index = index;
+
+            return index;
+        }
+    }
+
+    return ~0U;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint8_t * __write_state( gp_uint8_t * _p, const gp_state_t * _state )
+{
+    gp_uint8_t * p = _p;
+
+    p = __write_u8( p, (gp_uint8_t)_state->fill );
+    p = __write_u8( p, (gp_uint8_t)_state->sdf );
+    p = __write_u8( p, (gp_uint8_t)_state->line_join );
+    p = __write_u8( p, _state->curve_quality );
+    p = __write_u8( p, _state->ellipse_quality );
+    p = __write_u8( p, _state->rect_quality );
+    p = __write_u8( p, (gp_uint8_t)_state->blend );
+    p = __write_u8( p, 0 );
+
+    p = __write_f32( p, _state->thickness );
+    p = __write_f32( p, _state->outline_width );
+    p = __write_f32( p, _state->penumbra );
+    p = __write_f32( p, _state->miter_limit );
+
+    p = __write_u32( p, _state->dash_count );
+
+    for( gp_uint32_t index = 0; index != _state->dash_count; ++index )
+    {
+        p = __write_f32( p, _state->dash_pattern[index] );
+    }
+
+    p = __write_f32( p, _state->dash_offset );
+
+    p = __write_f32( p, _state->color.r );
+    p = __write_f32( p, _state->color.g );
+    p = __write_f32( p, _state->color.b );
+    p = __write_f32( p, _state->color.a );
+
+    p = __write_f32( p, _state->outline_color.r );
+    p = __write_f32( p, _state->outline_color.g );
+    p = __write_f32( p, _state->outline_color.b );
+    p = __write_f32( p, _state->outline_color.a );
+
+    p = __write_u32( p, (gp_uint32_t)_state->gradient );
+    p = __write_f32( p, _state->gradient_x0 );
+    p = __write_f32( p, _state->gradient_y0 );
+    p = __write_f32( p, _state->gradient_x1 );
+    p = __write_f32( p, _state->gradient_y1 );
+    p = __write_f32( p, _state->gradient_radius );
+
+    p = __write_u32( p, _state->gradient_stop_count );
+
+    for( gp_uint32_t index = 0; index != _state->gradient_stop_count; ++index )
+    {
+        const gp_gradient_stop_t * stop = _state->gradient_stops + index;
+
+        p = __write_f32( p, stop->offset );
+        p = __write_f32( p, stop->color.r );
+        p = __write_f32( p, stop->color.g );
+        p = __write_f32( p, stop->color.b );
+        p = __write_f32( p, stop->color.a );
+    }
+
+    p = __write_f32( p, _state->uv_ou );
+    p = __write_f32( p, _state->uv_ov );
+    p = __write_f32( p, _state->uv_su );
+    p = __write_f32( p, _state->uv_sv );
+
+    p = __write_u32( p, _state->material );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_uint8_t * __read_state( const gp_uint8_t * _p, gp_state_t * _state, gp_uint32_t * _dash_count, gp_uint32_t * _gradient_stop_count )
+{
+    const gp_uint8_t * p = _p;
+
+    gp_uint8_t fill;
+    gp_uint8_t sdf;
+    gp_uint8_t line_join;
+    gp_uint8_t blend;
+    gp_uint8_t reserved;
+
+    p = __read_u8( p, &fill );
+    p = __read_u8( p, &sdf );
+    p = __read_u8( p, &line_join );
+    p = __read_u8( p, &_state->curve_quality );
+    p = __read_u8( p, &_state->ellipse_quality );
+    p = __read_u8( p, &_state->rect_quality );
+    p = __read_u8( p, &blend );
+    p = __read_u8( p, &reserved );
+
+    _state->fill = fill == 0 ? GP_FALSE : GP_TRUE;
+    _state->sdf = sdf == 0 ? GP_FALSE : GP_TRUE;
+    _state->line_join = (gp_line_join_e)line_join;
+    _state->blend = blend == 0 ? GP_FALSE : GP_TRUE;
+
+    p = __read_f32( p, &_state->thickness );
+    p = __read_f32( p, &_state->outline_width );
+    p = __read_f32( p, &_state->penumbra );
+    p = __read_f32( p, &_state->miter_limit );
+
+    p = __read_u32( p, &_state->dash_count );
+
+    if( _state->dash_count > GP_DASH_PATTERN_MAX || _state->dash_count > *_dash_count )
+    {
+        return GP_NULLPTR;
+    }
+
+    *_dash_count -= _state->dash_count;
+
+    for( gp_uint32_t index = 0; index != _state->dash_count; ++index )
+    {
+        p = __read_f32( p, _state->dash_pattern + index );
+    }
+
+    p = __read_f32( p, &_state->dash_offset );
+
+    p = __read_f32( p, &_state->color.r );
+    p = __read_f32( p, &_state->color.g );
+    p = __read_f32( p, &_state->color.b );
+    p = __read_f32( p, &_state->color.a );
+
+    p = __read_f32( p, &_state->outline_color.r );
+    p = __read_f32( p, &_state->outline_color.g );
+    p = __read_f32( p, &_state->outline_color.b );
+    p = __read_f32( p, &_state->outline_color.a );
+
+    gp_uint32_t gradient;
+
+    p = __read_u32( p, &gradient );
+    p = __read_f32( p, &_state->gradient_x0 );
+    p = __read_f32( p, &_state->gradient_y0 );
+    p = __read_f32( p, &_state->gradient_x1 );
+    p = __read_f32( p, &_state->gradient_y1 );
+    p = __read_f32( p, &_state->gradient_radius );
+
+    _state->gradient = (gp_gradient_e)gradient;
+
+    p = __read_u32( p, &_state->gradient_stop_count );
+
+    if( _state->gradient_stop_count > GP_GRADIENT_STOP_MAX || _state->gradient_stop_count > *_gradient_stop_count )
+    {
+        return GP_NULLPTR;
+    }
+
+    *_gradient_stop_count -= _state->gradient_stop_count;
+
+    for( gp_uint32_t index = 0; index != _state->gradient_stop_count; ++index )
+    {
+        gp_gradient_stop_t * stop = _state->gradient_stops + index;
+
+        p = __read_f32( p, &stop->offset );
+        p = __read_f32( p, &stop->color.r );
+        p = __read_f32( p, &stop->color.g );
+        p = __read_f32( p, &stop->color.b );
+        p = __read_f32( p, &stop->color.a );
+    }
+
+    p = __read_f32( p, &_state->uv_ou );
+    p = __read_f32( p, &_state->uv_ov );
+    p = __read_f32( p, &_state->uv_su );
+    p = __read_f32( p, &_state->uv_sv );
+
+    p = __read_u32( p, &_state->material );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __check_state( const gp_state_t * _state )
+{
+    if( _state->line_join != GP_LINE_JOIN_MITER && _state->line_join != GP_LINE_JOIN_BEVEL && _state->line_join != GP_LINE_JOIN_ROUND )
+    {
+        return GP_FALSE;
+    }
+
+    if( _state->gradient != GP_GRADIENT_NONE && _state->gradient != GP_GRADIENT_LINEAR && _state->gradient != GP_GRADIENT_RADIAL )
+    {
+        return GP_FALSE;
+    }
+
+    if( _state->gradient != GP_GRADIENT_NONE && _state->gradient_stop_count == 0 )
+    {
+        return GP_FALSE;
+    }
+
+    if( _state->curve_quality == 0 || _state->ellipse_quality == 0 || _state->rect_quality == 0 )
+    {
+        return GP_FALSE;
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_save_to_memory( const gp_canvas_t * _canvas, void * _buffer, gp_size_t _capacity, gp_size_t * _size )
+{
+    gp_serialize_header_t header;
+    __make_header( _canvas, &header );
+
+    gp_size_t size = __calculate_size( &header );
+
+    *_size = size;
+
+    if( _buffer == GP_NULLPTR )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    if( _capacity < size )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_uint8_t * p = (gp_uint8_t *)_buffer;
+
+    p = __write_u32( p, header.magic );
+    p = __write_u32( p, header.version );
+    p = __write_u32( p, header.state_count );
+    p = __write_u32( p, header.dash_count );
+    p = __write_u32( p, header.gradient_stop_count );
+    p = __write_u32( p, header.line_count );
+    p = __write_u32( p, header.point_count );
+    p = __write_u32( p, header.rect_count );
+    p = __write_u32( p, header.rounded_rect_count );
+    p = __write_u32( p, header.ellipse_count );
+
+    GP_LIST_FOREACH( const gp_state_t, _canvas->states, s )
+    {
+        p = __write_state( p, s );
+    }
+
+    gp_serialize_cursor_t cursor;
+    cursor.states = _canvas->states;
+    cursor.state = _canvas->states;
+    cursor.index = 0;
+
+    GP_LIST_FOREACH( const gp_line_t, _canvas->lines, l )
+    {
+        gp_uint32_t point_count = 0;
+
+        GP_LIST_FOREACH( const gp_line_point_t, l->points, lp )
+        {
+            ++point_count;
+        }
+
+        p = __write_u32( p, point_count );
+
+        const gp_line_edge_t * e = GP_NULLPTR;
+
+        GP_LIST_FOREACH( const gp_line_point_t, l->points, lp )
+        {
+            gp_uint32_t controls = e == GP_NULLPTR ? 0 : e->controls;
+
+            p = __write_f32( p, lp->p.x );
+            p = __write_f32( p, lp->p.y );
+            p = __write_u32( p, __find_state_index( &cursor, lp->state ) );
+            p = __write_u32( p, controls );
+
+            for( gp_uint32_t index = 0; index != 2; ++index )
+            {
+                float cx = index < controls ? e->p[index].x : 0.f;
+                float cy = index < controls ? e->p[index].y : 0.f;
+
+                p = __write_f32( p, cx );
+                p = __write_f32( p, cy );
+            }
+
+            e = e == GP_NULLPTR ? l->edges : e->next;
+        }
+    }
+
+    GP_LIST_FOREACH( const gp_rect_t, _canvas->rects, r )
+    {
+        p = __write_f32( p, r->point.x );
+        p = __write_f32( p, r->point.y );
+        p = __write_f32( p, r->width );
+        p = __write_f32( p, r->height );
+        p = __write_u32( p, __find_state_index( &cursor, r->state ) );
+    }
+
+    GP_LIST_FOREACH( const gp_rounded_rect_t, _canvas->rounded_rects, rr )
+    {
+        p = __write_f32( p, rr->point.x );
+        p = __write_f32( p, rr->point.y );
+        p = __write_f32( p, rr->width );
+        p = __write_f32( p, rr->height );
+        p = __write_f32( p, rr->radius[0] );
+        p = __write_f32( p, rr->radius[1] );
+        p = __write_f32( p, rr->radius[2] );
+        p = __write_f32( p, rr->radius[3] );
+        p = __write_u32( p, __find_state_index( &cursor, rr->state ) );
+    }
+
+    GP_LIST_FOREACH( const gp_ellipse_t, _canvas->ellipses, e )
+    {
+        p = __write_f32( p, e->point.x );
+        p = __write_f32( p, e->point.y );
+        p = __write_f32( p, e->radius_width );
+        p = __write_f32( p, e->radius_height );
+        p = __write_f32( p, e->angle_start );
+        p = __write_f32( p, e->angle_sweep );
+        p = __write_u32( p, __find_state_index( &cursor, e->state ) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static const gp_uint8_t * __read_state_index( const gp_uint8_t * _p, const gp_state_t ** _states, gp_uint32_t _count, const gp_state_t ** _state )
+{
+    gp_uint32_t index;
+    const gp_uint8_t * p = __read_u32( _p, &index );
+
+    *_state = index < _count ? _states[index] : GP_NULLPTR;
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __load_primitives( gp_canvas_t * _canvas, const gp_uint8_t * _p, const gp_serialize_header_t * _header, const gp_state_t ** _states )
+{
+    const gp_uint8_t * p = _p;
+
+    gp_uint32_t state_count = _header->state_count;
+    gp_uint32_t point_total = 0;
+
+    for( gp_uint32_t line_index = 0; line_index != _header->line_count; ++line_index )
+    {
+        gp_uint32_t point_count;
+        p = __read_u32( p, &point_count );
+
+        if( point_count == 0 || point_count > _header->point_count - point_total )
+        {
+            return GP_FAILURE;
+        }
+
+        point_total += point_count;
+
+        if( _canvas->lines != GP_NULLPTR )
+        {
+            gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_LINE, GP_LIST_BACK( _canvas->lines ) );
+        }
+
+        gp_line_t * l = GP_NEW( _canvas, gp_line_t );
+        l->next = GP_NULLPTR;
+        l->prev = GP_NULLPTR;
+
+        l->points = GP_NULLPTR;
+        l->edges = GP_NULLPTR;
+        l->state = GP_NULLPTR;
+
+        GP_LIST_PUSHBACK( gp_line_t, _canvas->lines, l );
+
+        for( gp_uint32_t point_index = 0; point_index != point_count; ++point_index )
+        {
+            gp_line_point_t * lp = GP_NEW( _canvas, gp_line_point_t );
+            lp->next = GP_NULLPTR;
+            lp->prev = GP_NULLPTR;
+
+            p = __read_f32( p, &lp->p.x );
+            p = __read_f32( p, &lp->p.y );
+            p = __read_state_index( p, _states, state_count, &lp->state );
+
+            GP_LIST_PUSHBACK( gp_line_point_t, l->points, lp );
+
+            gp_uint32_t controls;
+            p = __read_u32( p, &controls );
+
+            gp_vec2f_t c[2];
+            p = __read_f32( p, &c[0].x );
+            p = __read_f32( p, &c[0].y );
+            p = __read_f32( p, &c[1].x );
+            p = __read_f32( p, &c[1].y );
+
+            if( lp->state == GP_NULLPTR || controls > 2 )
+            {
+                return GP_FAILURE;
+            }
+
+            if( point_index == 0 )
+            {
+                l->state = lp->state;
+
+                gp_line_joints_begin( l );
+
+                gp_hash_line_point( &_canvas->hash_lines, lp, GP_NULLPTR );
+
+                continue;
+            }
+
+            gp_line_edge_t * e = GP_NEW( _canvas, gp_line_edge_t );
+            e->next = GP_NULLPTR;
+            e->prev = GP_NULLPTR;
+
+            e->controls = controls;
+            e->p[0] = c[0];
+            e->p[1] = c[1];
+
+            GP_LIST_PUSHBACK( gp_line_edge_t, l->edges, e );
+
+            gp_line_joints_advance( l );
+
+            gp_hash_line_point( &_canvas->hash_lines, lp, e );
+        }
+    }
+
+    if( point_total != _header->point_count )
+    {
+        return GP_FAILURE;
+    }
+
+    for( gp_uint32_t index = 0; index != _header->rect_count; ++index )
+    {
+        gp_rect_t * r = GP_NEW( _canvas, gp_rect_t );
+        r->next = GP_NULLPTR;
+        r->prev = GP_NULLPTR;
+        r->handle = 0;
+
+        p = __read_f32( p, &r->point.x );
+        p = __read_f32( p, &r->point.y );
+        p = __read_f32( p, &r->width );
+        p = __read_f32( p, &r->height );
+        p = __read_state_index( p, _states, state_count, &r->state );
+
+        GP_LIST_PUSHBACK( gp_rect_t, _canvas->rects, r );
+
+        if( r->state == GP_NULLPTR )
+        {
+            return GP_FAILURE;
+        }
+
+        gp_hash_shape_append( _canvas, GP_SHAPE_TYPE_RECT, r );
+
+        gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_RECT, r );
+    }
+
+    for( gp_uint32_t index = 0; index != _header->rounded_rect_count; ++index )
+    {
+        gp_rounded_rect_t * rr = GP_NEW( _canvas, gp_rounded_rect_t );
+        rr->next = GP_NULLPTR;
+        rr->prev = GP_NULLPTR;
+        rr->handle = 0;
+
+        p = __read_f32( p, &rr->point.x );
+        p = __read_f32( p, &rr->point.y );
+        p = __read_f32( p, &rr->width );
+        p = __read_f32( p, &rr->height );
+        p = __read_f32( p, &rr->radius[0] );
+        p = __read_f32( p, &rr->radius[1] );
+        p = __read_f32( p, &rr->radius[2] );
+        p = __read_f32( p, &rr->radius[3] );
+        p = __read_state_index( p, _states, state_count, &rr->state );
+
+        GP_LIST_PUSHBACK( gp_rounded_rect_t, _canvas->rounded_rects, rr );
+
+        if( rr->state == GP_NULLPTR )
+        {
+            return GP_FAILURE;
+        }
+
+        gp_hash_shape_append( _canvas, GP_SHAPE_TYPE_ROUNDED_RECT, rr );
+
+        gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_ROUNDED_RECT, rr );
+    }
+
+    for( gp_uint32_t index = 0; index != _header->ellipse_count; ++index )
+    {
+        gp_ellipse_t * e = GP_NEW( _canvas, gp_ellipse_t );
+        e->next = GP_NULLPTR;
+        e->prev = GP_NULLPTR;
+        e->handle = 0;
+
+        p = __read_f32( p, &e->point.x );
+        p = __read_f32( p, &e->point.y );
+        p = __read_f32( p, &e->radius_width );
+        p = __read_f32( p, &e->radius_height );
+        p = __read_f32( p, &e->angle_start );
+        p = __read_f32( p, &e->angle_sweep );
+        p = __read_state_index( p, _states, state_count, &e->state );
+
+        GP_LIST_PUSHBACK( gp_ellipse_t, _canvas->ellipses, e );
+
+        if( e->state == GP_NULLPTR )
+        {
+            return GP_FAILURE;
+        }
+
+        gp_hash_shape_append( _canvas, GP_SHAPE_TYPE_ELLIPSE, e );
+
+        gp_mesh_size_append( _canvas, GP_SHAPE_TYPE_ELLIPSE, e );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_load_from_memory( gp_canvas_t * _canvas, const void * _buffer, gp_size_t _size )
+{
+    if( _size < GP_SERIALIZE_HEADER_SIZE )
+    {
+        return GP_FAILURE;
+    }
+
+    const gp_uint8_t * p = (const gp_uint8_t *)_buffer;
+
+    gp_serialize_header_t header;
+    p = __read_u32( p, &header.magic );
+    p = __read_u32( p, &header.version );
+    p = __read_u32( p, &header.state_count );
+    p = __read_u32( p, &header.dash_count );
+    p = __read_u32( p, &header.gradient_stop_count );
+    p = __read_u32( p, &header.line_count );
+    p = __read_u32( p, &header.point_count );
+    p = __read_u32( p, &header.rect_count );
+    p = __read_u32( p, &header.rounded_rect_count );
+    p = __read_u32( p, &header.ellipse_count );
+
+    if( header.magic != GP_SERIALIZE_MAGIC || header.version != GP_SERIALIZE_VERSION )
+    {
+        return GP_FAILURE;
+    }
+
+    if( header.line_count > header.point_count )
+    {
+        return GP_FAILURE;
+    }
+
+    if( __calculate_size( &header ) != _size )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    const gp_state_t ** states = GP_NULLPTR;
+
+    if( header.state_count != 0 )
+    {
+        states = (const gp_state_t **)(*_canvas->malloc)(sizeof( const gp_state_t * ) * header.state_count, _canvas->ud);
+    }
+
+    gp_result_t result = GP_SUCCESSFUL;
+
+    gp_uint32_t dash_count = header.dash_count;
+    gp_uint32_t gradient_stop_count = header.gradient_stop_count;
+
+    for( gp_uint32_t index = 0; index != header.state_count; ++index )
+    {
+        gp_state_t * s = GP_NEW( _canvas, gp_state_t );
+        s->next = GP_NULLPTR;
+        s->prev = GP_NULLPTR;
+
+        GP_LIST_PUSHBACK( gp_state_t, _canvas->states, s );
+
+        states[index] = s;
+
+        p = __read_state( p, s, &dash_count, &gradient_stop_count );
+
+        if( p == GP_NULLPTR || __check_state( s ) == GP_FALSE )
+        {
+            result = GP_FAILURE;
+
+            break;
+        }
+
+        s->curve_quality_inv = 1.f / (float)s->curve_quality;
+        s->ellipse_quality_inv = 1.f / (float)s->ellipse_quality;
+        s->rect_quality_inv = 1.f / (float)s->rect_quality;
+
+        s->argb = gp_color_argb( &s->color );
+        s->outline_argb = gp_color_argb( &s->outline_color );
+
+        s->hash = gp_hash_state( s );
+    }
+
+    if( result == GP_SUCCESSFUL && (dash_count != 0 || gradient_stop_count != 0) )
+    {
+        result = GP_FAILURE;
+    }
+
+    if( result == GP_SUCCESSFUL )
+    {
+        result = __load_primitives( _canvas, p, &header, states );
+    }
+
+    if( states != GP_NULLPTR )
+    {
+        GP_FREE( _canvas, states );
+    }
+
+    if( result == GP_FAILURE )
+    {
+        gp_canvas_clear( _canvas );
+
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
@@ -0,0 +1,206 @@
+#include "size.h"
+#include "line.h"
+#include "rect.h"
+#include "rounded_rect.h"
+#include "ellipse.h"
+
+#include "struct.h"
+#include "detail.h"
+
+//////////////////////////////////////////////////////////////////////////
+void gp_mesh_size_reset( gp_canvas_t * _canvas )
+{
+    _canvas->size_vertex_count = 0;
+    _canvas->size_index_count = 0;
+
+    for( gp_uint32_t type = 0; type != 4; ++type )
+    {
+        _canvas->size_range_counts[type] = 0;
+    }
+
+    _canvas->size_range_line = GP_NULLPTR;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t __range_break( const gp_state_t * _back, const gp_state_t * _state )
+{
+    if( _back == GP_NULLPTR )
+    {
+        return 1;
+    }
+
+    if( _back->material == _state->material && _back->blend == _state->blend )
+    {
+        return 0;
+    }
+
+    return 1;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t __range_weight( const gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    const gp_state_t * state = GP_NULLPTR;
+    const gp_state_t * prev = GP_NULLPTR;
+    const gp_state_t * next = GP_NULLPTR;
+
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_RECT:
+        {
+            const gp_rect_t * r = (const gp_rect_t *)_primitive;
+
+            state = r->state;
+            prev = r == _canvas->rects ? GP_NULLPTR : r->prev->state;
+            next = r->next == GP_NULLPTR ? GP_NULLPTR : r->next->state;
+        }break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        {
+            const gp_rounded_rect_t * rr = (const gp_rounded_rect_t *)_primitive;
+
+            state = rr->state;
+            prev = rr == _canvas->rounded_rects ? GP_NULLPTR : rr->prev->state;
+            next = rr->next == GP_NULLPTR ? GP_NULLPTR : rr->next->state;
+        }break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        {
+            const gp_ellipse_t * e = (const gp_ellipse_t *)_primitive;
+
+            state = e->state;
+            prev = e == _canvas->ellipses ? GP_NULLPTR : e->prev->state;
+            next = e->next == GP_NULLPTR ? GP_NULLPTR : e->next->state;
+        }break;
+    default:
+        return 0;
+    }
+
+    gp_uint32_t weight = __range_break( prev, state );
+
+    if( next != GP_NULLPTR )
+    {
+        weight += __range_break( state, next );
+        weight -= __range_break( prev, next );
+    }
+
+    return weight;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_mesh_size_range_link( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    if( _type == GP_SHAPE_TYPE_LINE )
+    {
+        const gp_line_t * l = (const gp_line_t *)_primitive;
+
+        if( l->edges == GP_NULLPTR )
+        {
+            return;
+        }
+
+        _canvas->size_range_counts[_type] += __range_break( _canvas->size_range_line, l->state );
+        _canvas->size_range_line = l->state;
+
+        return;
+    }
+
+    _canvas->size_range_counts[_type] += __range_weight( _canvas, _type, _primitive );
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_mesh_size_range_unlink( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    _canvas->size_range_counts[_type] -= __range_weight( _canvas, _type, _primitive );
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_calculate_primitive_size( gp_shape_type_e _type, const void * _primitive, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count )
+{
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_LINE:
+        gp_calculate_line_size( (const gp_line_t *)_primitive, _vertex_count, _index_count );
+        break;
+    case GP_SHAPE_TYPE_RECT:
+        gp_calculate_rect_size( (const gp_rect_t *)_primitive, _vertex_count, _index_count );
+        break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        gp_calculate_rounded_rect_size( (const gp_rounded_rect_t *)_primitive, _vertex_count, _index_count );
+        break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        gp_calculate_ellipse_size( (const gp_ellipse_t *)_primitive, _vertex_count, _index_count );
+        break;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_mesh_size_append( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    gp_uint32_t vertex_count = 0;
+    gp_uint32_t index_count = 0;
+
+    gp_calculate_primitive_size( _type, _primitive, &vertex_count, &index_count );
+
+    _canvas->size_vertex_count += vertex_count;
+    _canvas->size_index_count += index_count;
+
+    gp_mesh_size_range_link( _canvas, _type, _primitive );
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_mesh_size_remove( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive )
+{
+    gp_uint32_t vertex_count = 0;
+    gp_uint32_t index_count = 0;
+
+    gp_calculate_primitive_size( _type, _primitive, &vertex_count, &index_count );
+
+    _canvas->size_vertex_count -= vertex_count;
+    _canvas->size_index_count -= index_count;
+
+    gp_mesh_size_range_unlink( _canvas, _type, _primitive );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __mesh_size_range_list( const gp_state_t * _first, const gp_state_t * _last, gp_uint32_t _count, gp_uint32_t * _range_count, const gp_state_t ** _back )
+{
+    if( _count == 0 )
+    {
+        return;
+    }
+
+    *_range_count += _count - (1 - __range_break( *_back, _first ));
+    *_back = _last;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_mesh_size_get( const gp_canvas_t * _canvas, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count, gp_uint32_t * _range_count )
+{
+    gp_uint32_t vertex_count = _canvas->size_vertex_count;
+    gp_uint32_t index_count = _canvas->size_index_count;
+    gp_uint32_t range_count = _canvas->size_range_counts[GP_SHAPE_TYPE_LINE];
+
+    const gp_state_t * back = _canvas->size_range_line;
+
+    if( _canvas->lines != GP_NULLPTR )
+    {
+        const gp_line_t * l = GP_LIST_BACK( _canvas->lines );
+
+        gp_calculate_line_size( l, &vertex_count, &index_count );
+
+        if( l->edges != GP_NULLPTR )
+        {
+            range_count += __range_break( back, l->state );
+            back = l->state;
+        }
+    }
+
+    if( _canvas->rects != GP_NULLPTR )
+    {
+        __mesh_size_range_list( _canvas->rects->state, GP_LIST_BACK( _canvas->rects )->state, _canvas->size_range_counts[GP_SHAPE_TYPE_RECT], &range_count, &back );
+    }
+
+    if( _canvas->rounded_rects != GP_NULLPTR )
+    {
+        __mesh_size_range_list( _canvas->rounded_rects->state, GP_LIST_BACK( _canvas->rounded_rects )->state, _canvas->size_range_counts[GP_SHAPE_TYPE_ROUNDED_RECT], &range_count, &back );
+    }
+
+    if( _canvas->ellipses != GP_NULLPTR )
+    {
+        __mesh_size_range_list( _canvas->ellipses->state, GP_LIST_BACK( _canvas->ellipses )->state, _canvas->size_range_counts[GP_SHAPE_TYPE_ELLIPSE], &range_count, &back );
+    }
+
+    *_vertex_count = vertex_count;
+    *_index_count = index_count;
+    *_range_count = range_count;
+}
@@ -0,0 +1,20 @@
+#ifndef GP_SIZE_H_
+#define GP_SIZE_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+#define GP_MESH_SIZE_MAX (65535U)
+#define GP_MESH_ATTRIBUTE_UNSET (~(gp_size_t)0)
+
+void gp_calculate_primitive_size( gp_shape_type_e _type, const void * _primitive, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count );
+
+void gp_mesh_size_reset( gp_canvas_t * _canvas );
+void gp_mesh_size_append( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive );
+void gp_mesh_size_remove( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive );
+void gp_mesh_size_range_link( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive );
+void gp_mesh_size_range_unlink( gp_canvas_t * _canvas, gp_shape_type_e _type, const void * _primitive );
+void gp_mesh_size_get( const gp_canvas_t * _canvas, gp_uint32_t * _vertex_count, gp_uint32_t * _index_count, gp_uint32_t * _range_count );
+
+#endif
@@ -0,0 +1,834 @@
+#include "spatial.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "corner.h"
+
+//////////////////////////////////////////////////////////////////////////
+#define GP_SPATIAL_LEAF_SIZE (4U)
+#define GP_SPATIAL_STACK_MAX (64U)
+//////////////////////////////////////////////////////////////////////////
+typedef void (*gp_spatial_visit_t)(const gp_spatial_item_t * _item, void * _ud);
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_spatial_pick_t
+{
+    float x;
+    float y;
+
+    gp_shape_t shape;
+    gp_bool_t found;
+} gp_spatial_pick_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_spatial_query_t
+{
+    gp_shape_t * shapes;
+    gp_uint32_t capacity;
+    gp_uint32_t count;
+} gp_spatial_query_t;
+//////////////////////////////////////////////////////////////////////////
+void gp_spatial_index_reset( gp_spatial_index_t * _index )
+{
+    _index->items = GP_NULLPTR;
+    _index->item_count = 0;
+
+    _index->nodes = GP_NULLPTR;
+    _index->node_count = 0;
+
+    _index->line_last = GP_NULLPTR;
+    _index->rect_last = GP_NULLPTR;
+    _index->rounded_rect_last = GP_NULLPTR;
+    _index->ellipse_last = GP_NULLPTR;
+
+    _index->line_count = 0;
+    _index->rect_count = 0;
+    _index->rounded_rect_count = 0;
+    _index->ellipse_count = 0;
+}
+//////////////////////////////////////////////////////////////////////////
+void gp_spatial_index_free( gp_canvas_t * _canvas )
+{
+    gp_spatial_index_t * index = &_canvas->index;
+
+    if( index->items != GP_NULLPTR )
+    {
+        GP_FREE( _canvas, index->items );
+    }
+
+    if( index->nodes != GP_NULLPTR )
+    {
+        GP_FREE( _canvas, index->nodes );
+    }
+
+    gp_spatial_index_reset( index );
+}
+//////////////////////////////////////////////////////////////////////////
+static inline float __absf( float _value )
+{
+    return _value < 0.f ? -_value : _value;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline float __minf( float _a, float _b )
+{
+    return _a < _b ? _a : _b;
+}
+//////////////////////////////////////////////////////////////////////////
+static inline float __maxf( float _a, float _b )
+{
+    return _a > _b ? _a : _b;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __box_reset( gp_box_t * _box, float _x, float _y )
+{
+    _box->min_x = _x;
+    _box->min_y = _y;
+    _box->max_x = _x;
+    _box->max_y = _y;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __box_add_point( gp_box_t * _box, float _x, float _y )
+{
+    _box->min_x = __minf( _box->min_x, _x );
+    _box->min_y = __minf( _box->min_y, _y );
+    _box->max_x = __maxf( _box->max_x, _x );
+    _box->max_y = __maxf( _box->max_y, _y );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __box_add_box( gp_box_t * _box, const gp_box_t * _other )
+{
+    _box->min_x = __minf( _box->min_x, _other->min_x );
+    _box->min_y = __minf( _box->min_y, _other->min_y );
+    _box->max_x = __maxf( _box->max_x, _other->max_x );
+    _box->max_y = __maxf( _box->max_y, _other->max_y );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __box_expand( gp_box_t * _box, float _value )
+{
+    _box->min_x -= _value;
+    _box->min_y -= _value;
+    _box->max_x += _value;
+    _box->max_y += _value;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __box_overlap( const gp_box_t * _a, const gp_box_t * _b )
+{
+    if( _a->max_x < _b->min_x || _a->min_x > _b->max_x )
+    {
+        return GP_FALSE;
+    }
+
+    if( _a->max_y < _b->min_y || _a->min_y > _b->max_y )
+    {
+        return GP_FALSE;
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static float __line_radius( const gp_line_t * _line )
+{
+    const gp_state_t * state = _line->state;
+
+    float radius = state->thickness * 0.5f + state->outline_width;
+
+    return radius;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __line_box( const gp_line_t * _line, gp_box_t * _box )
+{
+    const gp_line_point_t * p0 = _line->points;
+
+    __box_reset( _box, p0->p.x, p0->p.y );
+
+    for( const gp_line_point_t * p = p0->next; p != GP_NULLPTR; p = p->next )
+    {
+        __box_add_point( _box, p->p.x, p->p.y );
+    }
+
+    for( const gp_line_edge_t * e = _line->edges; e != GP_NULLPTR; e = e->next )
+    {
+        for( gp_uint32_t index = 0; index != e->controls; ++index )
+        {
+            __box_add_point( _box, e->p[index].x, e->p[index].y );
+        }
+    }
+
+    const gp_state_t * state = _line->state;
+
+    float radius = __line_radius( _line );
+
+    if( state->line_join == GP_LINE_JOIN_MITER && state->miter_limit > 1.f )
+    {
+        radius *= state->miter_limit;
+    }
+
+    __box_expand( _box, radius );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __rect_box( const gp_rect_t * _rect, gp_box_t * _box )
+{
+    __box_reset( _box, _rect->point.x, _rect->point.y );
+    __box_add_point( _box, _rect->point.x + _rect->width, _rect->point.y + _rect->height );
+
+    float half_thickness = _rect->state->thickness * 0.5f;
+
+    __box_expand( _box, half_thickness );
+}
+//////////////////////////////////////////////////////////////////////////
+static float __rounded_rect_extent( const gp_rounded_rect_t * _rounded_rect )
+{
+    const gp_state_t * state = _rounded_rect->state;
+
+    float extent = state->thickness * 0.5f;
+
+    if( gp_corner_has_outline( state, GP_TRUE ) == GP_TRUE )
+    {
+        extent += state->outline_width;
+    }
+
+    return extent;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __rounded_rect_box( const gp_rounded_rect_t * _rounded_rect, gp_box_t * _box )
+{
+    __box_reset( _box, _rounded_rect->point.x, _rounded_rect->point.y );
+    __box_add_point( _box, _rounded_rect->point.x + _rounded_rect->width, _rounded_rect->point.y + _rounded_rect->height );
+
+    float extent = __rounded_rect_extent( _rounded_rect );
+
+    __box_expand( _box, extent );
+}
+//////////////////////////////////////////////////////////////////////////
+static void __ellipse_box( const gp_ellipse_t * _ellipse, gp_box_t * _box )
+{
+    float half_thickness = _ellipse->state->thickness * 0.5f;
+
+    float rx = __absf( _ellipse->radius_width ) + half_thickness;
+    float ry = __absf( _ellipse->radius_height ) + half_thickness;
+
+    _box->min_x = _ellipse->point.x - rx;
+    _box->min_y = _ellipse->point.y - ry;
+    _box->max_x = _ellipse->point.x + rx;
+    _box->max_y = _ellipse->point.y + ry;
+}
+//////////////////////////////////////////////////////////////////////////
+static float __segment_distance_sq( gp_vec2f_t _p, gp_vec2f_t _a, gp_vec2f_t _b )
+{
+    float abx = _b.x - _a.x;
+    float aby = _b.y - _a.y;
+    float apx = _p.x - _a.x;
+    float apy = _p.y - _a.y;
+
+    float ab2 = abx * abx + aby * aby;
+
+    float t = 0.f;
+
+    if( ab2 > 0.f )
+    {
+        t = (apx * abx + apy * aby) / ab2;
+        t = __maxf( 0.f, __minf( 1.f, t ) );
+    }
+
+    float dx = apx - abx * t;
+    float dy = apy - aby * t;
+
+    return dx * dx + dy * dy;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_vec2f_t __bezier_position( gp_vec2f_t _p0, gp_vec2f_t _p1, const gp_line_edge_t * _edge, float _t )
+{
+    float t = _t;
+    float it = 1.f - _t;
+
+    gp_vec2f_t p;
+
+    if( _edge->controls == 1 )
+    {
+        float a = it * it;
+        float b = 2.f * it * t;
+        float c = t * t;
+
+        p.x = a * _p0.x + b * _edge->p[0].x + c * _p1.x;
+        p.y = a * _p0.y + b * _edge->p[0].y + c * _p1.y;
+
+        return p;
+    }
+
+    float a = it * it * it;
+    float b = 3.f * it * it * t;
+    float c = 3.f * it * t * t;
+    float d = t * t * t;
+
+    p.x = a * _p0.x + b * _edge->p[0].x + c * _edge->p[1].x + d * _p1.x;
+    p.y = a * _p0.y + b * _edge->p[0].y + c * _edge->p[1].y + d * _p1.y;
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __line_hit( const gp_line_t * _line, float _x, float _y )
+{
+    float radius = __line_radius( _line );
+    float radius_sq = radius * radius;
+
+    gp_vec2f_t p = {_x, _y};
+
+    const gp_line_point_t * p0 = _line->points;
+
+    for( const gp_line_edge_t * e = _line->edges; e != GP_NULLPTR; e = e->next, p0 = p0->next )
+    {
+        const gp_line_point_t * p1 = p0->next;
+
+        if( e->controls == 0 )
+        {
+            if( __segment_distance_sq( p, p0->p, p1->p ) <= radius_sq )
+            {
+                return GP_TRUE;
+            }
+
+            continue;
+        }
+
+        gp_uint8_t curve_quality = p0->state->curve_quality;
+        float curve_quality_inv = p0->state->curve_quality_inv;
+
+        gp_vec2f_t a = p0->p;
+
+        for( gp_uint8_t index = 1; index <= curve_quality; ++index )
+        {
+            gp_vec2f_t b = index == curve_quality ? p1->p : __bezier_position( p0->p, p1->p, e, curve_quality_inv * index );
+
+            if( __segment_distance_sq( p, a, b ) <= radius_sq )
+            {
+                return GP_TRUE;
+            }
+
+            a = b;
+        }
+    }
+
+    return GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __rect_hit( const gp_rect_t * _rect, float _x, float _y )
+{
+    const gp_state_t * state = _rect->state;
+
+    float half_thickness = state->thickness * 0.5f;
+
+    float half_width = __absf( _rect->width ) * 0.5f;
+    float half_height = __absf( _rect->height ) * 0.5f;
+
+    float dx = __absf( _x - (_rect->point.x + _rect->width * 0.5f) );
+    float dy = __absf( _y - (_rect->point.y + _rect->height * 0.5f) );
+
+    if( dx > half_width + half_thickness || dy > half_height + half_thickness )
+    {
+        return GP_FALSE;
+    }
+
+    if( state->fill == GP_TRUE )
+    {
+        return GP_TRUE;
+    }
+
+    if( dx < half_width - half_thickness && dy < half_height - half_thickness )
+    {
+        return GP_FALSE;
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __rounded_rect_hit( const gp_rounded_rect_t * _rounded_rect, float _x, float _y )
+{
+    const gp_state_t * state = _rounded_rect->state;
+
+    float half_width = __absf( _rounded_rect->width ) * 0.5f;
+    float half_height = __absf( _rounded_rect->height ) * 0.5f;
+    float sx = _x - (_rounded_rect->point.x + _rounded_rect->width * 0.5f);
+    float sy = _y - (_rounded_rect->point.y + _rounded_rect->height * 0.5f);
+
+    gp_uint32_t corner = sy < 0.f ? (sx < 0.f ? 0 : 1) : (sx < 0.f ? 3 : 2);
+
+    float radius = _rounded_rect->radius[corner];
+
+    float dx = __absf( sx );
+    float dy = __absf( sy );
+
+    float qx = dx - half_width + radius;
+    float qy = dy - half_height + radius;
+
+    float ox = __maxf( qx, 0.f );
+    float oy = __maxf( qy, 0.f );
+
+    float distance = GP_MATH_SQRTF( ox * ox + oy * oy ) + __minf( __maxf( qx, qy ), 0.f ) - radius;
+
+    float extent = __rounded_rect_extent( _rounded_rect );
+
+    if( state->fill == GP_TRUE )
+    {
+        return distance <= extent;
+    }
+
+    return __absf( distance ) <= extent;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __ellipse_hit( const gp_ellipse_t * _ellipse, float _x, float _y )
+{
+    const gp_state_t * state = _ellipse->state;
+
+    float half_thickness = state->thickness * 0.5f;
+
+    float dx = _x - _ellipse->point.x;
+    float dy = _y - _ellipse->point.y;
+
+    float radius_width = __absf( _ellipse->radius_width );
+    float radius_height = __absf( _ellipse->radius_height );
+
+    float ox = dx / (radius_width + half_thickness);
+    float oy = dy / (radius_height + half_thickness);
+
+    if( ox * ox + oy * oy > 1.f )
+    {
+        return GP_FALSE;
+    }
+
+    if( state->fill == GP_TRUE )
+    {
+        return GP_TRUE;
+    }
+
+    float inner_width = radius_width - half_thickness;
+    float inner_height = radius_height - half_thickness;
+
+    if( inner_width <= 0.f || inner_height <= 0.f )
+    {
+        return GP_TRUE;
+    }
+
+    float ix = dx / inner_width;
+    float iy = dy / inner_height;
+
+    return ix * ix + iy * iy >= 1.f;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_bool_t gp_spatial_shape_box( gp_shape_type_e _type, const void * _primitive, gp_box_t * _box )
+{
+    switch( _type )
+    {
+    case GP_SHAPE_TYPE_LINE:
+        {
+            const gp_line_t * l = (const gp_line_t *)_primitive;
+
+            if( l->edges == GP_NULLPTR )
+            {
+                return GP_FALSE;
+            }
+
+            __line_box( l, _box );
+        }break;
+    case GP_SHAPE_TYPE_RECT:
+        {
+            __rect_box( (const gp_rect_t *)_primitive, _box );
+        }break;
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        {
+            __rounded_rect_box( (const gp_rounded_rect_t *)_primitive, _box );
+        }break;
+    case GP_SHAPE_TYPE_ELLIPSE:
+        {
+            __ellipse_box( (const gp_ellipse_t *)_primitive, _box );
+        }break;
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __item_setup( gp_spatial_item_t * _item, gp_shape_type_e _type, gp_uint32_t _index, const void * _primitive )
+{
+    _item->shape.type = _type;
+    _item->shape.index = _index;
+    _item->primitive = _primitive;
+
+    gp_bool_t visible = gp_spatial_shape_box( _type, _primitive, &_item->box );
+
+    return visible;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __item_hit( const gp_spatial_item_t * _item, float _x, float _y )
+{
+    switch( _item->shape.type )
+    {
+    case GP_SHAPE_TYPE_LINE:
+        return __line_hit( (const gp_line_t *)_item->primitive, _x, _y );
+    case GP_SHAPE_TYPE_RECT:
+        return __rect_hit( (const gp_rect_t *)_item->primitive, _x, _y );
+    case GP_SHAPE_TYPE_ROUNDED_RECT:
+        return __rounded_rect_hit( (const gp_rounded_rect_t *)_item->primitive, _x, _y );
+    case GP_SHAPE_TYPE_ELLIPSE:
+        return __ellipse_hit( (const gp_ellipse_t *)_item->primitive, _x, _y );
+    default:
+        return GP_FALSE;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static float __item_center( const gp_spatial_item_t * _item, gp_uint32_t _axis )
+{
+    if( _axis == 0 )
+    {
+        return _item->box.min_x + _item->box.max_x;
+    }
+
+    return _item->box.min_y + _item->box.max_y;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __spatial_select( gp_spatial_item_t * _items, gp_uint32_t _count, gp_uint32_t _nth, gp_uint32_t _axis )
+{
+    gp_uint32_t lo = 0;
+    gp_uint32_t hi = _count - 1;
+
+    while( lo < hi )
+    {
+        float pivot = __item_center( _items + lo + (hi - lo) / 2, _axis );
+
+        gp_uint32_t i = lo - 1;
+        gp_uint32_t j = hi + 1;
+
+        for( ;; )
+        {
+            do
+            {
+                ++i;
+            } while( __item_center( _items + i, _axis ) < pivot );
+
+            do
+            {
+                --j;
+            } while( __item_center( _items + j, _axis ) > pivot );
+
+            if( i >= j )
+            {
+                break;
+            }
+
+            gp_spatial_item_t tmp = _items[i];
+            _items[i] = _items[j];
+            _items[j] = tmp;
+        }
+
+        if( _nth <= j )
+        {
+            hi = j;
+        }
+        else
+        {
+            lo = j + 1;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __spatial_build_node( gp_spatial_index_t * _index, gp_uint32_t _node, gp_uint32_t _first, gp_uint32_t _count )
+{
+    gp_spatial_node_t * node = _index->nodes + _node;
+
+    const gp_spatial_item_t * items = _index->items + _first;
+
+    node->box = items[0].box;
+
+    float center_x = items[0].box.min_x + items[0].box.max_x;
+    float center_y = items[0].box.min_y + items[0].box.max_y;
+
+    gp_box_t centers;
+    __box_reset( &centers, center_x, center_y );
+
+    for( gp_uint32_t index = 1; index != _count; ++index )
+    {
+        const gp_spatial_item_t * item = items + index;
+
+        __box_add_box( &node->box, &item->box );
+        __box_add_point( &centers, item->box.min_x + item->box.max_x, item->box.min_y + item->box.max_y );
+    }
+
+    node->first = _first;
+
+    if( _count <= GP_SPATIAL_LEAF_SIZE )
+    {
+        node->count = _count;
+        node->right = 0;
+
+        return;
+    }
+
+    gp_uint32_t axis = (centers.max_x - centers.min_x) >= (centers.max_y - centers.min_y) ? 0 : 1;
+
+    gp_uint32_t half = _count / 2;
+
+    __spatial_select( _index->items + _first, _count, half, axis );
+
+    node->count = 0;
+
+    gp_uint32_t left = _index->node_count++;
+    __spatial_build_node( _index, left, _first, half );
+
+    gp_uint32_t right = _index->node_count++;
+    node->right = right;
+    __spatial_build_node( _index, right, _first + half, _count - half );
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_build_index( gp_canvas_t * _canvas )
+{
+    gp_spatial_index_free( _canvas );
+
+    gp_spatial_index_t * index = &_canvas->index;
+
+    gp_uint32_t capacity = 0;
+
+    GP_LIST_FOREACH( gp_line_t, _canvas->lines, l )
+    {
+        ++capacity;
+    }
+
+    GP_LIST_FOREACH( gp_rect_t, _canvas->rects, r )
+    {
+        ++capacity;
+    }
+
+    GP_LIST_FOREACH( gp_rounded_rect_t, _canvas->rounded_rects, rr )
+    {
+        ++capacity;
+    }
+
+    GP_LIST_FOREACH( gp_ellipse_t, _canvas->ellipses, e )
+    {
+        ++capacity;
+    }
+
+    if( capacity == 0 )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    index->items = (gp_spatial_item_t *)(*_canvas->malloc)(sizeof( gp_spatial_item_t ) * capacity, _canvas->ud);
+
+    gp_spatial_item_t * items = index->items;
+    gp_uint32_t item_count = 0;
+
+    if( _canvas->lines != GP_NULLPTR )
+    {
+        const gp_line_t * line_back = GP_LIST_BACK( _canvas->lines );
+
+        for( const gp_line_t * l = _canvas->lines; l != line_back; l = l->next )
+        {
+            if( __item_setup( items + item_count, GP_SHAPE_TYPE_LINE, index->line_count, l ) == GP_TRUE )
+            {
+                ++item_count;
+            }
+
+            index->line_last = l;
+            ++index->line_count;
+        }
+    }
+
+    GP_LIST_FOREACH( gp_rect_t, _canvas->rects, r )
+    {
+        __item_setup( items + item_count++, GP_SHAPE_TYPE_RECT, index->rect_count, r );
+
+        index->rect_last = r;
+        ++index->rect_count;
+    }
+
+    GP_LIST_FOREACH( gp_rounded_rect_t, _canvas->rounded_rects, rr )
+    {
+        __item_setup( items + item_count++, GP_SHAPE_TYPE_ROUNDED_RECT, index->rounded_rect_count, rr );
+
+        index->rounded_rect_last = rr;
+        ++index->rounded_rect_count;
+    }
+
+    GP_LIST_FOREACH( gp_ellipse_t, _canvas->ellipses, e )
+    {
+        __item_setup( items + item_count++, GP_SHAPE_TYPE_ELLIPSE, index->ellipse_count, e );
+
+        index->ellipse_last = e;
+        ++index->ellipse_count;
+    }
+
+    index->item_count = item_count;
+
+    if( item_count == 0 )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    index->nodes = (gp_spatial_node_t *)(*_canvas->malloc)(sizeof( gp_spatial_node_t ) * item_count * 2, _canvas->ud);
+    index->node_count = 1;
+
+    __spatial_build_node( index, 0, 0, item_count );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __spatial_visit_tail( gp_shape_type_e _type, const void * _primitive, gp_uint32_t _index, const gp_box_t * _box, gp_spatial_visit_t _visit, void * _ud )
+{
+    gp_spatial_item_t item;
+
+    if( __item_setup( &item, _type, _index, _primitive ) == GP_FALSE )
+    {
+        return;
+    }
+
+    if( __box_overlap( &item.box, _box ) == GP_FALSE )
+    {
+        return;
+    }
+
+    (*_visit)(&item, _ud);
+}
+//////////////////////////////////////////////////////////////////////////
+static void __spatial_visit( const gp_canvas_t * _canvas, const gp_box_t * _box, gp_spatial_visit_t _visit, void * _ud )
+{
+    const gp_spatial_index_t * index = &_canvas->index;
+
+    if( index->node_count != 0 )
+    {
+        gp_uint32_t stack[GP_SPATIAL_STACK_MAX];
+        gp_uint32_t stack_size = 0;
+
+        stack[stack_size++] = 0;
+
+        while( stack_size != 0 )
+        {
+            const gp_spatial_node_t * node = index->nodes + stack[--stack_size];
+
+            if( __box_overlap( &node->box, _box ) == GP_FALSE )
+            {
+                continue;
+            }
+
+            if( node->count == 0 )
+            {
+                stack[stack_size++] = node->right;
+                stack[stack_size++] = (gp_uint32_t)(node - index->nodes) + 1;
+
+                continue;
+            }
+
+            for( gp_uint32_t i = 0; i != node->count; ++i )
+            {
+                const gp_spatial_item_t * item = index->items + node->first + i;
+
+                if( __box_overlap( &item->box, _box ) == GP_FALSE )
+                {
+                    continue;
+                }
+
+                (*_visit)(item, _ud);
+            }
+        }
+    }
+
+    gp_uint32_t line_index = index->line_count;
+
+    for( const gp_line_t * l = index->line_last == GP_NULLPTR ? _canvas->lines : index->line_last->next; l != GP_NULLPTR; l = l->next )
+    {
+        __spatial_visit_tail( GP_SHAPE_TYPE_LINE, l, line_index++, _box, _visit, _ud );
+    }
+
+    gp_uint32_t rect_index = index->rect_count;
+
+    for( const gp_rect_t * r = index->rect_last == GP_NULLPTR ? _canvas->rects : index->rect_last->next; r != GP_NULLPTR; r = r->next )
+    {
+        __spatial_visit_tail( GP_SHAPE_TYPE_RECT, r, rect_index++, _box, _visit, _ud );
+    }
+
+    gp_uint32_t rounded_rect_index = index->rounded_rect_count;
+
+    for( const gp_rounded_rect_t * rr = index->rounded_rect_last == GP_NULLPTR ? _canvas->rounded_rects : index->rounded_rect_last->next; rr != GP_NULLPTR; rr = rr->next )
+    {
+        __spatial_visit_tail( GP_SHAPE_TYPE_ROUNDED_RECT, rr, rounded_rect_index++, _box, _visit, _ud );
+    }
+
+    gp_uint32_t ellipse_index = index->ellipse_count;
+
+    for( const gp_ellipse_t * e = index->ellipse_last == GP_NULLPTR ? _canvas->ellipses : index->ellipse_last->next; e != GP_NULLPTR; e = e->next )
+    {
+        __spatial_visit_tail( GP_SHAPE_TYPE_ELLIPSE, e, ellipse_index++, _box, _visit, _ud );
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __shape_above( const gp_shape_t * _a, const gp_shape_t * _b )
+{
+    if( _a->type != _b->type )
+    {
+        return _a->type > _b->type;
+    }
+
+    return _a->index > _b->index;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __spatial_pick_visit( const gp_spatial_item_t * _item, void * _ud )
+{
+    gp_spatial_pick_t * pick = (gp_spatial_pick_t *)_ud;
+
+    if( pick->found == GP_TRUE && __shape_above( &_item->shape, &pick->shape ) == GP_FALSE )
+    {
+        return;
+    }
+
+    if( __item_hit( _item, pick->x, pick->y ) == GP_FALSE )
+    {
+        return;
+    }
+
+    pick->shape = _item->shape;
+    pick->found = GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_pick( const gp_canvas_t * _canvas, float _x, float _y, gp_shape_t * _shape, gp_bool_t * _found )
+{
+    gp_spatial_pick_t pick;
+    pick.x = _x;
+    pick.y = _y;
+    pick.shape.type = GP_SHAPE_TYPE_LINE;
+    pick.shape.index = 0;
+    pick.found = GP_FALSE;
+
+    gp_box_t box;
+    __box_reset( &box, _x, _y );
+
+    __spatial_visit( _canvas, &box, &__spatial_pick_visit, &pick );
+
+    *_shape = pick.shape;
+    *_found = pick.found;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __spatial_query_visit( const gp_spatial_item_t * _item, void * _ud )
+{
+    gp_spatial_query_t * query = (gp_spatial_query_t *)_ud;
+
+    if( query->count < query->capacity )
+    {
+        query->shapes[query->count] = _item->shape;
+    }
+
+    ++query->count;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_canvas_query_rect( const gp_canvas_t * _canvas, float _x, float _y, float _width, float _height, gp_shape_t * _shapes, gp_uint32_t _capacity, gp_uint32_t * _count )
+{
+    gp_spatial_query_t query;
+    query.shapes = _shapes;
+    query.capacity = _capacity;
+    query.count = 0;
+
+    gp_box_t box;
+    __box_reset( &box, _x, _y );
+    __box_add_point( &box, _x + _width, _y + _height );
+
+    __spatial_visit( _canvas, &box, &__spatial_query_visit, &query );
+
+    *_count = query.count;
+
+    return GP_SUCCESSFUL;
+}
@@ -0,0 +1,13 @@
+#ifndef GP_SPATIAL_H_
+#define GP_SPATIAL_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+void gp_spatial_index_reset( gp_spatial_index_t * _index );
+void gp_spatial_index_free( gp_canvas_t * _canvas );
+
+gp_bool_t gp_spatial_shape_box( gp_shape_type_e _type, const void * _primitive, gp_box_t * _box );
+
+#endif
@@ -0,0 +1,270 @@
+#include "split.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "validate.h"
+#include "size.h"
+
+//////////////////////////////////////////////////////////////////////////
+static void __depth_fill( const gp_mesh_t * _mesh, gp_uint32_t _begin, gp_uint32_t _end, float _depth )
+{
+    gp_uint8_t * depth = (gp_uint8_t *)_mesh->depth_buffer + _mesh->depth_offset + _mesh->depth_stride * _begin;
+
+    for( gp_uint32_t index = _begin; index != _end; ++index, depth += _mesh->depth_stride )
+    {
+        *(float *)depth = _depth;
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static void __depth_primitive( const gp_mesh_t * _mesh, gp_shape_type_e _type, const void * _primitive, gp_uint32_t * _vertex_iterator, gp_uint32_t * _depth_iterator, float _depth_step )
+{
+    gp_uint32_t vertex_begin = *_vertex_iterator;
+    gp_uint32_t vertex_end = vertex_begin;
+    gp_uint32_t index_count = 0;
+
+    gp_calculate_primitive_size( _type, _primitive, &vertex_end, &index_count );
+
+    if( vertex_end == vertex_begin )
+    {
+        return;
+    }
+
+    gp_uint32_t depth_iterator = *_depth_iterator;
+
+    __depth_fill( _mesh, vertex_begin, vertex_end, (float)depth_iterator * _depth_step );
+
+    *_vertex_iterator = vertex_end;
+    *_depth_iterator = depth_iterator - 1;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_render_depth( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh )
+{
+    if( _mesh->depth_buffer == GP_NULLPTR )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    gp_uint32_t primitive_count = 0;
+
+    GP_LIST_FOREACH( const gp_line_t, _canvas->lines, l )
+    {
+        ++primitive_count;
+    }
+
+    GP_LIST_FOREACH( const gp_rect_t, _canvas->rects, r )
+    {
+        ++primitive_count;
+    }
+
+    GP_LIST_FOREACH( const gp_rounded_rect_t, _canvas->rounded_rects, rr )
+    {
+        ++primitive_count;
+    }
+
+    GP_LIST_FOREACH( const gp_ellipse_t, _canvas->ellipses, e )
+    {
+        ++primitive_count;
+    }
+
+    float depth_step = 1.f / (float)(primitive_count + 1);
+
+    gp_uint32_t vertex_iterator = 0;
+    gp_uint32_t depth_iterator = primitive_count;
+
+    GP_LIST_FOREACH( const gp_line_t, _canvas->lines, l )
+    {
+        __depth_primitive( _mesh, GP_SHAPE_TYPE_LINE, l, &vertex_iterator, &depth_iterator, depth_step );
+    }
+
+    GP_LIST_FOREACH( const gp_rect_t, _canvas->rects, r )
+    {
+        __depth_primitive( _mesh, GP_SHAPE_TYPE_RECT, r, &vertex_iterator, &depth_iterator, depth_step );
+    }
+
+    GP_LIST_FOREACH( const gp_rounded_rect_t, _canvas->rounded_rects, rr )
+    {
+        __depth_primitive( _mesh, GP_SHAPE_TYPE_ROUNDED_RECT, rr, &vertex_iterator, &depth_iterator, depth_step );
+    }
+
+    GP_LIST_FOREACH( const gp_ellipse_t, _canvas->ellipses, e )
+    {
+        __depth_primitive( _mesh, GP_SHAPE_TYPE_ELLIPSE, e, &vertex_iterator, &depth_iterator, depth_step );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint16_t __get_index( const gp_mesh_t * _mesh, gp_uint32_t _iterator )
+{
+    gp_uint16_t index = *(const gp_uint16_t *)((const gp_uint8_t *)_mesh->indices_buffer + _mesh->indices_offset + _mesh->indices_stride * _iterator);
+
+    return index;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __vertex_opaque( const gp_mesh_t * _mesh, gp_uint16_t _vertex )
+{
+    gp_argb_t c = *(const gp_argb_t *)((const gp_uint8_t *)_mesh->colors_buffer + _mesh->colors_offset + _mesh->colors_stride * _vertex);
+
+    gp_uint32_t alpha = gp_mesh_color_alpha( _mesh, c );
+
+    if( alpha != 0xff )
+    {
+        return GP_FALSE;
+    }
+
+    if( _mesh->sdf_buffer != GP_NULLPTR )
+    {
+        const gp_sdf_t * sdf = (const gp_sdf_t *)((const gp_uint8_t *)_mesh->sdf_buffer + _mesh->sdf_offset + _mesh->sdf_stride * _vertex);
+
+        if( sdf->type != GP_SDF_TYPE_NONE )
+        {
+            return GP_FALSE;
+        }
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __triangle_opaque( const gp_mesh_t * _mesh, gp_uint32_t _iterator )
+{
+    for( gp_uint32_t index = 0; index != 3; ++index )
+    {
+        gp_uint16_t vertex = __get_index( _mesh, _iterator + index );
+
+        if( __vertex_opaque( _mesh, vertex ) == GP_FALSE )
+        {
+            return GP_FALSE;
+        }
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t __split_block( const gp_mesh_t * _mesh, const gp_uint8_t * _opaque, gp_uint32_t _first, gp_uint32_t _count, gp_uint16_t * _indices )
+{
+    gp_uint32_t opaque_count = 0;
+
+    for( gp_uint32_t iterator = _first; iterator != _first + _count; iterator += 3 )
+    {
+        if( _opaque[iterator / 3] == GP_TRUE )
+        {
+            opaque_count += 3;
+        }
+    }
+
+    gp_uint32_t opaque_iterator = _first + opaque_count;
+    gp_uint32_t blend_iterator = _first + opaque_count;
+
+    for( gp_uint32_t iterator = _first; iterator != _first + _count; iterator += 3 )
+    {
+        gp_uint16_t * triangle;
+
+        if( _opaque[iterator / 3] == GP_TRUE )
+        {
+            opaque_iterator -= 3;
+
+            triangle = _indices + opaque_iterator;
+        }
+        else
+        {
+            triangle = _indices + blend_iterator;
+
+            blend_iterator += 3;
+        }
+
+        triangle[0] = __get_index( _mesh, iterator + 0 );
+        triangle[1] = __get_index( _mesh, iterator + 1 );
+        triangle[2] = __get_index( _mesh, iterator + 2 );
+    }
+
+    return opaque_count;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_render_split( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh, gp_uint16_t * _opaque_index_count )
+{
+#if defined(GP_VALIDATION)
+    if( _mesh->indices_buffer == GP_NULLPTR || _mesh->colors_buffer == GP_NULLPTR )
+    {
+        gp_validation_report( _canvas, "gp_render_split: mesh requires indices and colors buffers" );
+
+        return GP_FAILURE;
+    }
+#endif
+
+    gp_uint32_t range_count = _mesh->range_count;
+
+    gp_mesh_t mesh = *_mesh;
+
+    if( _mesh->ranges_buffer == GP_NULLPTR )
+    {
+        mesh.ranges_buffer = (gp_draw_range_t *)(*_canvas->malloc)(sizeof( gp_draw_range_t ) * (range_count + 1), _canvas->ud);
+    }
+
+    gp_result_t result = gp_render( _canvas, &mesh );
+
+    gp_uint32_t index_count = _mesh->index_count;
+
+    if( result == GP_FAILURE || index_count == 0 )
+    {
+        if( _mesh->ranges_buffer == GP_NULLPTR )
+        {
+            GP_FREE( _canvas, mesh.ranges_buffer );
+        }
+
+        *_opaque_index_count = 0;
+
+        return result;
+    }
+
+    gp_uint32_t triangle_count = index_count / 3;
+
+    gp_uint8_t * opaque = (gp_uint8_t *)(*_canvas->malloc)(sizeof( gp_uint8_t ) * triangle_count, _canvas->ud);
+
+    for( gp_uint32_t index = 0; index != range_count; ++index )
+    {
+        const gp_draw_range_t * range = mesh.ranges_buffer + index;
+
+        for( gp_uint32_t iterator = range->first; iterator != (gp_uint32_t)range->first + range->count; iterator += 3 )
+        {
+            gp_bool_t triangle_opaque = range->blend == GP_FALSE ? GP_TRUE : __triangle_opaque( _mesh, iterator );
+
+            opaque[iterator / 3] = (gp_uint8_t)triangle_opaque;
+        }
+    }
+
+    gp_uint16_t * indices = (gp_uint16_t *)(*_canvas->malloc)(sizeof( gp_uint16_t ) * index_count, _canvas->ud);
+
+    gp_uint32_t opaque_count = 0;
+
+    if( _mesh->ranges_buffer == GP_NULLPTR )
+    {
+        GP_FREE( _canvas, mesh.ranges_buffer );
+
+        opaque_count = __split_block( _mesh, opaque, 0, index_count, indices );
+    }
+    else
+    {
+        for( gp_uint32_t index = 0; index != range_count; ++index )
+        {
+            gp_draw_range_t * range = _mesh->ranges_buffer + index;
+
+            gp_uint32_t range_opaque_count = __split_block( _mesh, opaque, range->first, range->count, indices );
+
+            range->opaque_count = (gp_uint16_t)range_opaque_count;
+
+            opaque_count += range_opaque_count;
+        }
+    }
+
+    for( gp_uint32_t iterator = 0; iterator != index_count; ++iterator )
+    {
+        gp_mesh_push_index( _mesh, (gp_uint16_t)iterator, indices[iterator] );
+    }
+
+    GP_FREE( _canvas, indices );
+    GP_FREE( _canvas, opaque );
+
+    *_opaque_index_count = (gp_uint16_t)opaque_count;
+
+    return GP_SUCCESSFUL;
+}
@@ -0,0 +1,10 @@
+#ifndef GP_SPLIT_H_
+#define GP_SPLIT_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+gp_result_t gp_render_depth( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh );
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef GP_STRUCT_H_
 #define GP_STRUCT_H_
 
-#include "graphics/config.h"
+#include "graphics/graphics.h"
 
 //////////////////////////////////////////////////////////////////////////
 typedef struct gp_vec2f_t
@@ -10,29 +10,52 @@ typedef struct gp_vec2f_t
     float y;
 } gp_vec2f_t;
 //////////////////////////////////////////////////////////////////////////
-typedef struct gp_linef_t
+typedef struct gp_gradient_stop_t
 {
-    float a;
-    float b;
-    float c;
-} gp_linef_t;
+    float offset;
+    gp_color_t color;
+} gp_gradient_stop_t;
 //////////////////////////////////////////////////////////////////////////
 typedef struct gp_state_t
 {
     gp_bool_t fill;
+    gp_bool_t sdf;
 
     float thickness;
     float outline_width;
     float penumbra;
 
+    gp_line_join_e line_join;
+    float miter_limit;
+
+    float dash_pattern[GP_DASH_PATTERN_MAX];
+    gp_uint32_t dash_count;
+    float dash_offset;
+
     gp_color_t color;
     gp_color_t outline_color;
+    gp_argb_t argb;
+    gp_argb_t outline_argb;
+
+    gp_gradient_e gradient;
+    float gradient_x0;
+    float gradient_y0;
+    float gradient_x1;
+    float gradient_y1;
+    float gradient_radius;
+    gp_gradient_stop_t gradient_stops[GP_GRADIENT_STOP_MAX];
+    gp_uint32_t gradient_stop_count;
+
+    gp_uint64_t hash;
 
     float uv_ou;
     float uv_ov;
     float uv_su;
     float uv_sv;
 
+    gp_uint32_t material;
+    gp_bool_t blend;
+
     gp_uint8_t curve_quality;
     gp_uint8_t ellipse_quality;
     gp_uint8_t rect_quality;
@@ -71,6 +94,20 @@ typedef struct gp_line_edge_t
     struct gp_line_edge_t * prev;
 } gp_line_edge_t;
 //////////////////////////////////////////////////////////////////////////
+typedef struct gp_line_joints_t
+{
+    const gp_line_point_t * point;
+    const gp_line_edge_t * edge;
+    gp_uint8_t step;
+    float t;
+
+    gp_vec2f_t p0;
+    gp_vec2f_t p1;
+
+    gp_uint32_t point_count;
+    gp_uint32_t section_count;
+} gp_line_joints_t;
+//////////////////////////////////////////////////////////////////////////
 typedef struct gp_line_t
 {
     gp_line_point_t * points;
@@ -78,6 +115,8 @@ typedef struct gp_line_t
 
     const gp_state_t * state;
 
+    gp_line_joints_t joints;
+
     struct gp_line_t * next;
     struct gp_line_t * prev;
 } gp_line_t;
@@ -90,6 +129,8 @@ typedef struct gp_rect_t
 
     const gp_state_t * state;
 
+    gp_uint32_t handle;
+
     struct gp_rect_t * next;
     struct gp_rect_t * prev;
 } gp_rect_t;
@@ -99,10 +140,12 @@ typedef struct gp_rounded_rect_t
     gp_vec2f_t point;
     float width;
     float height;
-    float radius;
+    float radius[4];
 
     const gp_state_t * state;
 
+    gp_uint32_t handle;
+
     struct gp_rounded_rect_t * next;
     struct gp_rounded_rect_t * prev;
 } gp_rounded_rect_t;
@@ -112,13 +155,78 @@ typedef struct gp_ellipse_t
     gp_vec2f_t point;
     float radius_width;
     float radius_height;
+    float angle_start;
+    float angle_sweep;
 
     const gp_state_t * state;
 
+    gp_uint32_t handle;
+
     struct gp_ellipse_t * next;
     struct gp_ellipse_t * prev;
 } gp_ellipse_t;
 //////////////////////////////////////////////////////////////////////////
+typedef struct gp_box_t
+{
+    float min_x;
+    float min_y;
+    float max_x;
+    float max_y;
+} gp_box_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_spatial_item_t
+{
+    gp_box_t box;
+    gp_shape_t shape;
+
+    const void * primitive;
+} gp_spatial_item_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_spatial_node_t
+{
+    gp_box_t box;
+
+    gp_uint32_t first;
+    gp_uint32_t count;
+    gp_uint32_t right;
+} gp_spatial_node_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_spatial_index_t
+{
+    gp_spatial_item_t * items;
+    gp_uint32_t item_count;
+
+    gp_spatial_node_t * nodes;
+    gp_uint32_t node_count;
+
+    const gp_line_t * line_last;
+    const gp_rect_t * rect_last;
+    const gp_rounded_rect_t * rounded_rect_last;
+    const gp_ellipse_t * ellipse_last;
+
+    gp_uint32_t line_count;
+    gp_uint32_t rect_count;
+    gp_uint32_t rounded_rect_count;
+    gp_uint32_t ellipse_count;
+} gp_spatial_index_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_frame_item_t
+{
+    gp_box_t box;
+    gp_uint64_t key;
+    gp_uint64_t hash;
+    gp_bool_t visible;
+} gp_frame_item_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_handle_slot_t
+{
+    gp_shape_type_e type;
+    void * primitive;
+    gp_state_t * state;
+    gp_uint32_t generation;
+    gp_uint32_t next_free;
+} gp_handle_slot_t;
+//////////////////////////////////////////////////////////////////////////
 typedef struct gp_canvas_t
 {
     gp_state_t state_cook[GP_STATE_STACK_MAX];
@@ -132,11 +240,90 @@ typedef struct gp_canvas_t
     gp_rounded_rect_t * rounded_rects;
     gp_ellipse_t * ellipses;
 
+    gp_uint64_t hash_lines;
+    gp_uint64_t hash_rects;
+    gp_uint64_t hash_rounded_rects;
+    gp_uint64_t hash_ellipses;
+
+    gp_uint32_t size_vertex_count;
+    gp_uint32_t size_index_count;
+    gp_uint32_t size_range_counts[4];
+    const gp_state_t * size_range_line;
+
+    gp_spatial_index_t index;
+
+    gp_frame_item_t * frame_items;
+    gp_uint32_t frame_counts[4];
+    gp_bool_t frame_identity;
+
+    gp_handle_slot_t * handles;
+    gp_uint32_t handle_count;
+    gp_uint32_t handle_capacity;
+    gp_uint32_t handle_free;
+
+    gp_validation_t validation;
+    void * validation_ud;
+
     gp_malloc_t malloc;
     gp_realloc_t realloc;
     gp_free_t free;
 
     void * ud;
 } gp_canvas_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_raster_edge_t
+{
+    float x;
+    float y;
+    float dx;
+    float dy;
+    gp_bool_t top_left;
+} gp_raster_edge_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_raster_triangle_t
+{
+    gp_raster_edge_t edges[3];
+    float inv_area;
+
+    gp_uint16_t vertices[3];
+
+    gp_int32_t x0;
+    gp_int32_t y0;
+    gp_int32_t x1;
+    gp_int32_t y1;
+} gp_raster_triangle_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_raster_t
+{
+    gp_image_t target;
+    gp_image_t texture;
+    gp_bool_t textured;
+    gp_raster_blend_e blend;
+
+    gp_vec2f_t * positions;
+    gp_color_t * colors;
+    gp_vec2f_t * uvs;
+    gp_uint32_t vertex_capacity;
+
+    gp_raster_triangle_t * triangles;
+    gp_uint32_t triangle_capacity;
+
+    gp_uint32_t tiles_x;
+    gp_uint32_t tiles_y;
+    gp_uint32_t * tile_offsets;
+    gp_uint32_t tile_capacity;
+
+    gp_uint32_t * bins;
+    gp_uint32_t bin_capacity;
+
+    float srgb_to_linear[256];
+    gp_uint8_t linear_to_srgb[4096];
+
+    gp_malloc_t malloc;
+    gp_realloc_t realloc;
+    gp_free_t free;
+
+    void * ud;
+} gp_raster_t;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "validate.h"
+
+#include "struct.h"
+#include "detail.h"
+#include "range.h"
+#include "size.h"
+
+//////////////////////////////////////////////////////////////////////////
+void gp_validation_report( const gp_canvas_t * _canvas, const char * _message )
+{
+    if( _canvas->validation == GP_NULLPTR )
+    {
+        return;
+    }
+
+    (*_canvas->validation)(_message, _canvas->validation_ud);
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __attribute_invalid( const void * _buffer, gp_size_t _offset, gp_size_t _stride )
+{
+    if( _buffer == GP_NULLPTR )
+    {
+        return GP_FALSE;
+    }
+
+    return _offset == GP_MESH_ATTRIBUTE_UNSET || _stride == GP_MESH_ATTRIBUTE_UNSET;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __validate_attributes( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh )
+{
+    if( __attribute_invalid( _mesh->positions_buffer, _mesh->positions_offset, _mesh->positions_stride ) == GP_TRUE )
+    {
+        gp_validation_report( _canvas, "gp_render: positions buffer without offset or stride" );
+
+        return GP_FAILURE;
+    }
+
+    if( _mesh->positions_format != GP_POSITION_FORMAT_FLOAT2 && _mesh->positions_format != GP_POSITION_FORMAT_SHORT2 )
+    {
+        gp_validation_report( _canvas, "gp_render: unknown positions format" );
+
+        return GP_FAILURE;
+    }
+
+    if( _mesh->positions_format == GP_POSITION_FORMAT_SHORT2 && _mesh->positions_scale <= 0.f )
+    {
+        gp_validation_report( _canvas, "gp_render: short2 positions require positive scale" );
+
+        return GP_FAILURE;
+    }
+
+    if( __attribute_invalid( _mesh->colors_buffer, _mesh->colors_offset, _mesh->colors_stride ) == GP_TRUE )
+    {
+        gp_validation_report( _canvas, "gp_render: colors buffer without offset or stride" );
+
+        return GP_FAILURE;
+    }
+
+    if( __attribute_invalid( _mesh->uv_buffer, _mesh->uv_offset, _mesh->uv_stride ) == GP_TRUE )
+    {
+        gp_validation_report( _canvas, "gp_render: uv buffer without offset or stride" );
+
+        return GP_FAILURE;
+    }
+
+    if( _mesh->uv_format != GP_UV_FORMAT_FLOAT2 && _mesh->uv_format != GP_UV_FORMAT_UNORM16 && _mesh->uv_format != GP_UV_FORMAT_HALF2 )
+    {
+        gp_validation_report( _canvas, "gp_render: unknown uv format" );
+
+        return GP_FAILURE;
+    }
+
+    if( __attribute_invalid( _mesh->indices_buffer, _mesh->indices_offset, _mesh->indices_stride ) == GP_TRUE )
+    {
+        gp_validation_report( _canvas, "gp_render: indices buffer without offset or stride" );
+
+        return GP_FAILURE;
+    }
+
+    if( __attribute_invalid( _mesh->sdf_buffer, _mesh->sdf_offset, _mesh->sdf_stride ) == GP_TRUE )
+    {
+        gp_validation_report( _canvas, "gp_render: sdf buffer without offset or stride" );
+
+        return GP_FAILURE;
+    }
+
+    if( __attribute_invalid( _mesh->depth_buffer, _mesh->depth_offset, _mesh->depth_stride ) == GP_TRUE )
+    {
+        gp_validation_report( _canvas, "gp_render: depth buffer without offset or stride" );
+
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __validate_capacity( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh )
+{
+    gp_mesh_t expected;
+
+    if( gp_calculate_mesh_size( _canvas, &expected ) == GP_FAILURE )
+    {
+        gp_validation_report( _canvas, "gp_render: invalid canvas geometry" );
+
+        return GP_FAILURE;
+    }
+
+    if( _mesh->vertex_count != expected.vertex_count )
+    {
+        gp_validation_report( _canvas, "gp_render: vertex count does not match gp_calculate_mesh_size" );
+
+        return GP_FAILURE;
+    }
+
+    if( _mesh->index_count != expected.index_count )
+    {
+        gp_validation_report( _canvas, "gp_render: index count does not match gp_calculate_mesh_size" );
+
+        return GP_FAILURE;
+    }
+
+    gp_uint32_t range_count;
+    GP_CALL( gp_calculate_mesh_range_count, (_canvas, &range_count) );
+
+    if( expected.range_count != range_count )
+    {
+        gp_validation_report( _canvas, "gp_render: running range count drifted from the canvas" );
+
+        return GP_FAILURE;
+    }
+
+    if( _mesh->ranges_buffer != GP_NULLPTR && _mesh->range_count != expected.range_count )
+    {
+        gp_validation_report( _canvas, "gp_render: range count does not match gp_calculate_mesh_size" );
+
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+gp_result_t gp_validate_mesh( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh )
+{
+    GP_CALL( __validate_attributes, (_canvas, _mesh) );
+    GP_CALL( __validate_capacity, (_canvas, _mesh) );
+
+    return GP_SUCCESSFUL;
+}
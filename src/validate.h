@@ -0,0 +1,12 @@
+#ifndef GP_VALIDATE_H_
+#define GP_VALIDATE_H_
+
+#include "graphics/graphics.h"
+
+#include "struct.h"
+
+void gp_validation_report( const gp_canvas_t * _canvas, const char * _message );
+
+gp_result_t gp_validate_mesh( const gp_canvas_t * _canvas, const gp_mesh_t * _mesh );
+
+#endif
@@ -0,0 +1,101 @@
+#define GRAPHICS_IMPLEMENTATION
+#include "graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+static float positions[4096 * 2];
+static gp_uint32_t colors[4096];
+static gp_uint16_t indices[8192];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_amalgamation( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_quadratic_curve_to, (_canvas, 50.f, 50.f, 100.f, 0.f) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 10.f, 50.f, 40.f, 20.f, 5.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 20.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.vertex_count == 0 || mesh.vertex_count > 4096 || mesh.index_count > 8192 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.positions_buffer = positions;
+    mesh.positions_offset = 0;
+    mesh.positions_stride = sizeof( float ) * 2;
+
+    mesh.colors_buffer = colors;
+    mesh.colors_offset = 0;
+    mesh.colors_stride = sizeof( gp_uint32_t );
+
+    mesh.indices_buffer = indices;
+    mesh.indices_offset = 0;
+    mesh.indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    for( gp_uint32_t index = 0; index != mesh.index_count; ++index )
+    {
+        if( indices[index] >= mesh.vertex_count )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_amalgamation( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
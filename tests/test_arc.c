@@ -0,0 +1,231 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <math.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct arc_vertex_t
+{
+    float x;
+    float y;
+    gp_argb_t color;
+} arc_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+#define ARC_SENTINEL (12345.f)
+//////////////////////////////////////////////////////////////////////////
+static arc_vertex_t vertices[1024 + 1];
+static gp_uint16_t indices[4096];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh( const gp_canvas_t * _canvas, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count == 0 || _mesh->vertex_count > 1024 || _mesh->index_count > 4096 )
+    {
+        return GP_FAILURE;
+    }
+
+    vertices[_mesh->vertex_count].x = ARC_SENTINEL;
+
+    _mesh->positions_buffer = vertices;
+    _mesh->positions_offset = offsetof( arc_vertex_t, x );
+    _mesh->positions_stride = sizeof( arc_vertex_t );
+
+    _mesh->colors_buffer = vertices;
+    _mesh->colors_offset = offsetof( arc_vertex_t, color );
+    _mesh->colors_stride = sizeof( arc_vertex_t );
+
+    _mesh->indices_buffer = indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    if( vertices[_mesh->vertex_count].x != ARC_SENTINEL )
+    {
+        return GP_FAILURE;
+    }
+
+    for( gp_uint16_t index = 0; index != _mesh->index_count; ++index )
+    {
+        if( indices[index] >= _mesh->vertex_count )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_arc_variants( gp_canvas_t * _canvas )
+{
+    for( gp_uint32_t variant = 0; variant != 4; ++variant )
+    {
+        GP_CALL( gp_canvas_clear, (_canvas) );
+
+        GP_CALL( gp_set_penumbra, (_canvas, (variant & 1) != 0 ? 1.f : 0.f) );
+        GP_CALL( gp_set_thickness, (_canvas, 2.f) );
+
+        if( (variant & 2) != 0 )
+        {
+            GP_CALL( gp_begin_fill, (_canvas) );
+        }
+
+        GP_CALL( gp_arc, (_canvas, 50.f, 50.f, 30.f, 20.f, 0.25f, 2.5f) );
+        GP_CALL( gp_arc, (_canvas, 50.f, 50.f, 20.f, 20.f, 1.f, -4.f) );
+
+        if( (variant & 2) != 0 )
+        {
+            GP_CALL( gp_end_fill, (_canvas) );
+        }
+
+        gp_mesh_t mesh;
+        GP_CALL( __test_mesh, (_canvas, &mesh) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_arc_to( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_thickness, (_canvas, 2.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_arc_to, (_canvas, 10.f, 10.f, 0.f, GP_FALSE, GP_TRUE, 20.f, 0.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh) );
+
+    float max_x = -1000.f;
+    float min_y = 1000.f;
+    float max_y = -1000.f;
+
+    for( gp_uint16_t index = 0; index != mesh.vertex_count; ++index )
+    {
+        const arc_vertex_t * v = vertices + index;
+
+        float dx = v->x - 10.f;
+        float dy = v->y;
+
+        float d = sqrtf( dx * dx + dy * dy );
+
+        if( fabsf( d - 10.f ) > 1.5f )
+        {
+            return GP_FAILURE;
+        }
+
+        max_x = v->x > max_x ? v->x : max_x;
+        min_y = v->y < min_y ? v->y : min_y;
+        max_y = v->y > max_y ? v->y : max_y;
+    }
+
+    if( fabsf( max_x - 21.f ) > 0.1f || min_y > -10.5f || max_y > 0.1f )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_arc_full( gp_canvas_t * _arc, gp_canvas_t * _ellipse )
+{
+    GP_CALL( gp_canvas_clear, (_arc) );
+    GP_CALL( gp_canvas_clear, (_ellipse) );
+
+    GP_CALL( gp_arc, (_arc, 50.f, 50.f, 30.f, 20.f, 1.f, 7.f) );
+    GP_CALL( gp_ellipse, (_ellipse, 50.f, 50.f, 30.f, 20.f) );
+
+    gp_uint64_t arc_hash;
+    GP_CALL( gp_canvas_get_hash, (_arc, &arc_hash) );
+
+    gp_uint64_t ellipse_hash;
+    GP_CALL( gp_canvas_get_hash, (_ellipse, &ellipse_hash) );
+
+    if( arc_hash != ellipse_hash )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_arc) );
+    GP_CALL( gp_arc, (_arc, 50.f, 50.f, 30.f, 20.f, 1.f, 3.f) );
+    GP_CALL( gp_canvas_get_hash, (_arc, &arc_hash) );
+
+    if( arc_hash == ellipse_hash )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * ellipse;
+    if( gp_canvas_create( &ellipse, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_arc_variants( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_arc_to( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_arc_full( canvas, ellipse ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE || gp_canvas_destroy( ellipse ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
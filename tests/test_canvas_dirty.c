@@ -0,0 +1,172 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw( gp_canvas_t * _canvas, float _x, gp_bool_t _line )
+{
+    GP_CALL( gp_set_line_join, (_canvas, GP_LINE_JOIN_BEVEL) );
+
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_circle, (_canvas, _x, 100.f, 10.f) );
+
+    if( _line == GP_TRUE )
+    {
+        GP_CALL( gp_move_to, (_canvas, 0.f, 300.f) );
+        GP_CALL( gp_line_to, (_canvas, 100.f, 300.f) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_rect( const gp_dirty_rect_t * _rect, float _x0, float _y0, float _x1, float _y1 )
+{
+    if( _rect->x != _x0 || _rect->y != _y0 || _rect->x + _rect->width != _x1 || _rect->y + _rect->height != _y1 )
+    {
+        printf( "dirty rect %f %f %f %f expected %f %f %f %f\n", _rect->x, _rect->y, _rect->x + _rect->width, _rect->y + _rect->height, _x0, _y0, _x1, _y1 );
+
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_canvas_dirty( gp_canvas_t * _canvas )
+{
+    gp_dirty_rect_t rects[8];
+    gp_uint32_t count;
+
+    GP_CALL( __test_draw, (_canvas, 100.f, GP_TRUE) );
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( __test_draw, (_canvas, 100.f, GP_TRUE) );
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( __test_draw, (_canvas, 200.f, GP_TRUE) );
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 2 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_rect, (rects + 0, 88.5f, 88.5f, 111.5f, 111.5f) );
+    GP_CALL( __test_rect, (rects + 1, 188.5f, 88.5f, 211.5f, 111.5f) );
+
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 1, &count) );
+
+    if( count != 1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_rect, (rects + 0, 88.5f, 88.5f, 211.5f, 111.5f) );
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( __test_draw, (_canvas, 200.f, GP_FALSE) );
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_rect, (rects + 0, -1.5f, 298.5f, 101.5f, 301.5f) );
+
+    const gp_canvas_t * snapshot;
+    GP_CALL( gp_canvas_snapshot, (_canvas, &snapshot) );
+
+    GP_CALL( __test_draw, (_canvas, 200.f, GP_FALSE) );
+    GP_CALL( gp_set_thickness, (_canvas, 5.f) );
+    GP_CALL( gp_rect, (_canvas, 300.f, 10.f, 10.f, 10.f) );
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_rect, (rects + 0, 297.5f, 7.5f, 312.5f, 22.5f) );
+
+    GP_CALL( gp_canvas_snapshot_release, (snapshot) );
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 20.f, 20.f) );
+    GP_CALL( gp_rect, (_canvas, 60.f, 10.f, 20.f, 20.f) );
+    GP_CALL( gp_rect, (_canvas, 110.f, 10.f, 20.f, 20.f) );
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 20.f, 20.f) );
+    GP_CALL( gp_rect, (_canvas, 110.f, 10.f, 20.f, 20.f) );
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_rect, (rects + 0, 58.5f, 8.5f, 81.5f, 31.5f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_canvas_dirty( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
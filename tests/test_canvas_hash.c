@@ -0,0 +1,134 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw( gp_canvas_t * _canvas, float _radius )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.25f, 1.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 0.f) );
+    GP_CALL( gp_bezier_curve_to, (_canvas, 150.f, 100.f, 50.f, 100.f, 50.f, 150.f) );
+
+    GP_CALL( gp_rect, (_canvas, 10.f, 200.f, 40.f, 20.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 60.f, 200.f, 40.f, 20.f, 5.f) );
+    GP_CALL( gp_circle, (_canvas, 300.f, 200.f, _radius) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_canvas_hash( gp_canvas_t * _canvas )
+{
+    gp_uint64_t empty_hash;
+    GP_CALL( gp_canvas_get_hash, (_canvas, &empty_hash) );
+
+    GP_CALL( __test_draw, (_canvas, 20.f) );
+
+    gp_uint64_t hash0;
+    GP_CALL( gp_canvas_get_hash, (_canvas, &hash0) );
+
+    if( hash0 == empty_hash )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_set_thickness, (_canvas, 10.f) );
+
+    gp_uint64_t hash1;
+    GP_CALL( gp_canvas_get_hash, (_canvas, &hash1) );
+
+    if( hash0 != hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+    GP_CALL( gp_canvas_get_hash, (_canvas, &hash1) );
+
+    if( hash1 != empty_hash )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_draw, (_canvas, 20.f) );
+    GP_CALL( gp_canvas_get_hash, (_canvas, &hash1) );
+
+    if( hash0 != hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+    GP_CALL( __test_draw, (_canvas, 21.f) );
+    GP_CALL( gp_canvas_get_hash, (_canvas, &hash1) );
+
+    if( hash0 == hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+    GP_CALL( gp_set_outline_width, (_canvas, 1.f) );
+    GP_CALL( __test_draw, (_canvas, 20.f) );
+    GP_CALL( gp_canvas_get_hash, (_canvas, &hash1) );
+
+    if( hash0 == hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_canvas_hash( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
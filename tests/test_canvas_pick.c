@@ -0,0 +1,280 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_pick( const gp_canvas_t * _canvas, float _x, float _y, gp_bool_t _found, gp_shape_type_e _type, gp_uint32_t _index )
+{
+    gp_shape_t shape;
+    gp_bool_t found;
+    GP_CALL( gp_canvas_pick, (_canvas, _x, _y, &shape, &found) );
+
+    if( found != _found )
+    {
+        printf( "pick %f %f found %u expected %u\n", _x, _y, found, _found );
+
+        return GP_FAILURE;
+    }
+
+    if( found == GP_FALSE )
+    {
+        return GP_SUCCESSFUL;
+    }
+
+    if( shape.type != _type || shape.index != _index )
+    {
+        printf( "pick %f %f shape %u:%u expected %u:%u\n", _x, _y, shape.type, shape.index, _type, _index );
+
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_thickness, (_canvas, 4.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 300.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 300.f) );
+    GP_CALL( gp_quadratic_curve_to, (_canvas, 150.f, 300.f, 150.f, 350.f) );
+
+    GP_CALL( gp_push_state, (_canvas) );
+    GP_CALL( gp_set_outline_width, (_canvas, 1.f) );
+    GP_CALL( gp_move_to, (_canvas, 0.f, 400.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 400.f) );
+    GP_CALL( gp_pop_state, (_canvas) );
+
+    GP_CALL( gp_rect, (_canvas, 100.f, 100.f, 50.f, 30.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rect, (_canvas, 200.f, 100.f, 50.f, 30.f) );
+    GP_CALL( gp_rect, (_canvas, 220.f, 110.f, 50.f, 30.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    GP_CALL( gp_rounded_rect, (_canvas, 300.f, 100.f, 60.f, 40.f, 10.f) );
+
+    GP_CALL( gp_push_state, (_canvas) );
+    GP_CALL( gp_set_outline_width, (_canvas, 3.f) );
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rounded_rect, (_canvas, 300.f, 200.f, 60.f, 40.f, 10.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+    GP_CALL( gp_rounded_rect, (_canvas, 300.f, 300.f, 60.f, 40.f, 10.f) );
+    GP_CALL( gp_pop_state, (_canvas) );
+
+    GP_CALL( gp_circle, (_canvas, 500.f, 100.f, 20.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_circle, (_canvas, 500.f, 200.f, 20.f) );
+    GP_CALL( gp_circle, (_canvas, 260.f, 135.f, 10.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_pick_shapes( const gp_canvas_t * _canvas )
+{
+    GP_CALL( __test_pick, (_canvas, 50.f, 301.9f, GP_TRUE, GP_SHAPE_TYPE_LINE, 0) );
+    GP_CALL( __test_pick, (_canvas, 50.f, 302.1f, GP_FALSE, GP_SHAPE_TYPE_LINE, 0) );
+    GP_CALL( __test_pick, (_canvas, 137.5f, 312.5f, GP_TRUE, GP_SHAPE_TYPE_LINE, 0) );
+    GP_CALL( __test_pick, (_canvas, 50.f, 402.9f, GP_TRUE, GP_SHAPE_TYPE_LINE, 1) );
+    GP_CALL( __test_pick, (_canvas, 50.f, 403.1f, GP_FALSE, GP_SHAPE_TYPE_LINE, 0) );
+
+    GP_CALL( __test_pick, (_canvas, 98.5f, 115.f, GP_TRUE, GP_SHAPE_TYPE_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 97.5f, 115.f, GP_FALSE, GP_SHAPE_TYPE_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 101.9f, 115.f, GP_TRUE, GP_SHAPE_TYPE_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 125.f, 115.f, GP_FALSE, GP_SHAPE_TYPE_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 205.f, 105.f, GP_TRUE, GP_SHAPE_TYPE_RECT, 1) );
+    GP_CALL( __test_pick, (_canvas, 240.f, 120.f, GP_TRUE, GP_SHAPE_TYPE_RECT, 2) );
+    GP_CALL( __test_pick, (_canvas, 260.f, 135.f, GP_TRUE, GP_SHAPE_TYPE_ELLIPSE, 2) );
+
+    GP_CALL( __test_pick, (_canvas, 302.93f, 102.93f, GP_TRUE, GP_SHAPE_TYPE_ROUNDED_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 300.f, 100.f, GP_FALSE, GP_SHAPE_TYPE_ROUNDED_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 330.f, 120.f, GP_FALSE, GP_SHAPE_TYPE_ROUNDED_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 330.f, 98.5f, GP_TRUE, GP_SHAPE_TYPE_ROUNDED_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 300.f, 200.f, GP_TRUE, GP_SHAPE_TYPE_ROUNDED_RECT, 1) );
+    GP_CALL( __test_pick, (_canvas, 330.f, 195.5f, GP_TRUE, GP_SHAPE_TYPE_ROUNDED_RECT, 1) );
+    GP_CALL( __test_pick, (_canvas, 330.f, 194.5f, GP_FALSE, GP_SHAPE_TYPE_ROUNDED_RECT, 0) );
+    GP_CALL( __test_pick, (_canvas, 330.f, 298.5f, GP_TRUE, GP_SHAPE_TYPE_ROUNDED_RECT, 2) );
+    GP_CALL( __test_pick, (_canvas, 330.f, 296.5f, GP_FALSE, GP_SHAPE_TYPE_ROUNDED_RECT, 0) );
+
+    GP_CALL( __test_pick, (_canvas, 521.5f, 100.f, GP_TRUE, GP_SHAPE_TYPE_ELLIPSE, 0) );
+    GP_CALL( __test_pick, (_canvas, 522.5f, 100.f, GP_FALSE, GP_SHAPE_TYPE_ELLIPSE, 0) );
+    GP_CALL( __test_pick, (_canvas, 518.5f, 100.f, GP_TRUE, GP_SHAPE_TYPE_ELLIPSE, 0) );
+    GP_CALL( __test_pick, (_canvas, 517.5f, 100.f, GP_FALSE, GP_SHAPE_TYPE_ELLIPSE, 0) );
+    GP_CALL( __test_pick, (_canvas, 500.f, 200.f, GP_TRUE, GP_SHAPE_TYPE_ELLIPSE, 1) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_canvas_pick( gp_canvas_t * _canvas )
+{
+    GP_CALL( __test_draw, (_canvas) );
+
+    GP_CALL( __test_pick_shapes, (_canvas) );
+
+    GP_CALL( gp_canvas_build_index, (_canvas) );
+
+    GP_CALL( __test_pick_shapes, (_canvas) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rect, (_canvas, 120.f, 110.f, 10.f, 10.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    GP_CALL( __test_pick, (_canvas, 125.f, 115.f, GP_TRUE, GP_SHAPE_TYPE_RECT, 3) );
+
+    gp_shape_t shapes[16];
+    gp_uint32_t count;
+    GP_CALL( gp_canvas_query_rect, (_canvas, 90.f, 90.f, 200.f, 60.f, shapes, 16, &count) );
+
+    if( count != 5 )
+    {
+        printf( "query count %u expected 5\n", count );
+
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( __test_pick, (_canvas, 125.f, 115.f, GP_FALSE, GP_SHAPE_TYPE_RECT, 0) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_TEST_RANDOM_SHAPES 100000
+#define GP_TEST_RANDOM_PICKS 256
+//////////////////////////////////////////////////////////////////////////
+static gp_uint32_t random_seed = 12345;
+//////////////////////////////////////////////////////////////////////////
+static float __test_random( float _max )
+{
+    random_seed = random_seed * 1664525U + 1013904223U;
+
+    float f = (float)(random_seed >> 8) / 16777216.f * _max;
+
+    return f;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_shape_t picks[GP_TEST_RANDOM_PICKS];
+static gp_bool_t picks_found[GP_TEST_RANDOM_PICKS];
+static gp_uint32_t queries[GP_TEST_RANDOM_PICKS];
+static float picks_x[GP_TEST_RANDOM_PICKS];
+static float picks_y[GP_TEST_RANDOM_PICKS];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_canvas_pick_random( gp_canvas_t * _canvas )
+{
+    for( gp_uint32_t index = 0; index != GP_TEST_RANDOM_SHAPES; ++index )
+    {
+        float x = __test_random( 4096.f );
+        float y = __test_random( 4096.f );
+        float w = __test_random( 16.f ) + 1.f;
+        float h = __test_random( 16.f ) + 1.f;
+
+        GP_CALL( gp_set_thickness, (_canvas, __test_random( 4.f )) );
+
+        switch( index % 4 )
+        {
+        case 0:
+            {
+                GP_CALL( gp_move_to, (_canvas, x, y) );
+                GP_CALL( gp_bezier_curve_to, (_canvas, x + w, y, x, y + h, x + w, y + h) );
+            }break;
+        case 1:
+            {
+                GP_CALL( gp_rect, (_canvas, x, y, w, h) );
+            }break;
+        case 2:
+            {
+                GP_CALL( gp_rounded_rect, (_canvas, x, y, w, h, 0.5f) );
+            }break;
+        case 3:
+            {
+                GP_CALL( gp_ellipse, (_canvas, x, y, w, h) );
+            }break;
+        }
+    }
+
+    for( gp_uint32_t index = 0; index != GP_TEST_RANDOM_PICKS; ++index )
+    {
+        picks_x[index] = __test_random( 4096.f );
+        picks_y[index] = __test_random( 4096.f );
+
+        GP_CALL( gp_canvas_pick, (_canvas, picks_x[index], picks_y[index], picks + index, picks_found + index) );
+        GP_CALL( gp_canvas_query_rect, (_canvas, picks_x[index], picks_y[index], 64.f, 64.f, GP_NULLPTR, 0, queries + index) );
+    }
+
+    GP_CALL( gp_canvas_build_index, (_canvas) );
+
+    for( gp_uint32_t index = 0; index != GP_TEST_RANDOM_PICKS; ++index )
+    {
+        GP_CALL( __test_pick, (_canvas, picks_x[index], picks_y[index], picks_found[index], picks[index].type, picks[index].index) );
+
+        gp_uint32_t count;
+        GP_CALL( gp_canvas_query_rect, (_canvas, picks_x[index], picks_y[index], 64.f, 64.f, GP_NULLPTR, 0, &count) );
+
+        if( count != queries[index] )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_canvas_pick( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_canvas_pick_random( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
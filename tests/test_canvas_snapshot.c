@@ -0,0 +1,207 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_t
+{
+    float x;
+    float y;
+    gp_uint32_t c;
+    float u;
+    float v;
+} gl_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw_a( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.25f, 1.f) );
+    GP_CALL( gp_set_uv_offset, (_canvas, 0.f, 0.f, 1.f, 1.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 0.f) );
+    GP_CALL( gp_quadratic_curve_to, (_canvas, 150.f, 0.f, 150.f, 50.f) );
+
+    GP_CALL( gp_rect, (_canvas, 10.f, 200.f, 40.f, 20.f) );
+    GP_CALL( gp_circle, (_canvas, 300.f, 200.f, 20.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw_b( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_uv_offset, (_canvas, 0.5f, 0.5f, 2.f, 2.f) );
+
+    GP_CALL( gp_rounded_rect, (_canvas, 60.f, 200.f, 40.f, 20.f, 5.f) );
+    GP_CALL( gp_ellipse, (_canvas, 200.f, 100.f, 30.f, 10.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gl_vertex_t vertices0[4096];
+static gl_vertex_t vertices1[4096];
+static gp_uint16_t indices0[8192];
+static gp_uint16_t indices1[8192];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_render( const gp_canvas_t * _canvas, gl_vertex_t * _vertices, gp_uint16_t * _indices, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count > 4096 || _mesh->index_count > 8192 )
+    {
+        return GP_FAILURE;
+    }
+
+    _mesh->positions_buffer = _vertices;
+    _mesh->positions_offset = offsetof( gl_vertex_t, x );
+    _mesh->positions_stride = sizeof( gl_vertex_t );
+
+    _mesh->colors_buffer = _vertices;
+    _mesh->colors_offset = offsetof( gl_vertex_t, c );
+    _mesh->colors_stride = sizeof( gl_vertex_t );
+
+    _mesh->uv_buffer = _vertices;
+    _mesh->uv_offset = offsetof( gl_vertex_t, u );
+    _mesh->uv_stride = sizeof( gl_vertex_t );
+
+    _mesh->indices_buffer = _indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_equal( const gp_canvas_t * _canvas0, const gp_canvas_t * _canvas1 )
+{
+    gp_mesh_t mesh0;
+    GP_CALL( __test_render, (_canvas0, vertices0, indices0, &mesh0) );
+
+    gp_mesh_t mesh1;
+    GP_CALL( __test_render, (_canvas1, vertices1, indices1, &mesh1) );
+
+    if( mesh0.vertex_count != mesh1.vertex_count || mesh0.index_count != mesh1.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    if( memcmp( vertices0, vertices1, sizeof( gl_vertex_t ) * mesh0.vertex_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( memcmp( indices0, indices1, sizeof( gp_uint16_t ) * mesh0.index_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_uint64_t hash0;
+    GP_CALL( gp_canvas_get_hash, (_canvas0, &hash0) );
+
+    gp_uint64_t hash1;
+    GP_CALL( gp_canvas_get_hash, (_canvas1, &hash1) );
+
+    if( hash0 != hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_canvas_snapshot( gp_canvas_t * _canvas, gp_canvas_t * _canvas_a, gp_canvas_t * _canvas_b )
+{
+    GP_CALL( __test_draw_a, (_canvas) );
+
+    const gp_canvas_t * snapshot;
+    GP_CALL( gp_canvas_snapshot, (_canvas, &snapshot) );
+
+    GP_CALL( __test_draw_b, (_canvas) );
+
+    GP_CALL( __test_draw_a, (_canvas_a) );
+
+    GP_CALL( gp_set_color, (_canvas_b, 1.f, 0.5f, 0.25f, 1.f) );
+    GP_CALL( __test_draw_b, (_canvas_b) );
+
+    GP_CALL( __test_equal, (snapshot, _canvas_a) );
+    GP_CALL( __test_equal, (_canvas, _canvas_b) );
+
+    GP_CALL( gp_canvas_snapshot_release, (snapshot) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * canvas_a;
+    if( gp_canvas_create( &canvas_a, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * canvas_b;
+    if( gp_canvas_create( &canvas_b, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_canvas_snapshot( canvas, canvas_a, canvas_b ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas_a ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas_b ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,221 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_uint16_t indices[8192];
+static gp_uint16_t indices_original[8192];
+static gp_draw_range_t ranges[16];
+static gp_draw_range_t ranges_original[16];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_range( const gp_draw_range_t * _range, gp_uint16_t _first, gp_uint32_t _material, gp_bool_t _blend )
+{
+    if( _range->first != _first || _range->count == 0 || _range->count % 3 != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( _range->material != _material || _range->blend != _blend )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw_ranges( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_material, (_canvas, 1) );
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 0.f) );
+
+    GP_CALL( gp_set_material, (_canvas, 2) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.f, 0.f, 1.f) );
+    GP_CALL( gp_rect, (_canvas, 60.f, 10.f, 40.f, 20.f) );
+
+    GP_CALL( gp_set_material, (_canvas, 1) );
+    GP_CALL( gp_set_blend, (_canvas, GP_FALSE) );
+    GP_CALL( gp_rect, (_canvas, 110.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 10.f, 50.f, 40.f, 20.f, 5.f) );
+
+    GP_CALL( gp_set_material, (_canvas, 2) );
+    GP_CALL( gp_set_blend, (_canvas, GP_TRUE) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 20.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.index_count > 8192 || mesh.range_count != 4 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.indices_buffer = indices;
+    mesh.indices_offset = 0;
+    mesh.indices_stride = sizeof( gp_uint16_t );
+
+    mesh.ranges_buffer = ranges;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    GP_CALL( __test_range, (ranges + 0, 0, 1, GP_TRUE) );
+    GP_CALL( __test_range, (ranges + 1, ranges[0].first + ranges[0].count, 2, GP_TRUE) );
+    GP_CALL( __test_range, (ranges + 2, ranges[1].first + ranges[1].count, 1, GP_FALSE) );
+    GP_CALL( __test_range, (ranges + 3, ranges[2].first + ranges[2].count, 2, GP_TRUE) );
+
+    if( ranges[3].first + ranges[3].count != mesh.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    memcpy( indices_original, indices, sizeof( gp_uint16_t ) * mesh.index_count );
+    memcpy( ranges_original, ranges, sizeof( gp_draw_range_t ) * mesh.range_count );
+
+    gp_uint32_t range_count;
+    GP_CALL( gp_reorder_ranges, (_canvas, &mesh, &range_count) );
+
+    if( range_count != 3 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_range, (ranges + 0, 0, 1, GP_TRUE) );
+    GP_CALL( __test_range, (ranges + 1, ranges[0].first + ranges[0].count, 1, GP_FALSE) );
+    GP_CALL( __test_range, (ranges + 2, ranges[1].first + ranges[1].count, 2, GP_TRUE) );
+
+    const gp_draw_range_t * order[4] = {ranges_original + 0, ranges_original + 2, ranges_original + 1, ranges_original + 3};
+
+    gp_uint16_t iterator = 0;
+
+    for( gp_uint32_t index = 0; index != 4; ++index )
+    {
+        const gp_draw_range_t * range = order[index];
+
+        if( memcmp( indices + iterator, indices_original + range->first, sizeof( gp_uint16_t ) * range->count ) != 0 )
+        {
+            return GP_FAILURE;
+        }
+
+        iterator += range->count;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw_ranges_remove( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_material, (_canvas, 1) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 40.f, 20.f) );
+
+    GP_CALL( gp_set_material, (_canvas, 2) );
+    GP_CALL( gp_rect, (_canvas, 60.f, 10.f, 40.f, 20.f) );
+
+    gp_shape_handle_t handle;
+    GP_CALL( gp_shape_retain, (_canvas, GP_SHAPE_TYPE_RECT, &handle) );
+
+    GP_CALL( gp_set_material, (_canvas, 1) );
+    GP_CALL( gp_rect, (_canvas, 110.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 20.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.range_count != 3 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_shape_set_color, (_canvas, handle, 0.f, 1.f, 0.f, 1.f) );
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.range_count != 3 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_shape_remove, (_canvas, handle) );
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.index_count > 8192 || mesh.range_count != 1 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.indices_buffer = indices;
+    mesh.indices_offset = 0;
+    mesh.indices_stride = sizeof( gp_uint16_t );
+
+    mesh.ranges_buffer = ranges;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    GP_CALL( __test_range, (ranges + 0, 0, 1, GP_TRUE) );
+
+    if( ranges[0].count != mesh.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_draw_ranges( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_draw_ranges_remove( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "graphics/graphics_ffi.h"
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( size_t _size, void * _ud )
+{
+    (void)_ud;
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, size_t _size, void * _ud )
+{
+    (void)_ud;
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    (void)_ud;
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static const float points[] = {0.f, 0.f, 50.f, 20.f, 100.f, 0.f, 150.f, 40.f};
+static const float rects[] = {10.f, 10.f, 40.f, 20.f, 60.f, 10.f, 40.f, 20.f};
+static const float rounded_rects[] = {10.f, 50.f, 40.f, 20.f, 5.f, 60.f, 50.f, 40.f, 20.f, 8.f};
+static const float circles[] = {100.f, 100.f, 20.f, 150.f, 100.f, 10.f, 200.f, 100.f, 5.f};
+static const float ellipses[] = {100.f, 200.f, 30.f, 10.f};
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_bulk( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.25f, 1.f) );
+    GP_CALL( gp_polyline, (_canvas, points, 4) );
+    GP_CALL( gp_rects, (_canvas, rects, 2) );
+    GP_CALL( gp_rounded_rects, (_canvas, rounded_rects, 2) );
+    GP_CALL( gp_circles, (_canvas, circles, 3) );
+    GP_CALL( gp_ellipses, (_canvas, ellipses, 1) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_single( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.25f, 1.f) );
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 50.f, 20.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 150.f, 40.f) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_rect, (_canvas, 60.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 10.f, 50.f, 40.f, 20.f, 5.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 60.f, 50.f, 40.f, 20.f, 8.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 20.f) );
+    GP_CALL( gp_circle, (_canvas, 150.f, 100.f, 10.f) );
+    GP_CALL( gp_circle, (_canvas, 200.f, 100.f, 5.f) );
+    GP_CALL( gp_ellipse, (_canvas, 100.f, 200.f, 30.f, 10.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    (void)argc;
+    (void)argv;
+
+    gp_canvas_t * bulk;
+    if( gp_canvas_create( &bulk, &gp_malloc, &gp_realloc, &gp_free, NULL ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * single;
+    if( gp_canvas_create( &single, &gp_malloc, &gp_realloc, &gp_free, NULL ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_bulk( bulk ) == GP_FAILURE || __test_single( single ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    uint64_t bulk_hash;
+    uint64_t single_hash;
+
+    if( gp_canvas_get_hash( bulk, &bulk_hash ) == GP_FAILURE || gp_canvas_get_hash( single, &single_hash ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( bulk_hash != single_hash )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( bulk ) == GP_FAILURE || gp_canvas_destroy( single ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
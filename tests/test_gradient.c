@@ -0,0 +1,362 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gradient_vertex_t
+{
+    float x;
+    float y;
+    gp_argb_t color;
+} gradient_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+#define GRADIENT_SENTINEL (12345.f)
+//////////////////////////////////////////////////////////////////////////
+static gradient_vertex_t vertices[2048 + 1];
+static gp_uint16_t indices[8192];
+//////////////////////////////////////////////////////////////////////////
+static const float gradient_stops[] = {
+    0.f, 1.f, 0.f, 0.f, 1.f,
+    0.5f, 0.f, 1.f, 0.f, 1.f,
+    1.f, 0.f, 0.f, 1.f, 1.f
+};
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh( const gp_canvas_t * _canvas, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count == 0 || _mesh->vertex_count > 2048 || _mesh->index_count > 8192 )
+    {
+        return GP_FAILURE;
+    }
+
+    vertices[_mesh->vertex_count].x = GRADIENT_SENTINEL;
+
+    _mesh->positions_buffer = vertices;
+    _mesh->positions_offset = offsetof( gradient_vertex_t, x );
+    _mesh->positions_stride = sizeof( gradient_vertex_t );
+
+    _mesh->colors_buffer = vertices;
+    _mesh->colors_offset = offsetof( gradient_vertex_t, color );
+    _mesh->colors_stride = sizeof( gradient_vertex_t );
+
+    _mesh->indices_buffer = indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    if( vertices[_mesh->vertex_count].x != GRADIENT_SENTINEL )
+    {
+        return GP_FAILURE;
+    }
+
+    for( gp_uint16_t index = 0; index != _mesh->index_count; ++index )
+    {
+        if( indices[index] >= _mesh->vertex_count )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __test_channel( gp_argb_t _color, gp_uint32_t _shift, float _expected )
+{
+    float value = (float)((_color >> _shift) & 0xff) / 255.f;
+
+    float d = value - _expected;
+
+    return d > -0.02f && d < 0.02f ? GP_TRUE : GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_vertical_color( gp_argb_t _color, float _y )
+{
+    float t = _y / 100.f;
+    t = t < 0.f ? 0.f : (t > 1.f ? 1.f : t);
+
+    float r = t < 0.5f ? 1.f - t * 2.f : 0.f;
+    float g = t < 0.5f ? t * 2.f : 2.f - t * 2.f;
+    float b = t < 0.5f ? 0.f : t * 2.f - 1.f;
+
+    if( __test_channel( _color, 16, r ) == GP_FALSE ||
+        __test_channel( _color, 8, g ) == GP_FALSE ||
+        __test_channel( _color, 0, b ) == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_gradient_linear( gp_canvas_t * _canvas )
+{
+    for( gp_uint32_t variant = 0; variant != 4; ++variant )
+    {
+        GP_CALL( gp_canvas_clear, (_canvas) );
+
+        GP_CALL( gp_set_thickness, (_canvas, 2.f) );
+        GP_CALL( gp_set_penumbra, (_canvas, (variant & 1) != 0 ? 1.f : 0.f) );
+        GP_CALL( gp_set_linear_gradient, (_canvas, 0.f, 0.f, 0.f, 100.f, gradient_stops, 3) );
+
+        GP_CALL( gp_begin_fill, (_canvas) );
+
+        if( variant < 2 )
+        {
+            GP_CALL( gp_rect, (_canvas, 0.f, 0.f, 100.f, 100.f) );
+        }
+        else
+        {
+            GP_CALL( gp_rounded_rect_corners, (_canvas, 0.f, 0.f, 100.f, 100.f, 10.f, 0.f, 20.f, 5.f) );
+        }
+
+        GP_CALL( gp_end_fill, (_canvas) );
+
+        gp_mesh_t mesh;
+        GP_CALL( __test_mesh, (_canvas, &mesh) );
+
+        gp_uint32_t cuts = 0;
+
+        for( gp_uint16_t index = 0; index != mesh.vertex_count; ++index )
+        {
+            const gradient_vertex_t * v = vertices + index;
+
+            GP_CALL( __test_vertical_color, (v->color, v->y) );
+
+            if( v->y == 50.f )
+            {
+                ++cuts;
+            }
+        }
+
+        if( cuts == 0 )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_gradient_variants( gp_canvas_t * _canvas )
+{
+    for( gp_uint32_t variant = 0; variant != 6; ++variant )
+    {
+        GP_CALL( gp_canvas_clear, (_canvas) );
+
+        GP_CALL( gp_set_rect_quality, (_canvas, 5) );
+        GP_CALL( gp_set_thickness, (_canvas, 3.f) );
+        GP_CALL( gp_set_penumbra, (_canvas, (variant & 1) != 0 ? 1.f : 0.f) );
+        GP_CALL( gp_set_outline_width, (_canvas, variant >= 4 ? 2.f : 0.f) );
+        GP_CALL( gp_set_linear_gradient, (_canvas, 10.f, 20.f, 90.f, 70.f, gradient_stops, 3) );
+
+        if( variant >= 2 )
+        {
+            GP_CALL( gp_begin_fill, (_canvas) );
+        }
+
+        GP_CALL( gp_rect, (_canvas, 5.f, 5.f, 100.f, 60.f) );
+        GP_CALL( gp_rounded_rect, (_canvas, 5.f, 80.f, 100.f, 60.f, 12.f) );
+        GP_CALL( gp_rounded_rect_corners, (_canvas, 5.f, 150.f, 100.f, 60.f, 0.f, 20.f, 0.f, 8.f) );
+        GP_CALL( gp_ellipse, (_canvas, 50.f, 50.f, 40.f, 30.f) );
+
+        if( variant >= 2 )
+        {
+            GP_CALL( gp_end_fill, (_canvas) );
+        }
+
+        gp_mesh_t mesh;
+        GP_CALL( __test_mesh, (_canvas, &mesh) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_gradient_radial( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_thickness, (_canvas, 0.f) );
+    GP_CALL( gp_set_radial_gradient, (_canvas, 50.f, 50.f, 40.f, gradient_stops, 3) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_circle, (_canvas, 50.f, 50.f, 40.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh) );
+
+    for( gp_uint16_t index = 0; index != mesh.vertex_count; ++index )
+    {
+        const gradient_vertex_t * v = vertices + index;
+
+        gp_argb_t expected = v->x == 50.f && v->y == 50.f ? 0xffff0000 : 0xff0000ff;
+
+        if( v->color != expected )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_gradient_clear( gp_canvas_t * _gradient, gp_canvas_t * _plain )
+{
+    GP_CALL( gp_canvas_clear, (_gradient) );
+    GP_CALL( gp_canvas_clear, (_plain) );
+
+    GP_CALL( gp_set_linear_gradient, (_gradient, 0.f, 0.f, 100.f, 0.f, gradient_stops, 3) );
+
+    gp_gradient_e gradient;
+    float stops[GP_GRADIENT_STOP_MAX * 5];
+    gp_uint32_t count;
+    GP_CALL( gp_get_gradient, (_gradient, &gradient, stops, &count) );
+
+    if( gradient != GP_GRADIENT_LINEAR || count != 3 || stops[5] != 0.5f )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_clear_gradient, (_gradient) );
+
+    GP_CALL( gp_rect, (_gradient, 10.f, 20.f, 100.f, 50.f) );
+    GP_CALL( gp_rect, (_plain, 10.f, 20.f, 100.f, 50.f) );
+
+    gp_uint64_t gradient_hash;
+    GP_CALL( gp_canvas_get_hash, (_gradient, &gradient_hash) );
+
+    gp_uint64_t plain_hash;
+    GP_CALL( gp_canvas_get_hash, (_plain, &plain_hash) );
+
+    if( gradient_hash != plain_hash )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_gradient_bounds( gp_canvas_t * _canvas )
+{
+    float stops[(GP_GRADIENT_STOP_MAX + 1) * 5];
+
+    for( gp_uint32_t index = 0; index != GP_GRADIENT_STOP_MAX + 1; ++index )
+    {
+        float * stop = stops + index * 5;
+
+        stop[0] = 1.f;
+        stop[1] = 1.f;
+        stop[2] = 1.f;
+        stop[3] = 1.f;
+        stop[4] = 1.f;
+    }
+
+    stops[0] = 0.f;
+
+    if( gp_set_linear_gradient( _canvas, 0.f, 0.f, 10.f, 0.f, stops, 0 ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( gp_set_linear_gradient( _canvas, 0.f, 0.f, 10.f, 0.f, stops, GP_GRADIENT_STOP_MAX + 1 ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( gp_set_radial_gradient( _canvas, 0.f, 0.f, 10.f, stops, 0 ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( gp_set_radial_gradient( _canvas, 0.f, 0.f, 10.f, stops, GP_GRADIENT_STOP_MAX + 1 ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_set_radial_gradient, (_canvas, 0.f, 0.f, 10.f, stops, GP_GRADIENT_STOP_MAX) );
+    GP_CALL( gp_clear_gradient, (_canvas) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * plain;
+    if( gp_canvas_create( &plain, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_gradient_linear( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_gradient_variants( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_gradient_radial( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_gradient_bounds( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_gradient_clear( canvas, plain ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE || gp_canvas_destroy( plain ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
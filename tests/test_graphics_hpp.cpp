@@ -0,0 +1,158 @@
+#include "graphics/graphics.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////
+struct test_vertex_t
+{
+    gp_uint32_t c;
+    float x;
+    float y;
+    float u;
+    float v;
+};
+//////////////////////////////////////////////////////////////////////////
+class counting_resource
+    : public std::pmr::memory_resource
+{
+public:
+    gp_uint32_t allocations = 0;
+    gp_uint32_t deallocations = 0;
+
+protected:
+    void * do_allocate( std::size_t _bytes, std::size_t _alignment ) override
+    {
+        ++allocations;
+
+        return std::pmr::new_delete_resource()->allocate( _bytes, _alignment );
+    }
+
+    void do_deallocate( void * _ptr, std::size_t _bytes, std::size_t _alignment ) override
+    {
+        ++deallocations;
+
+        std::pmr::new_delete_resource()->deallocate( _ptr, _bytes, _alignment );
+    }
+
+    bool do_is_equal( const std::pmr::memory_resource & _other ) const noexcept override
+    {
+        return this == &_other;
+    }
+};
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.25f, 1.f) );
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 50.f) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 10.f, 50.f, 40.f, 20.f, 5.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 20.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static test_vertex_t reference_vertices[4096];
+static gp_uint16_t reference_indices[8192];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_graphics_hpp( counting_resource * _resource )
+{
+    gp::canvas canvas( _resource );
+
+    if( canvas.valid() == false )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_draw, (canvas) );
+
+    gp::mesh<GP_ATTRIBUTE(test_vertex_t, x), GP_ATTRIBUTE(test_vertex_t, c), GP_ATTRIBUTE(test_vertex_t, u)> mesh( _resource );
+    mesh.set_colors_format( GP_COLOR_FORMAT_ABGR, GP_FALSE );
+
+    GP_CALL( mesh.render, (canvas) );
+
+    gp_mesh_t reference;
+    GP_CALL( gp_calculate_mesh_size, (canvas, &reference) );
+
+    if( reference.vertex_count == 0 || reference.vertex_count > 4096 || reference.index_count > 8192 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( mesh.vertices().size() != reference.vertex_count || mesh.indices().size() != reference.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    std::memset( reference_vertices, 0, sizeof( reference_vertices ) );
+
+    reference.positions_buffer = reference_vertices;
+    reference.positions_offset = offsetof( test_vertex_t, x );
+    reference.positions_stride = sizeof( test_vertex_t );
+
+    reference.colors_buffer = reference_vertices;
+    reference.colors_offset = offsetof( test_vertex_t, c );
+    reference.colors_stride = sizeof( test_vertex_t );
+    reference.colors_format = GP_COLOR_FORMAT_ABGR;
+
+    reference.uv_buffer = reference_vertices;
+    reference.uv_offset = offsetof( test_vertex_t, u );
+    reference.uv_stride = sizeof( test_vertex_t );
+
+    reference.indices_buffer = reference_indices;
+    reference.indices_offset = 0;
+    reference.indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (canvas, &reference) );
+
+    if( std::memcmp( mesh.vertices().data(), reference_vertices, sizeof( test_vertex_t ) * reference.vertex_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( std::memcmp( mesh.indices().data(), reference_indices, sizeof( gp_uint16_t ) * reference.index_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    gp::canvas moved( std::move( canvas ) );
+
+    if( canvas.valid() == true || moved.valid() == false )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( moved.clear, () );
+    GP_CALL( mesh.render, (moved) );
+
+    if( mesh.vertices().empty() == false || mesh.indices().empty() == false )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    counting_resource resource;
+
+    if( __test_graphics_hpp( &resource ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( resource.allocations == 0 || resource.allocations != resource.deallocations )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
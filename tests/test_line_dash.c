@@ -0,0 +1,165 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_t
+{
+    float x;
+    float y;
+    gp_uint32_t c;
+} gl_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __test_vertex( const gl_vertex_t * _v, float _x, float _y )
+{
+    float dx = _v->x - _x;
+    float dy = _v->y - _y;
+
+    if( dx * dx + dy * dy > 0.0001f )
+    {
+        return GP_FALSE;
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_line_dash( gp_canvas_t * _canvas )
+{
+    const float pattern[2] = {10.f, 10.f};
+
+    GP_CALL( gp_set_thickness, (_canvas, 2.f) );
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_dash, (_canvas, pattern, 2, 15.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 50.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 50.f, 50.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.vertex_count != 11 * 2 || mesh.index_count != 6 * 6 )
+    {
+        return GP_FAILURE;
+    }
+
+    gl_vertex_t vertices[22];
+    gp_uint16_t indices[36];
+
+    mesh.positions_buffer = vertices;
+    mesh.positions_offset = offsetof( gl_vertex_t, x );
+    mesh.positions_stride = sizeof( gl_vertex_t );
+
+    mesh.colors_buffer = vertices;
+    mesh.colors_offset = offsetof( gl_vertex_t, c );
+    mesh.colors_stride = sizeof( gl_vertex_t );
+
+    mesh.indices_buffer = indices;
+    mesh.indices_offset = 0;
+    mesh.indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    if( __test_vertex( vertices + 0, 5.f, -1.f ) == GP_FALSE || __test_vertex( vertices + 3, 15.f, 1.f ) == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( __test_vertex( vertices + 4, 25.f, -1.f ) == GP_FALSE || __test_vertex( vertices + 7, 35.f, 1.f ) == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( __test_vertex( vertices + 8, 45.f, -1.f ) == GP_FALSE || __test_vertex( vertices + 10, 51.f, -1.f ) == GP_FALSE || __test_vertex( vertices + 11, 49.f, 1.f ) == GP_FALSE || __test_vertex( vertices + 12, 51.f, 5.f ) == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( __test_vertex( vertices + 18, 51.f, 35.f ) == GP_FALSE || __test_vertex( vertices + 21, 49.f, 45.f ) == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    if( indices[6] != 4 || indices[12] != 8 || indices[18] != 10 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_line_dash_bounds( gp_canvas_t * _canvas )
+{
+    float pattern[GP_DASH_PATTERN_MAX + 1];
+
+    for( gp_uint32_t index = 0; index != GP_DASH_PATTERN_MAX + 1; ++index )
+    {
+        pattern[index] = 1.f;
+    }
+
+    if( gp_set_dash( _canvas, pattern, GP_DASH_PATTERN_MAX + 1, 0.f ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_set_dash, (_canvas, pattern, GP_DASH_PATTERN_MAX, 0.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_line_dash( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_line_dash_bounds( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <math.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct join_vertex_t
+{
+    float x;
+    float y;
+    gp_argb_t color;
+} join_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static join_vertex_t vertices[1024];
+static gp_uint16_t indices[4096];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_render( gp_canvas_t * _canvas, gp_line_join_e _join, const float * _points, gp_uint32_t _point_count, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_thickness, (_canvas, 4.f) );
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_line_join, (_canvas, _join) );
+
+    GP_CALL( gp_polyline, (_canvas, _points, _point_count) );
+
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count > 1024 || _mesh->index_count > 4096 )
+    {
+        return GP_FAILURE;
+    }
+
+    _mesh->positions_buffer = vertices;
+    _mesh->positions_offset = offsetof( join_vertex_t, x );
+    _mesh->positions_stride = sizeof( join_vertex_t );
+
+    _mesh->colors_buffer = vertices;
+    _mesh->colors_offset = offsetof( join_vertex_t, color );
+    _mesh->colors_stride = sizeof( join_vertex_t );
+
+    _mesh->indices_buffer = indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_join_counts( gp_canvas_t * _canvas )
+{
+    const float turn[] = {0.f, 0.f, 100.f, 0.f, 150.f, 100.f};
+
+    const gp_uint16_t turn_vertex_count[3] = {3 * 2, 4 * 2, 15 * 2};
+
+    for( gp_uint32_t join = 0; join != 3; ++join )
+    {
+        gp_mesh_t mesh;
+        GP_CALL( __test_render, (_canvas, (gp_line_join_e)join, turn, 3, &mesh) );
+
+        if( mesh.vertex_count != turn_vertex_count[join] )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    float gentle[9 * 2];
+
+    for( gp_uint32_t index = 0; index != 9; ++index )
+    {
+        float a = 0.035f * (float)index;
+
+        gentle[index * 2 + 0] = 200.f * sinf( a );
+        gentle[index * 2 + 1] = 200.f - 200.f * cosf( a );
+    }
+
+    for( gp_uint32_t join = 0; join != 3; ++join )
+    {
+        gp_mesh_t mesh;
+        GP_CALL( __test_render, (_canvas, (gp_line_join_e)join, gentle, 9, &mesh) );
+
+        if( mesh.vertex_count != 9 * 2 || mesh.index_count != 8 * 6 )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __has_vertex( gp_uint16_t _count, float _x, float _y )
+{
+    for( gp_uint16_t index = 0; index != _count; ++index )
+    {
+        float dx = vertices[index].x - _x;
+        float dy = vertices[index].y - _y;
+
+        if( dx * dx + dy * dy < 0.0001f )
+        {
+            return GP_TRUE;
+        }
+    }
+
+    return GP_FALSE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_miter_limit( gp_canvas_t * _canvas )
+{
+    const float square[] = {0.f, 0.f, 100.f, 0.f, 100.f, 100.f};
+
+    gp_mesh_t square_mesh;
+    GP_CALL( __test_render, (_canvas, GP_LINE_JOIN_MITER, square, 3, &square_mesh) );
+
+    if( square_mesh.vertex_count != 3 * 2 || __has_vertex( square_mesh.vertex_count, 102.f, -2.f ) == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    const float sharp[] = {0.f, 0.f, 100.f, 0.f, 0.f, 10.f};
+
+    gp_mesh_t sharp_mesh;
+    GP_CALL( __test_render, (_canvas, GP_LINE_JOIN_MITER, sharp, 3, &sharp_mesh) );
+
+    if( sharp_mesh.vertex_count != 4 * 2 )
+    {
+        return GP_FAILURE;
+    }
+
+    for( gp_uint16_t index = 0; index != sharp_mesh.vertex_count; ++index )
+    {
+        if( vertices[index].x > 102.001f )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    if( __has_vertex( sharp_mesh.vertex_count, 100.f, -2.f ) == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_join_counts( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_miter_limit( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,248 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_t
+{
+    float x;
+    float y;
+    gp_uint32_t c;
+    float u;
+    float v;
+} gl_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct test_cache_t
+{
+    gp_uint64_t hash;
+    void * blob;
+    gp_size_t size;
+
+    gp_uint32_t reads;
+    gp_uint32_t hits;
+    gp_uint32_t writes;
+} test_cache_t;
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __cache_read( gp_uint64_t _hash, const void ** _blob, gp_size_t * _size, void * _ud )
+{
+    test_cache_t * cache = (test_cache_t *)_ud;
+
+    ++cache->reads;
+
+    if( cache->blob == NULL || cache->hash != _hash )
+    {
+        *_blob = NULL;
+
+        return GP_SUCCESSFUL;
+    }
+
+    ++cache->hits;
+
+    *_blob = cache->blob;
+    *_size = cache->size;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __cache_write( gp_uint64_t _hash, const void * _blob, gp_size_t _size, void * _ud )
+{
+    test_cache_t * cache = (test_cache_t *)_ud;
+
+    ++cache->writes;
+
+    free( cache->blob );
+
+    cache->hash = _hash;
+    cache->blob = malloc( _size );
+    cache->size = _size;
+
+    memcpy( cache->blob, _blob, _size );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gl_vertex_t vertices0[4096];
+static gl_vertex_t vertices1[4096];
+static gp_uint16_t indices0[8192];
+static gp_uint16_t indices1[8192];
+//////////////////////////////////////////////////////////////////////////
+static void __setup_mesh( gp_mesh_t * _mesh, gl_vertex_t * _vertices, gp_uint16_t * _indices )
+{
+    _mesh->positions_buffer = _vertices;
+    _mesh->positions_offset = offsetof( gl_vertex_t, x );
+    _mesh->positions_stride = sizeof( gl_vertex_t );
+
+    _mesh->colors_buffer = _vertices;
+    _mesh->colors_offset = offsetof( gl_vertex_t, c );
+    _mesh->colors_stride = sizeof( gl_vertex_t );
+
+    _mesh->uv_buffer = _vertices;
+    _mesh->uv_offset = offsetof( gl_vertex_t, u );
+    _mesh->uv_stride = sizeof( gl_vertex_t );
+
+    _mesh->indices_buffer = _indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh_cache( gp_canvas_t * _canvas, test_cache_t * _cache )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.25f, 1.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 0.f) );
+    GP_CALL( gp_quadratic_curve_to, (_canvas, 150.f, 0.f, 150.f, 50.f) );
+
+    GP_CALL( gp_rect, (_canvas, 10.f, 200.f, 40.f, 20.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 60.f, 200.f, 40.f, 20.f, 5.f) );
+    GP_CALL( gp_circle, (_canvas, 300.f, 200.f, 20.f) );
+
+    gp_mesh_cache_t cache;
+    cache.read = &__cache_read;
+    cache.write = &__cache_write;
+    cache.ud = _cache;
+
+    gp_mesh_t mesh0;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh0) );
+
+    if( mesh0.vertex_count > 4096 || mesh0.index_count > 8192 )
+    {
+        return GP_FAILURE;
+    }
+
+    __setup_mesh( &mesh0, vertices0, indices0 );
+
+    GP_CALL( gp_render, (_canvas, &mesh0) );
+
+    gp_mesh_t mesh1;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh1) );
+
+    __setup_mesh( &mesh1, vertices1, indices1 );
+
+    GP_CALL( gp_render_cached, (_canvas, &mesh1, &cache) );
+
+    if( _cache->hits != 0 || _cache->writes != 1 )
+    {
+        return GP_FAILURE;
+    }
+
+    memset( vertices1, 0, sizeof( vertices1 ) );
+    memset( indices1, 0, sizeof( indices1 ) );
+
+    GP_CALL( gp_render_cached, (_canvas, &mesh1, &cache) );
+
+    if( _cache->hits != 1 || _cache->writes != 1 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( memcmp( vertices0, vertices1, sizeof( gl_vertex_t ) * mesh0.vertex_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( memcmp( indices0, indices1, sizeof( gp_uint16_t ) * mesh0.index_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_uint64_t hash0;
+    GP_CALL( gp_calculate_mesh_hash, (_canvas, &mesh1, &hash0) );
+
+    mesh1.color.a = 0.5f;
+
+    gp_uint64_t hash1;
+    GP_CALL( gp_calculate_mesh_hash, (_canvas, &mesh1, &hash1) );
+
+    if( hash0 == hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh1.color.a = 1.f;
+    mesh1.colors_format = GP_COLOR_FORMAT_ABGR;
+
+    GP_CALL( gp_calculate_mesh_hash, (_canvas, &mesh1, &hash1) );
+
+    if( hash0 == hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh1.colors_format = GP_COLOR_FORMAT_ARGB;
+
+    GP_CALL( gp_set_color, (_canvas, 1.f, 1.f, 1.f, 1.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 10.f) );
+
+    GP_CALL( gp_calculate_mesh_hash, (_canvas, &mesh1, &hash1) );
+
+    if( hash0 == hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    test_cache_t cache;
+    cache.hash = 0;
+    cache.blob = NULL;
+    cache.size = 0;
+    cache.reads = 0;
+    cache.hits = 0;
+    cache.writes = 0;
+
+    if( __test_mesh_cache( canvas, &cache ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    free( cache.blob );
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
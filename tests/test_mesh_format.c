@@ -0,0 +1,244 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_t
+{
+    float x;
+    float y;
+    float u;
+    float v;
+} gl_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_packed_t
+{
+    gp_int16_t x;
+    gp_int16_t y;
+    gp_uint16_t u;
+    gp_uint16_t v;
+} gl_vertex_packed_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __test_equal( float _a, float _b, float _eps )
+{
+    float d = _a - _b;
+
+    if( d < -_eps || d > _eps )
+    {
+        return GP_FALSE;
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh_format( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_outline_width, (_canvas, 2.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 10.f, 20.f) );
+    GP_CALL( gp_quadratic_curve_to, (_canvas, 150.f, 20.f, 150.f, 120.f) );
+
+    GP_CALL( gp_rect, (_canvas, 40.f, 40.f, 100.f, 50.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 30.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    gl_vertex_t vertices[1024];
+    gl_vertex_packed_t vertices_packed[1024];
+
+    if( mesh.vertex_count > 1024 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.positions_buffer = vertices;
+    mesh.positions_offset = offsetof( gl_vertex_t, x );
+    mesh.positions_stride = sizeof( gl_vertex_t );
+
+    mesh.uv_buffer = vertices;
+    mesh.uv_offset = offsetof( gl_vertex_t, u );
+    mesh.uv_stride = sizeof( gl_vertex_t );
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    mesh.positions_buffer = vertices_packed;
+    mesh.positions_offset = offsetof( gl_vertex_packed_t, x );
+    mesh.positions_stride = sizeof( gl_vertex_packed_t );
+    mesh.positions_format = GP_POSITION_FORMAT_SHORT2;
+    mesh.positions_origin_x = 100.f;
+    mesh.positions_origin_y = 50.f;
+    mesh.positions_scale = 8.f;
+
+    mesh.uv_buffer = vertices_packed;
+    mesh.uv_offset = offsetof( gl_vertex_packed_t, u );
+    mesh.uv_stride = sizeof( gl_vertex_packed_t );
+    mesh.uv_format = GP_UV_FORMAT_UNORM16;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    for( gp_uint32_t index = 0; index != mesh.vertex_count; ++index )
+    {
+        const gl_vertex_t * v = vertices + index;
+        const gl_vertex_packed_t * vp = vertices_packed + index;
+
+        if( __test_equal( v->x, 100.f + vp->x / 8.f, 0.07f ) == GP_FALSE || __test_equal( v->y, 50.f + vp->y / 8.f, 0.07f ) == GP_FALSE )
+        {
+            return GP_FAILURE;
+        }
+
+        if( __test_equal( v->u, vp->u / 65535.f, 0.0001f ) == GP_FALSE || __test_equal( v->v, vp->v / 65535.f, 0.0001f ) == GP_FALSE )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    mesh.uv_format = GP_UV_FORMAT_HALF2;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    const gp_uint16_t half_one = 0x3c00;
+    const gp_uint16_t half_zero = 0x0000;
+
+    for( gp_uint32_t index = 0; index != mesh.vertex_count; ++index )
+    {
+        const gl_vertex_t * v = vertices + index;
+        const gl_vertex_packed_t * vp = vertices_packed + index;
+
+        if( v->v == 1.f && vp->v != half_one )
+        {
+            return GP_FAILURE;
+        }
+
+        if( v->v == 0.f && vp->v != half_zero )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh_color_format( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.f, 0.5f) );
+
+    GP_CALL( gp_rect, (_canvas, 40.f, 40.f, 100.f, 50.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    gp_argb_t colors[64];
+
+    if( mesh.vertex_count > 64 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.colors_buffer = colors;
+    mesh.colors_offset = 0;
+    mesh.colors_stride = sizeof( gp_argb_t );
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    if( colors[0] != 0x7fff7f00 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.colors_format = GP_COLOR_FORMAT_ABGR;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    if( colors[0] != 0x7f007fff )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.colors_format = GP_COLOR_FORMAT_RGBA;
+    mesh.colors_premultiplied = GP_TRUE;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    if( colors[0] != 0x7f3f007f )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.colors_format = GP_COLOR_FORMAT_ARGB;
+    mesh.colors_premultiplied = GP_FALSE;
+    mesh.color.g = 0.5f;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    if( colors[0] != 0x7fff3f00 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_mesh_format( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_clear( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_mesh_color_format( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,266 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct raster_vertex_t
+{
+    float x;
+    float y;
+    gp_argb_t color;
+} raster_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+#define RASTER_WIDTH 150
+#define RASTER_HEIGHT 100
+//////////////////////////////////////////////////////////////////////////
+static raster_vertex_t vertices[1024];
+static gp_uint16_t indices[4096];
+static gp_uint8_t pixels[RASTER_HEIGHT][RASTER_WIDTH][4];
+static gp_uint8_t reference[RASTER_HEIGHT][RASTER_WIDTH][4];
+//////////////////////////////////////////////////////////////////////////
+static void __test_clear( void )
+{
+    for( gp_uint32_t y = 0; y != RASTER_HEIGHT; ++y )
+    {
+        for( gp_uint32_t x = 0; x != RASTER_WIDTH; ++x )
+        {
+            pixels[y][x][0] = 0;
+            pixels[y][x][1] = 0;
+            pixels[y][x][2] = 0;
+            pixels[y][x][3] = 255;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh( gp_canvas_t * _canvas, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count > 1024 || _mesh->index_count > 4096 )
+    {
+        return GP_FAILURE;
+    }
+
+    _mesh->positions_buffer = vertices;
+    _mesh->positions_offset = offsetof( raster_vertex_t, x );
+    _mesh->positions_stride = sizeof( raster_vertex_t );
+
+    _mesh->colors_buffer = vertices;
+    _mesh->colors_offset = offsetof( raster_vertex_t, color );
+    _mesh->colors_stride = sizeof( raster_vertex_t );
+
+    _mesh->indices_buffer = indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_coverage( gp_canvas_t * _canvas, gp_raster_t * _raster, const gp_image_t * _target )
+{
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_thickness, (_canvas, 3.f) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.f, 0.f, 1.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rect, (_canvas, 16.f, 16.f, 64.f, 32.f) );
+    GP_CALL( gp_rect, (_canvas, 80.f, 16.f, 40.f, 32.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh) );
+
+    __test_clear();
+
+    gp_uint32_t tile_count;
+    GP_CALL( gp_raster_bin, (_raster, &mesh, _target, GP_NULLPTR, GP_RASTER_BLEND_LINEAR, &tile_count) );
+    GP_CALL( gp_raster_tiles, (_raster) );
+
+    gp_uint32_t covered = 0;
+
+    for( gp_uint32_t y = 0; y != RASTER_HEIGHT; ++y )
+    {
+        for( gp_uint32_t x = 0; x != RASTER_WIDTH; ++x )
+        {
+            const gp_uint8_t * p = pixels[y][x];
+
+            gp_bool_t inside = x >= 14 && x <= 120 && y >= 14 && y <= 48;
+
+            if( inside == GP_TRUE && (p[0] != 255 || p[1] != 0 || p[2] != 0 || p[3] != 255) )
+            {
+                return GP_FAILURE;
+            }
+
+            if( inside == GP_FALSE && (p[0] != 0 || p[1] != 0 || p[2] != 0 || p[3] != 255) )
+            {
+                return GP_FAILURE;
+            }
+
+            covered += inside;
+        }
+    }
+
+    if( covered != 107 * 35 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_tile_order( gp_canvas_t * _canvas, gp_raster_t * _raster, const gp_image_t * _target )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_color, (_canvas, 0.2f, 0.6f, 1.f, 0.75f) );
+    GP_CALL( gp_set_thickness, (_canvas, 6.f) );
+    GP_CALL( gp_move_to, (_canvas, 5.f, 90.f) );
+    GP_CALL( gp_bezier_curve_to, (_canvas, 40.f, -20.f, 110.f, 120.f, 145.f, 10.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.f, 0.5f) );
+    GP_CALL( gp_circle, (_canvas, 75.f, 50.f, 40.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 50.f, 30.f, 90.f, 60.f, 12.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh) );
+
+    gp_uint32_t tile_count;
+
+    __test_clear();
+
+    GP_CALL( gp_raster_bin, (_raster, &mesh, _target, GP_NULLPTR, GP_RASTER_BLEND_SRGB, &tile_count) );
+    GP_CALL( gp_raster_tiles, (_raster) );
+
+    memcpy( reference, pixels, sizeof( pixels ) );
+
+    __test_clear();
+
+    GP_CALL( gp_raster_bin, (_raster, &mesh, _target, GP_NULLPTR, GP_RASTER_BLEND_SRGB, &tile_count) );
+
+    if( tile_count != 6 )
+    {
+        return GP_FAILURE;
+    }
+
+    for( gp_uint32_t tile = tile_count; tile != 0; --tile )
+    {
+        GP_CALL( gp_raster_tile, (_raster, tile - 1) );
+    }
+
+    if( memcmp( reference, pixels, sizeof( pixels ) ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_blend( gp_canvas_t * _canvas, gp_raster_t * _raster, const gp_image_t * _target, gp_raster_blend_e _blend, gp_uint8_t _expected )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 1.f, 1.f, 0.5f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rect, (_canvas, 0.f, 0.f, 32.f, 32.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh) );
+
+    __test_clear();
+
+    gp_uint32_t tile_count;
+    GP_CALL( gp_raster_bin, (_raster, &mesh, _target, GP_NULLPTR, _blend, &tile_count) );
+    GP_CALL( gp_raster_tiles, (_raster) );
+
+    const gp_uint8_t * p = pixels[10][10];
+
+    if( p[0] < _expected - 1 || p[0] > _expected + 1 || p[3] != 255 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_raster( gp_canvas_t * _canvas, gp_raster_t * _raster )
+{
+    gp_image_t target;
+    target.pixels = pixels;
+    target.width = RASTER_WIDTH;
+    target.height = RASTER_HEIGHT;
+    target.pitch = RASTER_WIDTH * 4;
+
+    GP_CALL( __test_coverage, (_canvas, _raster, &target) );
+    GP_CALL( __test_tile_order, (_canvas, _raster, &target) );
+    GP_CALL( __test_blend, (_canvas, _raster, &target, GP_RASTER_BLEND_LINEAR, 128) );
+    GP_CALL( __test_blend, (_canvas, _raster, &target, GP_RASTER_BLEND_SRGB, 188) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_raster_t * raster;
+    if( gp_raster_create( &raster, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_raster( canvas, raster ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_raster_destroy( raster ) == GP_FAILURE || gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
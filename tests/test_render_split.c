@@ -0,0 +1,319 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_t
+{
+    float x;
+    float y;
+    gp_uint32_t c;
+    float z;
+} gl_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gl_vertex_t vertices[4096];
+static gp_uint16_t indices[8192];
+static gp_uint16_t indices_split[8192];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh( const gp_canvas_t * _canvas, gp_mesh_t * _mesh, gp_uint16_t * _indices )
+{
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count > 4096 || _mesh->index_count > 8192 )
+    {
+        return GP_FAILURE;
+    }
+
+    _mesh->positions_buffer = vertices;
+    _mesh->positions_offset = offsetof( gl_vertex_t, x );
+    _mesh->positions_stride = sizeof( gl_vertex_t );
+
+    _mesh->colors_buffer = vertices;
+    _mesh->colors_offset = offsetof( gl_vertex_t, c );
+    _mesh->colors_stride = sizeof( gl_vertex_t );
+
+    _mesh->depth_buffer = vertices;
+    _mesh->depth_offset = offsetof( gl_vertex_t, z );
+    _mesh->depth_stride = sizeof( gl_vertex_t );
+
+    _mesh->indices_buffer = _indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_bool_t __test_triangle_opaque( const gp_uint16_t * _triangle )
+{
+    for( gp_uint32_t index = 0; index != 3; ++index )
+    {
+        if( (vertices[_triangle[index]].c >> 24) != 0xff )
+        {
+            return GP_FALSE;
+        }
+    }
+
+    return GP_TRUE;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_render_split( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 100.f, 50.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 30.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    GP_CALL( gp_set_color, (_canvas, 1.f, 1.f, 1.f, 0.5f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 40.f, 40.f, 100.f, 50.f, 8.f) );
+
+    GP_CALL( gp_set_color, (_canvas, 1.f, 1.f, 1.f, 1.f) );
+    GP_CALL( gp_set_thickness, (_canvas, 6.f) );
+    GP_CALL( gp_move_to, (_canvas, 0.f, 200.f) );
+    GP_CALL( gp_line_to, (_canvas, 200.f, 220.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh, indices) );
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    gp_mesh_t mesh_split;
+    GP_CALL( __test_mesh, (_canvas, &mesh_split, indices_split) );
+
+    gp_uint16_t opaque_index_count;
+    GP_CALL( gp_render_split, (_canvas, &mesh_split, &opaque_index_count) );
+
+    if( opaque_index_count == 0 || opaque_index_count == mesh.index_count || opaque_index_count % 3 != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_uint32_t opaque_iterator = opaque_index_count;
+    gp_uint32_t blend_iterator = opaque_index_count;
+
+    for( gp_uint32_t iterator = 0; iterator != mesh.index_count; iterator += 3 )
+    {
+        const gp_uint16_t * triangle = indices + iterator;
+        const gp_uint16_t * triangle_split;
+
+        if( __test_triangle_opaque( triangle ) == GP_TRUE )
+        {
+            opaque_iterator -= 3;
+
+            triangle_split = indices_split + opaque_iterator;
+        }
+        else
+        {
+            triangle_split = indices_split + blend_iterator;
+
+            blend_iterator += 3;
+        }
+
+        if( triangle[0] != triangle_split[0] || triangle[1] != triangle_split[1] || triangle[2] != triangle_split[2] )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    if( opaque_iterator != 0 || blend_iterator != mesh.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_uint32_t depth_count = 1;
+
+    for( gp_uint32_t index = 1; index < mesh.vertex_count; ++index )
+    {
+        if( vertices[index].z > vertices[index - 1].z || vertices[index].z <= 0.f )
+        {
+            return GP_FAILURE;
+        }
+
+        if( vertices[index].z != vertices[index - 1].z )
+        {
+            ++depth_count;
+        }
+    }
+
+    if( depth_count != 4 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_render_split_blend( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_color, (_canvas, 1.f, 1.f, 1.f, 0.5f) );
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 100.f, 50.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    GP_CALL( gp_set_blend, (_canvas, GP_FALSE) );
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 30.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh, indices) );
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    gp_mesh_t mesh_split;
+    GP_CALL( __test_mesh, (_canvas, &mesh_split, indices_split) );
+
+    gp_uint16_t opaque_index_count;
+    GP_CALL( gp_render_split, (_canvas, &mesh_split, &opaque_index_count) );
+
+    gp_uint32_t blend_index_count = 0;
+
+    for( gp_uint32_t iterator = 0; iterator != mesh.index_count; iterator += 3 )
+    {
+        if( vertices[indices[iterator]].y < 65.f )
+        {
+            blend_index_count += 3;
+        }
+    }
+
+    if( blend_index_count == 0 || opaque_index_count + blend_index_count != mesh.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_render_split_ranges( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 100.f, 50.f) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 1.f, 1.f, 0.5f) );
+    GP_CALL( gp_rect, (_canvas, 40.f, 40.f, 100.f, 50.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    GP_CALL( gp_set_material, (_canvas, 1) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 1.f, 1.f, 1.f) );
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 30.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_draw_range_t ranges[4];
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh, indices) );
+
+    if( mesh.range_count != 2 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.ranges_buffer = ranges;
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    gp_draw_range_t ranges_split[4];
+
+    gp_mesh_t mesh_split;
+    GP_CALL( __test_mesh, (_canvas, &mesh_split, indices_split) );
+
+    mesh_split.ranges_buffer = ranges_split;
+
+    gp_uint16_t opaque_index_count;
+    GP_CALL( gp_render_split, (_canvas, &mesh_split, &opaque_index_count) );
+
+    gp_uint32_t opaque_total = 0;
+
+    for( gp_uint32_t index = 0; index != mesh.range_count; ++index )
+    {
+        const gp_draw_range_t * range = ranges + index;
+        const gp_draw_range_t * range_split = ranges_split + index;
+
+        if( range->first != range_split->first || range->count != range_split->count || range_split->opaque_count == 0 || range_split->opaque_count == range_split->count )
+        {
+            return GP_FAILURE;
+        }
+
+        for( gp_uint32_t iterator = 0; iterator != range_split->count; iterator += 3 )
+        {
+            gp_bool_t opaque = __test_triangle_opaque( indices_split + range_split->first + iterator );
+
+            if( opaque != (iterator < range_split->opaque_count ? GP_TRUE : GP_FALSE) )
+            {
+                return GP_FAILURE;
+            }
+        }
+
+        opaque_total += range_split->opaque_count;
+    }
+
+    if( opaque_total != opaque_index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_render_split( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_render_split_blend( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_render_split_ranges( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
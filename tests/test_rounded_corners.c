@@ -0,0 +1,237 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct corner_vertex_t
+{
+    float x;
+    float y;
+    gp_argb_t color;
+} corner_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+#define CORNER_SENTINEL (12345.f)
+//////////////////////////////////////////////////////////////////////////
+static corner_vertex_t vertices[1024 + 1];
+static gp_uint16_t indices[4096];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_mesh( const gp_canvas_t * _canvas, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count == 0 || _mesh->vertex_count > 1024 || _mesh->index_count > 4096 )
+    {
+        return GP_FAILURE;
+    }
+
+    vertices[_mesh->vertex_count].x = CORNER_SENTINEL;
+
+    _mesh->positions_buffer = vertices;
+    _mesh->positions_offset = offsetof( corner_vertex_t, x );
+    _mesh->positions_stride = sizeof( corner_vertex_t );
+
+    _mesh->colors_buffer = vertices;
+    _mesh->colors_offset = offsetof( corner_vertex_t, color );
+    _mesh->colors_stride = sizeof( corner_vertex_t );
+
+    _mesh->indices_buffer = indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    if( vertices[_mesh->vertex_count].x != CORNER_SENTINEL )
+    {
+        return GP_FAILURE;
+    }
+
+    for( gp_uint16_t index = 0; index != _mesh->index_count; ++index )
+    {
+        if( indices[index] >= _mesh->vertex_count )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_corner_variants( gp_canvas_t * _canvas )
+{
+    for( gp_uint32_t variant = 0; variant != 5; ++variant )
+    {
+        GP_CALL( gp_canvas_clear, (_canvas) );
+
+        GP_CALL( gp_set_rect_quality, (_canvas, 6) );
+        GP_CALL( gp_set_thickness, (_canvas, 4.f) );
+        GP_CALL( gp_set_penumbra, (_canvas, (variant & 1) != 0 ? 1.f : 0.f) );
+        GP_CALL( gp_set_outline_width, (_canvas, variant == 4 ? 2.f : 0.f) );
+
+        if( variant >= 2 )
+        {
+            GP_CALL( gp_begin_fill, (_canvas) );
+        }
+
+        GP_CALL( gp_rounded_rect_corners, (_canvas, 10.f, 10.f, 100.f, 40.f, 0.f, 8.f, 0.f, 16.f) );
+        GP_CALL( gp_rounded_rect_corners, (_canvas, 10.f, 60.f, 100.f, 40.f, 12.f, 12.f, 0.f, 0.f) );
+        GP_CALL( gp_rounded_rect, (_canvas, 10.f, 110.f, 100.f, 40.f, 10.f) );
+
+        if( variant >= 2 )
+        {
+            GP_CALL( gp_end_fill, (_canvas) );
+        }
+
+        gp_mesh_t mesh;
+        GP_CALL( __test_mesh, (_canvas, &mesh) );
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_corner_sharp( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_outline_width, (_canvas, 0.f) );
+    GP_CALL( gp_set_thickness, (_canvas, 2.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rounded_rect_corners, (_canvas, 10.f, 20.f, 100.f, 50.f, 0.f, 10.f, 10.f, 10.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_mesh_t mesh;
+    GP_CALL( __test_mesh, (_canvas, &mesh) );
+
+    gp_bool_t corner = GP_FALSE;
+
+    for( gp_uint16_t index = 0; index != mesh.vertex_count; ++index )
+    {
+        const corner_vertex_t * v = vertices + index;
+
+        if( v->x < 9.f || v->y < 19.f )
+        {
+            return GP_FAILURE;
+        }
+
+        if( v->x == 9.f && v->y == 19.f )
+        {
+            corner = GP_TRUE;
+        }
+    }
+
+    if( corner == GP_FALSE )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_corner_uniform( gp_canvas_t * _corners, gp_canvas_t * _rounded )
+{
+    GP_CALL( gp_canvas_clear, (_corners) );
+    GP_CALL( gp_canvas_clear, (_rounded) );
+
+    GP_CALL( gp_rounded_rect_corners, (_corners, 10.f, 20.f, 100.f, 50.f, 7.f, 7.f, 7.f, 7.f) );
+    GP_CALL( gp_rounded_rect, (_rounded, 10.f, 20.f, 100.f, 50.f, 7.f) );
+
+    gp_uint64_t corners_hash;
+    GP_CALL( gp_canvas_get_hash, (_corners, &corners_hash) );
+
+    gp_uint64_t rounded_hash;
+    GP_CALL( gp_canvas_get_hash, (_rounded, &rounded_hash) );
+
+    if( corners_hash != rounded_hash )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_corners) );
+    GP_CALL( gp_canvas_clear, (_rounded) );
+
+    GP_CALL( gp_rounded_rect_corners, (_corners, 10.f, 20.f, 100.f, 50.f, 0.f, 0.f, 0.f, 0.f) );
+    GP_CALL( gp_rect, (_rounded, 10.f, 20.f, 100.f, 50.f) );
+
+    gp_mesh_t corners_mesh;
+    GP_CALL( gp_calculate_mesh_size, (_corners, &corners_mesh) );
+
+    gp_mesh_t rect_mesh;
+    GP_CALL( gp_calculate_mesh_size, (_rounded, &rect_mesh) );
+
+    if( corners_mesh.vertex_count != rect_mesh.vertex_count || corners_mesh.index_count != rect_mesh.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * rounded;
+    if( gp_canvas_create( &rounded, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_corner_variants( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_corner_sharp( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_corner_uniform( canvas, rounded ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE || gp_canvas_destroy( rounded ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,194 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_t
+{
+    float x;
+    float y;
+    gp_uint32_t c;
+    gp_sdf_t sdf;
+} gl_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_sdf( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_thickness, (_canvas, 4.f) );
+    GP_CALL( gp_set_penumbra, (_canvas, 1.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 0.f) );
+
+    GP_CALL( gp_set_sdf, (_canvas, GP_TRUE) );
+
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 50.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 200.f, 100.f, 100.f, 50.f, 10.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_ellipse, (_canvas, 100.f, 300.f, 50.f, 25.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.vertex_count != 8 + 3 * 4 || mesh.index_count != 18 + 3 * 6 )
+    {
+        return GP_FAILURE;
+    }
+
+    gl_vertex_t vertices[20];
+    gp_uint16_t indices[36];
+
+    mesh.positions_buffer = vertices;
+    mesh.positions_offset = offsetof( gl_vertex_t, x );
+    mesh.positions_stride = sizeof( gl_vertex_t );
+
+    mesh.colors_buffer = vertices;
+    mesh.colors_offset = offsetof( gl_vertex_t, c );
+    mesh.colors_stride = sizeof( gl_vertex_t );
+
+    mesh.sdf_buffer = vertices;
+    mesh.sdf_offset = offsetof( gl_vertex_t, sdf );
+    mesh.sdf_stride = sizeof( gl_vertex_t );
+
+    mesh.indices_buffer = indices;
+    mesh.indices_offset = 0;
+    mesh.indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    for( gp_uint32_t index = 0; index != 8; ++index )
+    {
+        if( vertices[index].sdf.type != GP_SDF_TYPE_NONE )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    const gp_sdf_type_e types[3] = {GP_SDF_TYPE_ROUNDED_RECT_STROKE, GP_SDF_TYPE_ELLIPSE_STROKE, GP_SDF_TYPE_ELLIPSE_FILL};
+
+    for( gp_uint32_t index = 0; index != 12; ++index )
+    {
+        const gl_vertex_t * v = vertices + 8 + index;
+
+        if( v->sdf.type != (gp_uint32_t)types[index / 4] )
+        {
+            return GP_FAILURE;
+        }
+
+        if( v->sdf.thickness != 4.f || v->sdf.penumbra != 1.f )
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    const gl_vertex_t * rr = vertices + 8;
+
+    if( rr[0].x != 198.f || rr[0].y != 98.f || rr[2].x != 302.f || rr[2].y != 152.f )
+    {
+        return GP_FAILURE;
+    }
+
+    if( rr[0].sdf.x != -52.f || rr[0].sdf.y != -27.f || rr[0].sdf.width != 50.f || rr[0].sdf.height != 25.f || rr[0].sdf.radius != 10.f )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_sdf_outline_size( gp_canvas_t * _canvas, gp_bool_t _sdf, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_set_sdf, (_canvas, _sdf) );
+    GP_CALL( gp_set_penumbra, (_canvas, 0.f) );
+    GP_CALL( gp_set_outline_width, (_canvas, 2.f) );
+    GP_CALL( gp_set_outline_color, (_canvas, 0.f, 0.f, 0.f, 1.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_rounded_rect, (_canvas, 200.f, 100.f, 100.f, 50.f, 10.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_sdf_outline( gp_canvas_t * _canvas )
+{
+    gp_mesh_t sdf_mesh;
+    GP_CALL( __test_sdf_outline_size, (_canvas, GP_TRUE, &sdf_mesh) );
+
+    gp_mesh_t geometry_mesh;
+    GP_CALL( __test_sdf_outline_size, (_canvas, GP_FALSE, &geometry_mesh) );
+
+    if( sdf_mesh.vertex_count == 4 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( sdf_mesh.vertex_count != geometry_mesh.vertex_count || sdf_mesh.index_count != geometry_mesh.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_sdf( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_sdf_outline( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,213 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gl_vertex_t
+{
+    float x;
+    float y;
+    gp_uint32_t c;
+    float u;
+    float v;
+} gl_vertex_t;
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_draw( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_set_thickness, (_canvas, 4.f) );
+    GP_CALL( gp_set_outline_width, (_canvas, 1.f) );
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.5f, 0.25f, 1.f) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 0.f) );
+    GP_CALL( gp_set_color, (_canvas, 0.f, 0.5f, 1.f, 0.5f) );
+    GP_CALL( gp_quadratic_curve_to, (_canvas, 150.f, 0.f, 150.f, 50.f) );
+    GP_CALL( gp_bezier_curve_to, (_canvas, 150.f, 100.f, 50.f, 100.f, 50.f, 150.f) );
+
+    const float pattern[] = {10.f, 5.f};
+    GP_CALL( gp_set_dash, (_canvas, pattern, 2, 3.f) );
+    GP_CALL( gp_set_line_join, (_canvas, GP_LINE_JOIN_ROUND) );
+
+    GP_CALL( gp_move_to, (_canvas, 200.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 250.f, 50.f) );
+    GP_CALL( gp_line_to, (_canvas, 300.f, 0.f) );
+
+    GP_CALL( gp_set_outline_width, (_canvas, 0.f) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 200.f, 40.f, 20.f) );
+    GP_CALL( gp_rounded_rect, (_canvas, 60.f, 200.f, 40.f, 20.f, 5.f) );
+
+    GP_CALL( gp_begin_fill, (_canvas) );
+    GP_CALL( gp_set_color, (_canvas, 0.25f, 1.f, 0.f, 1.f) );
+    GP_CALL( gp_ellipse, (_canvas, 200.f, 200.f, 30.f, 15.f) );
+    GP_CALL( gp_end_fill, (_canvas) );
+
+    GP_CALL( gp_set_sdf, (_canvas, GP_TRUE) );
+    GP_CALL( gp_circle, (_canvas, 300.f, 200.f, 20.f) );
+
+    const float stops[] = {0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 1.f};
+
+    GP_CALL( gp_set_sdf, (_canvas, GP_FALSE) );
+    GP_CALL( gp_set_linear_gradient, (_canvas, 10.f, 250.f, 50.f, 250.f, stops, 2) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 250.f, 40.f, 20.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_render( const gp_canvas_t * _canvas, gl_vertex_t * _vertices, gp_uint16_t * _indices, gp_mesh_t * _mesh )
+{
+    GP_CALL( gp_calculate_mesh_size, (_canvas, _mesh) );
+
+    if( _mesh->vertex_count > 8192 || _mesh->index_count > 16384 )
+    {
+        return GP_FAILURE;
+    }
+
+    _mesh->positions_buffer = _vertices;
+    _mesh->positions_offset = offsetof( gl_vertex_t, x );
+    _mesh->positions_stride = sizeof( gl_vertex_t );
+
+    _mesh->colors_buffer = _vertices;
+    _mesh->colors_offset = offsetof( gl_vertex_t, c );
+    _mesh->colors_stride = sizeof( gl_vertex_t );
+
+    _mesh->uv_buffer = _vertices;
+    _mesh->uv_offset = offsetof( gl_vertex_t, u );
+    _mesh->uv_stride = sizeof( gl_vertex_t );
+
+    _mesh->indices_buffer = _indices;
+    _mesh->indices_offset = 0;
+    _mesh->indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, _mesh) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gl_vertex_t vertices0[8192];
+static gl_vertex_t vertices1[8192];
+static gp_uint16_t indices0[16384];
+static gp_uint16_t indices1[16384];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_serialize( gp_canvas_t * _canvas0, gp_canvas_t * _canvas1 )
+{
+    GP_CALL( __test_draw, (_canvas0) );
+
+    gp_size_t size;
+    GP_CALL( gp_canvas_save_to_memory, (_canvas0, GP_NULLPTR, 0, &size) );
+
+    void * buffer = malloc( size );
+
+    if( gp_canvas_save_to_memory( _canvas0, buffer, size - 1, &size ) == GP_SUCCESSFUL )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_save_to_memory, (_canvas0, buffer, size, &size) );
+
+    if( gp_canvas_load_from_memory( _canvas1, buffer, size - 1 ) == GP_SUCCESSFUL )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_load_from_memory, (_canvas1, buffer, size) );
+
+    free( buffer );
+
+    gp_uint64_t hash0;
+    GP_CALL( gp_canvas_get_hash, (_canvas0, &hash0) );
+
+    gp_uint64_t hash1;
+    GP_CALL( gp_canvas_get_hash, (_canvas1, &hash1) );
+
+    if( hash0 != hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_mesh_t mesh0;
+    GP_CALL( __test_render, (_canvas0, vertices0, indices0, &mesh0) );
+
+    gp_mesh_t mesh1;
+    GP_CALL( __test_render, (_canvas1, vertices1, indices1, &mesh1) );
+
+    if( mesh0.vertex_count != mesh1.vertex_count || mesh0.index_count != mesh1.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    if( memcmp( vertices0, vertices1, sizeof( gl_vertex_t ) * mesh0.vertex_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    if( memcmp( indices0, indices1, sizeof( gp_uint16_t ) * mesh0.index_count ) != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas0;
+    if( gp_canvas_create( &canvas0, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * canvas1;
+    if( gp_canvas_create( &canvas1, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_serialize( canvas0, canvas1 ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas0 ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas1 ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,323 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_retained( gp_canvas_t * _canvas, gp_shape_handle_t * _rect, gp_shape_handle_t * _circle )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.f, 0.f, 1.f) );
+
+    GP_CALL( gp_rect, (_canvas, 0.f, 0.f, 10.f, 10.f) );
+    GP_CALL( gp_shape_retain, (_canvas, GP_SHAPE_TYPE_RECT, _rect) );
+
+    GP_CALL( gp_circle, (_canvas, 50.f, 50.f, 10.f) );
+    GP_CALL( gp_shape_retain, (_canvas, GP_SHAPE_TYPE_ELLIPSE, _circle) );
+
+    GP_CALL( gp_rect, (_canvas, 100.f, 100.f, 5.f, 5.f) );
+
+    GP_CALL( gp_shape_set_position, (_canvas, *_rect, 20.f, 20.f) );
+    GP_CALL( gp_shape_set_size, (_canvas, *_rect, 30.f, 30.f) );
+    GP_CALL( gp_shape_set_color, (_canvas, *_circle, 0.f, 1.f, 0.f, 1.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_direct( gp_canvas_t * _canvas, gp_bool_t _circle )
+{
+    GP_CALL( gp_set_color, (_canvas, 1.f, 0.f, 0.f, 1.f) );
+    GP_CALL( gp_rect, (_canvas, 20.f, 20.f, 30.f, 30.f) );
+
+    if( _circle == GP_TRUE )
+    {
+        GP_CALL( gp_set_color, (_canvas, 0.f, 1.f, 0.f, 1.f) );
+        GP_CALL( gp_circle, (_canvas, 50.f, 50.f, 10.f) );
+        GP_CALL( gp_set_color, (_canvas, 1.f, 0.f, 0.f, 1.f) );
+    }
+
+    GP_CALL( gp_rect, (_canvas, 100.f, 100.f, 5.f, 5.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_equal( const gp_canvas_t * _retained, const gp_canvas_t * _direct )
+{
+    gp_uint64_t retained_hash;
+    GP_CALL( gp_canvas_get_hash, (_retained, &retained_hash) );
+
+    gp_uint64_t direct_hash;
+    GP_CALL( gp_canvas_get_hash, (_direct, &direct_hash) );
+
+    if( retained_hash != direct_hash )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_mesh_t retained_mesh;
+    GP_CALL( gp_calculate_mesh_size, (_retained, &retained_mesh) );
+
+    gp_mesh_t direct_mesh;
+    GP_CALL( gp_calculate_mesh_size, (_direct, &direct_mesh) );
+
+    if( retained_mesh.vertex_count != direct_mesh.vertex_count || retained_mesh.index_count != direct_mesh.index_count )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_shape_handles( gp_canvas_t * _retained, gp_canvas_t * _direct )
+{
+    gp_shape_handle_t rect;
+    gp_shape_handle_t circle;
+    GP_CALL( __test_retained, (_retained, &rect, &circle) );
+
+    if( rect == circle )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_direct, (_direct, GP_TRUE) );
+    GP_CALL( __test_equal, (_retained, _direct) );
+
+    gp_uint64_t hash0;
+    GP_CALL( gp_canvas_get_hash, (_retained, &hash0) );
+
+    GP_CALL( gp_shape_set_position, (_retained, rect, 21.f, 20.f) );
+
+    gp_uint64_t hash1;
+    GP_CALL( gp_canvas_get_hash, (_retained, &hash1) );
+
+    if( hash0 == hash1 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_shape_set_position, (_retained, rect, 20.f, 20.f) );
+
+    gp_uint64_t hash2;
+    GP_CALL( gp_canvas_get_hash, (_retained, &hash2) );
+
+    if( hash0 != hash2 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_shape_remove, (_retained, circle) );
+
+    GP_CALL( gp_canvas_clear, (_direct) );
+    GP_CALL( __test_direct, (_direct, GP_FALSE) );
+    GP_CALL( __test_equal, (_retained, _direct) );
+
+    GP_CALL( gp_circle, (_retained, 50.f, 50.f, 10.f) );
+
+    gp_shape_handle_t reuse;
+    GP_CALL( gp_shape_retain, (_retained, GP_SHAPE_TYPE_ELLIPSE, &reuse) );
+
+    if( reuse == circle )
+    {
+        return GP_FAILURE;
+    }
+
+    if( gp_shape_set_position( _retained, circle, 0.f, 0.f ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_shape_remove, (_retained, reuse) );
+    GP_CALL( __test_equal, (_retained, _direct) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_gradient( gp_canvas_t * _canvas, float _x )
+{
+    const float stops[] = {0.f, 1.f, 0.f, 0.f, 1.f, 0.5f, 0.f, 1.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 1.f};
+
+    GP_CALL( gp_set_linear_gradient, (_canvas, 0.f, 0.f, 100.f, 0.f, stops, 3) );
+    GP_CALL( gp_rect, (_canvas, _x, 0.f, 50.f, 10.f) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_gradient_handles( gp_canvas_t * _retained, gp_canvas_t * _direct )
+{
+    GP_CALL( gp_canvas_clear, (_retained) );
+    GP_CALL( gp_canvas_clear, (_direct) );
+
+    GP_CALL( __test_gradient, (_retained, 200.f) );
+
+    gp_shape_handle_t rect;
+    GP_CALL( gp_shape_retain, (_retained, GP_SHAPE_TYPE_RECT, &rect) );
+
+    gp_mesh_t outside_mesh;
+    GP_CALL( gp_calculate_mesh_size, (_retained, &outside_mesh) );
+
+    GP_CALL( gp_shape_set_position, (_retained, rect, 25.f, 0.f) );
+
+    gp_mesh_t across_mesh;
+    GP_CALL( gp_calculate_mesh_size, (_retained, &across_mesh) );
+
+    if( across_mesh.vertex_count == outside_mesh.vertex_count )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( __test_gradient, (_direct, 25.f) );
+    GP_CALL( __test_equal, (_retained, _direct) );
+
+    GP_CALL( gp_shape_remove, (_retained, rect) );
+
+    gp_mesh_t empty_mesh;
+    GP_CALL( gp_calculate_mesh_size, (_retained, &empty_mesh) );
+
+    if( empty_mesh.vertex_count != 0 || empty_mesh.index_count != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_dirty_handles( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_rect, (_canvas, 0.f, 0.f, 10.f, 10.f) );
+
+    gp_shape_handle_t first;
+    GP_CALL( gp_shape_retain, (_canvas, GP_SHAPE_TYPE_RECT, &first) );
+
+    gp_shape_handle_t again;
+    GP_CALL( gp_shape_retain, (_canvas, GP_SHAPE_TYPE_RECT, &again) );
+
+    if( again != first )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_rect, (_canvas, 100.f, 0.f, 10.f, 10.f) );
+
+    gp_shape_handle_t second;
+    GP_CALL( gp_shape_retain, (_canvas, GP_SHAPE_TYPE_RECT, &second) );
+
+    GP_CALL( gp_rect, (_canvas, 200.f, 0.f, 10.f, 10.f) );
+
+    GP_CALL( gp_canvas_capture_frame, (_canvas) );
+
+    gp_dirty_rect_t rects[8];
+    gp_uint32_t count;
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_shape_set_position, (_canvas, first, 0.f, 50.f) );
+    GP_CALL( gp_shape_remove, (_canvas, second) );
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 3 )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_capture_frame, (_canvas) );
+    GP_CALL( gp_canvas_get_dirty_rects, (_canvas, rects, 8, &count) );
+
+    if( count != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+    const gp_canvas_t * snapshot;
+    GP_CALL( gp_canvas_snapshot, (_canvas, &snapshot) );
+
+    if( gp_shape_set_position( _canvas, first, 0.f, 0.f ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_rect, (_canvas, 0.f, 0.f, 10.f, 10.f) );
+
+    gp_shape_handle_t fresh;
+    GP_CALL( gp_shape_retain, (_canvas, GP_SHAPE_TYPE_RECT, &fresh) );
+
+    if( fresh == first || fresh == second )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_snapshot_release, (snapshot) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * retained;
+    if( gp_canvas_create( &retained, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * direct;
+    if( gp_canvas_create( &direct, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_shape_handles( retained, direct ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_gradient_handles( retained, direct ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_dirty_handles( retained ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( retained ) == GP_FAILURE || gp_canvas_destroy( direct ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
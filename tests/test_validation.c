@@ -0,0 +1,177 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+#define GP_CALL(M, Args) if( M Args == GP_FAILURE){ return GP_FAILURE;}
+//////////////////////////////////////////////////////////////////////////
+typedef struct validation_log_t
+{
+    gp_uint32_t count;
+    char message[256];
+} validation_log_t;
+//////////////////////////////////////////////////////////////////////////
+static void __validation( const char * _message, void * _ud )
+{
+    validation_log_t * log = (validation_log_t *)_ud;
+
+    ++log->count;
+
+    strncpy( log->message, _message, sizeof( log->message ) - 1 );
+    log->message[sizeof( log->message ) - 1] = '\0';
+}
+//////////////////////////////////////////////////////////////////////////
+static float positions[4096 * 2];
+static gp_uint16_t indices[8192];
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_validation( gp_canvas_t * _canvas )
+{
+    validation_log_t log;
+    log.count = 0;
+    log.message[0] = '\0';
+
+    GP_CALL( gp_canvas_set_validation, (_canvas, &__validation, &log) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 50.f) );
+    GP_CALL( gp_rect, (_canvas, 10.f, 10.f, 40.f, 20.f) );
+    GP_CALL( gp_circle, (_canvas, 100.f, 100.f, 20.f) );
+
+    gp_mesh_t mesh;
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    if( mesh.vertex_count > 4096 || mesh.index_count > 8192 )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.positions_buffer = positions;
+    mesh.positions_offset = 0;
+    mesh.positions_stride = sizeof( float ) * 2;
+
+    mesh.indices_buffer = indices;
+    mesh.indices_offset = 0;
+    mesh.indices_stride = sizeof( gp_uint16_t );
+
+    GP_CALL( gp_render, (_canvas, &mesh) );
+
+    if( log.count != 0 )
+    {
+        return GP_FAILURE;
+    }
+
+#if defined(GP_VALIDATION)
+    if( gp_pop_state( _canvas ) != GP_FAILURE || log.count != 1 || strstr( log.message, "gp_pop_state" ) == NULL )
+    {
+        return GP_FAILURE;
+    }
+
+    if( gp_set_miter_limit( _canvas, 0.5f ) != GP_FAILURE || log.count != 2 || strstr( log.message, "gp_set_miter_limit" ) == NULL )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_mesh_t small = mesh;
+    small.index_count -= 3;
+
+    if( gp_render( _canvas, &small ) != GP_FAILURE || log.count != 3 || strstr( log.message, "index count" ) == NULL )
+    {
+        return GP_FAILURE;
+    }
+
+    gp_mesh_t unset = mesh;
+    unset.positions_stride = mesh.colors_stride;
+
+    if( gp_render( _canvas, &unset ) != GP_FAILURE || log.count != 4 || strstr( log.message, "positions" ) == NULL )
+    {
+        return GP_FAILURE;
+    }
+#endif
+
+    GP_CALL( gp_canvas_set_validation, (_canvas, GP_NULLPTR, GP_NULLPTR) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __test_validation_overflow( gp_canvas_t * _canvas )
+{
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+
+    for( gp_uint32_t index = 1; index != 20000; ++index )
+    {
+        GP_CALL( gp_line_to, (_canvas, (float)index, (float)(index % 2) * 10.f) );
+    }
+
+    gp_mesh_t mesh;
+    if( gp_calculate_mesh_size( _canvas, &mesh ) != GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    GP_CALL( gp_canvas_clear, (_canvas) );
+
+    GP_CALL( gp_move_to, (_canvas, 0.f, 0.f) );
+    GP_CALL( gp_line_to, (_canvas, 100.f, 50.f) );
+
+    GP_CALL( gp_calculate_mesh_size, (_canvas, &mesh) );
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    GP_UNUSED( argc );
+    GP_UNUSED( argv );
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_validation( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( __test_validation_overflow( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( gp_canvas_destroy( canvas ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
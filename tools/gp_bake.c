@@ -0,0 +1,448 @@
+#include "graphics/graphics.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////////////
+static void * gp_malloc( gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = malloc( _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void * gp_realloc( void * _ptr, gp_size_t _size, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    void * p = realloc( _ptr, _size );
+
+    return p;
+}
+//////////////////////////////////////////////////////////////////////////
+static void gp_free( void * _ptr, void * _ud )
+{
+    GP_UNUSED( _ud );
+
+    free( _ptr );
+}
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_bake_options_t
+{
+    const char * directory;
+
+    gp_color_t tint;
+
+    gp_position_format_e positions_format;
+    float positions_origin_x;
+    float positions_origin_y;
+    float positions_scale;
+
+    gp_color_format_e colors_format;
+    gp_bool_t colors_premultiplied;
+
+    gp_bool_t uv;
+    gp_uv_format_e uv_format;
+
+    gp_bool_t sdf;
+} gp_bake_options_t;
+//////////////////////////////////////////////////////////////////////////
+typedef struct gp_bake_cache_t
+{
+    const char * directory;
+
+    void * blob;
+    gp_uint32_t hits;
+    gp_uint32_t writes;
+} gp_bake_cache_t;
+//////////////////////////////////////////////////////////////////////////
+static void * __read_file( const char * _path, gp_size_t * _size )
+{
+    FILE * f = fopen( _path, "rb" );
+
+    if( f == NULL )
+    {
+        return NULL;
+    }
+
+    fseek( f, 0, SEEK_END );
+    long size = ftell( f );
+    fseek( f, 0, SEEK_SET );
+
+    if( size <= 0 )
+    {
+        fclose( f );
+
+        return NULL;
+    }
+
+    void * buffer = malloc( (size_t)size );
+
+    if( fread( buffer, 1, (size_t)size, f ) != (size_t)size )
+    {
+        free( buffer );
+        fclose( f );
+
+        return NULL;
+    }
+
+    fclose( f );
+
+    *_size = (gp_size_t)size;
+
+    return buffer;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __make_cache_path( char * _path, size_t _capacity, const char * _directory, gp_uint64_t _hash )
+{
+    snprintf( _path, _capacity, "%s/%08x%08x.gpm", _directory, (unsigned int)(_hash >> 32), (unsigned int)(_hash & 0xffffffffU) );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __cache_read( gp_uint64_t _hash, const void ** _blob, gp_size_t * _size, void * _ud )
+{
+    gp_bake_cache_t * cache = (gp_bake_cache_t *)_ud;
+
+    char path[1024];
+    __make_cache_path( path, sizeof( path ), cache->directory, _hash );
+
+    cache->blob = __read_file( path, _size );
+
+    if( cache->blob != NULL )
+    {
+        ++cache->hits;
+    }
+
+    *_blob = cache->blob;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __cache_write( gp_uint64_t _hash, const void * _blob, gp_size_t _size, void * _ud )
+{
+    gp_bake_cache_t * cache = (gp_bake_cache_t *)_ud;
+
+    char path[1024];
+    __make_cache_path( path, sizeof( path ), cache->directory, _hash );
+
+    FILE * f = fopen( path, "wb" );
+
+    if( f == NULL )
+    {
+        return GP_FAILURE;
+    }
+
+    size_t written = fwrite( _blob, 1, _size, f );
+
+    fclose( f );
+
+    if( written != _size )
+    {
+        return GP_FAILURE;
+    }
+
+    ++cache->writes;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_size_t __get_vertex_size( const gp_bake_options_t * _options )
+{
+    gp_size_t size = 0;
+
+    size += _options->positions_format == GP_POSITION_FORMAT_SHORT2 ? 4 : 8;
+    size += sizeof( gp_argb_t );
+
+    if( _options->uv == GP_TRUE )
+    {
+        size += _options->uv_format == GP_UV_FORMAT_FLOAT2 ? 8 : 4;
+    }
+
+    if( _options->sdf == GP_TRUE )
+    {
+        size += sizeof( gp_sdf_t );
+    }
+
+    return size;
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __bake( gp_canvas_t * _canvas, const gp_bake_options_t * _options, gp_bake_cache_t * _cache, const char * _path )
+{
+    gp_size_t canvas_size;
+    void * canvas_buffer = __read_file( _path, &canvas_size );
+
+    if( canvas_buffer == NULL )
+    {
+        fprintf( stderr, "gp_bake: can't read '%s'\n", _path );
+
+        return GP_FAILURE;
+    }
+
+    gp_result_t result = gp_canvas_load_from_memory( _canvas, canvas_buffer, canvas_size );
+
+    free( canvas_buffer );
+
+    if( result == GP_FAILURE )
+    {
+        fprintf( stderr, "gp_bake: invalid canvas '%s'\n", _path );
+
+        return GP_FAILURE;
+    }
+
+    gp_mesh_t mesh;
+    if( gp_calculate_mesh_size( _canvas, &mesh ) == GP_FAILURE )
+    {
+        return GP_FAILURE;
+    }
+
+    mesh.color = _options->tint;
+
+    gp_size_t vertex_size = __get_vertex_size( _options );
+
+    gp_uint8_t * vertices = (gp_uint8_t *)malloc( vertex_size * mesh.vertex_count + 1 );
+    gp_uint16_t * indices = (gp_uint16_t *)malloc( sizeof( gp_uint16_t ) * mesh.index_count + 1 );
+
+    gp_size_t offset = 0;
+
+    mesh.positions_buffer = vertices;
+    mesh.positions_offset = offset;
+    mesh.positions_stride = vertex_size;
+    mesh.positions_format = _options->positions_format;
+    mesh.positions_origin_x = _options->positions_origin_x;
+    mesh.positions_origin_y = _options->positions_origin_y;
+    mesh.positions_scale = _options->positions_scale;
+    offset += _options->positions_format == GP_POSITION_FORMAT_SHORT2 ? 4 : 8;
+
+    mesh.colors_buffer = vertices;
+    mesh.colors_offset = offset;
+    mesh.colors_stride = vertex_size;
+    mesh.colors_format = _options->colors_format;
+    mesh.colors_premultiplied = _options->colors_premultiplied;
+    offset += sizeof( gp_argb_t );
+
+    if( _options->uv == GP_TRUE )
+    {
+        mesh.uv_buffer = vertices;
+        mesh.uv_offset = offset;
+        mesh.uv_stride = vertex_size;
+        mesh.uv_format = _options->uv_format;
+        offset += _options->uv_format == GP_UV_FORMAT_FLOAT2 ? 8 : 4;
+    }
+
+    if( _options->sdf == GP_TRUE )
+    {
+        mesh.sdf_buffer = vertices;
+        mesh.sdf_offset = offset;
+        mesh.sdf_stride = vertex_size;
+    }
+
+    mesh.indices_buffer = indices;
+    mesh.indices_offset = 0;
+    mesh.indices_stride = sizeof( gp_uint16_t );
+
+    gp_mesh_cache_t cache;
+    cache.read = &__cache_read;
+    cache.write = &__cache_write;
+    cache.ud = _cache;
+
+    _cache->blob = NULL;
+
+    result = gp_render_cached( _canvas, &mesh, &cache );
+
+    free( _cache->blob );
+    _cache->blob = NULL;
+
+    free( vertices );
+    free( indices );
+
+    if( result == GP_FAILURE )
+    {
+        fprintf( stderr, "gp_bake: can't bake '%s'\n", _path );
+
+        return GP_FAILURE;
+    }
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+static void __usage( void )
+{
+    fprintf( stderr, "usage: gp_bake [options] <cache directory> <canvas file>...\n" );
+    fprintf( stderr, "  --tint r g b a\n" );
+    fprintf( stderr, "  --positions float2|short2\n" );
+    fprintf( stderr, "  --positions-origin x y\n" );
+    fprintf( stderr, "  --positions-scale s\n" );
+    fprintf( stderr, "  --colors argb|abgr|rgba\n" );
+    fprintf( stderr, "  --premultiplied\n" );
+    fprintf( stderr, "  --uv float2|unorm16|half2\n" );
+    fprintf( stderr, "  --sdf\n" );
+}
+//////////////////////////////////////////////////////////////////////////
+static gp_result_t __parse_options( int _argc, char ** _argv, gp_bake_options_t * _options, int * _first )
+{
+    int index = 1;
+
+    for( ; index < _argc && strncmp( _argv[index], "--", 2 ) == 0; ++index )
+    {
+        const char * option = _argv[index];
+        int left = _argc - index - 1;
+
+        if( strcmp( option, "--tint" ) == 0 && left >= 4 )
+        {
+            _options->tint.r = (float)atof( _argv[++index] );
+            _options->tint.g = (float)atof( _argv[++index] );
+            _options->tint.b = (float)atof( _argv[++index] );
+            _options->tint.a = (float)atof( _argv[++index] );
+        }
+        else if( strcmp( option, "--positions" ) == 0 && left >= 1 )
+        {
+            const char * format = _argv[++index];
+
+            if( strcmp( format, "float2" ) == 0 )
+            {
+                _options->positions_format = GP_POSITION_FORMAT_FLOAT2;
+            }
+            else if( strcmp( format, "short2" ) == 0 )
+            {
+                _options->positions_format = GP_POSITION_FORMAT_SHORT2;
+            }
+            else
+            {
+                return GP_FAILURE;
+            }
+        }
+        else if( strcmp( option, "--positions-origin" ) == 0 && left >= 2 )
+        {
+            _options->positions_origin_x = (float)atof( _argv[++index] );
+            _options->positions_origin_y = (float)atof( _argv[++index] );
+        }
+        else if( strcmp( option, "--positions-scale" ) == 0 && left >= 1 )
+        {
+            _options->positions_scale = (float)atof( _argv[++index] );
+        }
+        else if( strcmp( option, "--colors" ) == 0 && left >= 1 )
+        {
+            const char * format = _argv[++index];
+
+            if( strcmp( format, "argb" ) == 0 )
+            {
+                _options->colors_format = GP_COLOR_FORMAT_ARGB;
+            }
+            else if( strcmp( format, "abgr" ) == 0 )
+            {
+                _options->colors_format = GP_COLOR_FORMAT_ABGR;
+            }
+            else if( strcmp( format, "rgba" ) == 0 )
+            {
+                _options->colors_format = GP_COLOR_FORMAT_RGBA;
+            }
+            else
+            {
+                return GP_FAILURE;
+            }
+        }
+        else if( strcmp( option, "--premultiplied" ) == 0 )
+        {
+            _options->colors_premultiplied = GP_TRUE;
+        }
+        else if( strcmp( option, "--uv" ) == 0 && left >= 1 )
+        {
+            const char * format = _argv[++index];
+
+            _options->uv = GP_TRUE;
+
+            if( strcmp( format, "float2" ) == 0 )
+            {
+                _options->uv_format = GP_UV_FORMAT_FLOAT2;
+            }
+            else if( strcmp( format, "unorm16" ) == 0 )
+            {
+                _options->uv_format = GP_UV_FORMAT_UNORM16;
+            }
+            else if( strcmp( format, "half2" ) == 0 )
+            {
+                _options->uv_format = GP_UV_FORMAT_HALF2;
+            }
+            else
+            {
+                return GP_FAILURE;
+            }
+        }
+        else if( strcmp( option, "--sdf" ) == 0 )
+        {
+            _options->sdf = GP_TRUE;
+        }
+        else
+        {
+            return GP_FAILURE;
+        }
+    }
+
+    if( _argc - index < 2 )
+    {
+        return GP_FAILURE;
+    }
+
+    _options->directory = _argv[index];
+
+    *_first = index + 1;
+
+    return GP_SUCCESSFUL;
+}
+//////////////////////////////////////////////////////////////////////////
+int main( int argc, char ** argv )
+{
+    gp_bake_options_t options;
+    options.directory = NULL;
+    options.tint.r = 1.f;
+    options.tint.g = 1.f;
+    options.tint.b = 1.f;
+    options.tint.a = 1.f;
+    options.positions_format = GP_POSITION_FORMAT_FLOAT2;
+    options.positions_origin_x = 0.f;
+    options.positions_origin_y = 0.f;
+    options.positions_scale = 1.f;
+    options.colors_format = GP_COLOR_FORMAT_ARGB;
+    options.colors_premultiplied = GP_FALSE;
+    options.uv = GP_FALSE;
+    options.uv_format = GP_UV_FORMAT_FLOAT2;
+    options.sdf = GP_FALSE;
+
+    int first;
+    if( __parse_options( argc, argv, &options, &first ) == GP_FAILURE )
+    {
+        __usage();
+
+        return EXIT_FAILURE;
+    }
+
+    gp_canvas_t * canvas;
+    if( gp_canvas_create( &canvas, &gp_malloc, &gp_realloc, &gp_free, GP_NULLPTR ) == GP_FAILURE )
+    {
+        return EXIT_FAILURE;
+    }
+
+    gp_bake_cache_t cache;
+    cache.directory = options.directory;
+    cache.blob = NULL;
+    cache.hits = 0;
+    cache.writes = 0;
+
+    int exit_code = EXIT_SUCCESS;
+
+    for( int index = first; index != argc; ++index )
+    {
+        if( __bake( canvas, &options, &cache, argv[index] ) == GP_FAILURE )
+        {
+            exit_code = EXIT_FAILURE;
+        }
+    }
+
+    gp_canvas_destroy( canvas );
+
+    printf( "gp_bake: %u written, %u up to date\n", cache.writes, cache.hits );
+
+    return exit_code;
+}